@@ -1,57 +1,195 @@
 #include <comm/protocol.h>
+#include <driverlib.h>
 #include <drivers/cli.h>
+#include <hal/hal_timer.h>
 #include <msp430.h>
-#include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
 
-// Helper function to send strings instead of numbers
-void send_string(const char* str) {
-  int i = 0;
-  while (str[i] != '\0') {
-    CLI_tx_byte(str[i]);
-    i++;
+// Parser position within a frame
+typedef enum {
+  RX_SYNC,
+  RX_TYPE,
+  RX_LENGTH,
+  RX_PAYLOAD,
+  RX_CRC_HIGH,
+  RX_CRC_LOW
+} RxState;
+
+static RxState rx_state = RX_SYNC;
+static Message rx_message;
+static uint8_t rx_index;
+static uint16_t rx_crc;
+static bool rx_crc_error;
+
+// Bytes of the frame being parsed, from its sync byte. If it turns out not
+// to be a frame, the sync byte was data and the rest is parsed again from
+// replay, so a real frame behind it is not lost.
+static uint8_t rx_raw[PROTOCOL_MAX_FRAME];
+static uint8_t rx_raw_length;
+static uint8_t replay[PROTOCOL_MAX_FRAME];
+static uint8_t replay_pos, replay_length;
+
+// CRC-16/CCITT-FALSE on the CRC16 module. Bytes written to CRCDIRB are
+// taken MSB first, and CRCINIRES then holds the CRC in normal bit order.
+static uint16_t frame_crc(const Message* msg) {
+  uint8_t i;
+
+  CRC_setSeed(CRC_BASE, 0xFFFF);
+  CRC_set8BitDataReversed(CRC_BASE, msg->type);
+  CRC_set8BitDataReversed(CRC_BASE, msg->length);
+  for (i = 0; i < msg->length; i++) {
+    CRC_set8BitDataReversed(CRC_BASE, msg->payload[i]);
   }
-  CLI_tx_byte('\r');
-  CLI_tx_byte('\n');
+  return CRC_getResult(CRC_BASE);
 }
 
-// Helper function to receive strings
-bool receive_string(char* buffer, int max_len, uint32_t timeout_cycles) {
-  int i = 0;
-  char c;
-  volatile uint32_t total_timeout = 0;
-  memset(buffer, 0, max_len);
-  while (!CLI_data_available() && total_timeout < timeout_cycles) {
-    total_timeout++;
-    if ((total_timeout % 16) == 0) {
-      __delay_cycles(1);
+void send_message(uint8_t type, const void* payload, uint8_t length) {
+  uint8_t frame[PROTOCOL_MAX_FRAME];
+  Message msg;
+  uint16_t crc;
+
+  if (length > PROTOCOL_MAX_PAYLOAD) length = PROTOCOL_MAX_PAYLOAD;
+  msg.type = type;
+  msg.length = length;
+  memcpy(msg.payload, payload, length);
+  crc = frame_crc(&msg);
+
+  frame[0] = PROTOCOL_SYNC;
+  frame[1] = type;
+  frame[2] = length;
+  memcpy(frame + 3, payload, length);
+  frame[3 + length] = crc >> 8;
+  frame[4 + length] = crc;
+
+  // One buffer, so the UART sends it as a single frame
+  CLI_tx_buffer(frame, PROTOCOL_OVERHEAD + length);
+}
+
+// Drops the frame being parsed and queues its bytes after the sync byte to
+// be parsed again, ahead of whatever was still queued
+static void resync(void) {
+  uint8_t remaining = replay_length - replay_pos;
+  uint8_t from = 1;
+
+  while (from < rx_raw_length && rx_raw[from] != PROTOCOL_SYNC) from++;
+  memmove(replay + (rx_raw_length - from), replay + replay_pos, remaining);
+  memcpy(replay, rx_raw + from, rx_raw_length - from);
+  replay_pos = 0;
+  replay_length = rx_raw_length - from + remaining;
+  rx_state = RX_SYNC;
+}
+
+// Returns true when byte completes a frame with a good CRC
+static bool parse_byte(uint8_t byte) {
+  if (rx_state == RX_SYNC) {
+    if (byte == PROTOCOL_SYNC) {
+      rx_raw[0] = byte;
+      rx_raw_length = 1;
+      rx_state = RX_TYPE;
     }
+    return false;
   }
-  if (total_timeout >= timeout_cycles) return false;
-  volatile int char_timeout = 0;
-  while (i < max_len - 1) {
-    if (CLI_data_available()) {
-      c = CLI_rx_byte();
-      if (c == '\n' || c == '\r') {
-        __delay_cycles(800);
-        if (CLI_data_available()) {
-          CLI_rx_byte();
-        }
-        break;
+  rx_raw[rx_raw_length++] = byte;
+
+  switch (rx_state) {
+    case RX_SYNC:
+      break;
+    case RX_TYPE:
+      rx_message.type = byte;
+      rx_state = RX_LENGTH;
+      break;
+    case RX_LENGTH:
+      rx_message.length = byte;
+      rx_index = 0;
+      if (byte > PROTOCOL_MAX_PAYLOAD) {
+        resync();
+      } else {
+        rx_state = byte > 0 ? RX_PAYLOAD : RX_CRC_HIGH;
       }
-      if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
-          (c >= '0' && c <= '9')) {
-        buffer[i++] = c;
+      break;
+    case RX_PAYLOAD:
+      rx_message.payload[rx_index++] = byte;
+      if (rx_index == rx_message.length) rx_state = RX_CRC_HIGH;
+      break;
+    case RX_CRC_HIGH:
+      rx_crc = (uint16_t)byte << 8;
+      rx_state = RX_CRC_LOW;
+      break;
+    case RX_CRC_LOW:
+      rx_crc |= byte;
+      if (rx_crc == frame_crc(&rx_message)) {
+        rx_state = RX_SYNC;
+        return true;
       }
-      char_timeout = 0;
+      rx_crc_error = true;
+      resync();
+      break;
+  }
+  return false;
+}
+
+ReceiveStatus receive_message(Message* msg) {
+  if (CLI_rx_overflow()) {
+    // The driver dropped what it still held, so the frame being parsed has
+    // lost its middle; start again at the next sync byte
+    rx_state = RX_SYNC;
+    replay_pos = replay_length = 0;
+    return RECEIVE_OVERFLOW;
+  }
+
+  for (;;) {
+    uint8_t byte;
+
+    if (replay_pos < replay_length) {
+      byte = replay[replay_pos++];
+    } else if (CLI_data_available()) {
+      byte = CLI_rx_byte();
+    } else if (rx_state != RX_SYNC && CLI_rx_idle()) {
+      // The line went quiet partway through a frame, so the rest of it is
+      // not coming. Parse what followed its sync byte again next time.
+      resync();
+      return RECEIVE_CRC_ERROR;
     } else {
-      char_timeout++;
-      if (char_timeout > 10000) {
-        break;
+      return RECEIVE_TIMEOUT;
+    }
+    if (parse_byte(byte)) {
+      *msg = rx_message;
+      return RECEIVE_OK;
+    }
+    if (rx_crc_error) {
+      rx_crc_error = false;
+      return RECEIVE_CRC_ERROR;
+    }
+  }
+}
+
+void send_string(const char* str) {
+  send_message(MSG_MOVE, str, strlen(str));
+}
+
+ReceiveStatus receive_string(char* buffer, int max_len, uint16_t timeout_ms) {
+  uint32_t start = HAL_TIMER_get_ms();
+  uint32_t elapsed;
+  ReceiveStatus status;
+  Message msg;
+
+  memset(buffer, 0, max_len);
+  for (;;) {
+    status = receive_message(&msg);
+    if (status == RECEIVE_OK) {
+      if (msg.type == MSG_MOVE) {
+        if (msg.length > max_len - 1) return RECEIVE_OVERFLOW;
+        memcpy(buffer, msg.payload, msg.length);
+        buffer[msg.length] = '\0';
+        return RECEIVE_OK;
       }
+      if (msg.type == MSG_PING) send_message(MSG_ACK, NULL, 0);
+      continue;
     }
+    if (status != RECEIVE_TIMEOUT) return status;
+
+    elapsed = HAL_TIMER_get_ms() - start;
+    if (elapsed >= timeout_ms) return RECEIVE_TIMEOUT;
+    CLI_wait_rx(timeout_ms - elapsed);
   }
-  buffer[i] = '\0';
-  return (i > 0);
 }
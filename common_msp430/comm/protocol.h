@@ -4,7 +4,53 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Frame on the MSP430-CC1310 UART:
+//   PROTOCOL_SYNC, type, length, payload[length], CRC high byte, CRC low byte
+// The CRC is CRC-16/CCITT-FALSE (polynomial 0x1021, seed 0xFFFF, MSB first)
+// over type, length and payload. The CC1310s check it in software and relay
+// whole frames over RF, so it protects the message from MSP430 to MSP430.
+#define PROTOCOL_SYNC 0xA5
+#define PROTOCOL_MAX_PAYLOAD 32
+#define PROTOCOL_OVERHEAD 5
+#define PROTOCOL_MAX_FRAME (PROTOCOL_MAX_PAYLOAD + PROTOCOL_OVERHEAD)
+
+typedef enum {
+  MSG_MOVE = 1,        // Move string, e.g. "C3D4" or "C3E5C7", no terminator
+  MSG_ACK = 2,         // Empty, answers a ping
+  MSG_PING = 3,        // Empty, asks for an ack
+  MSG_STATE_SYNC = 4,  // Game state, for resynchronizing the two units
+  MSG_TELEMETRY = 5    // Free-form diagnostics
+} MessageType;
+
+typedef struct {
+  uint8_t type;
+  uint8_t length;
+  uint8_t payload[PROTOCOL_MAX_PAYLOAD];
+} Message;
+
+typedef enum {
+  RECEIVE_OK,        // A complete frame with a good CRC
+  RECEIVE_TIMEOUT,   // No complete frame yet
+  RECEIVE_OVERFLOW,  // Received bytes were lost, or the move did not fit
+  RECEIVE_CRC_ERROR  // A frame arrived damaged or cut short and was dropped
+} ReceiveStatus;
+
+// Sends one frame; payloads longer than PROTOCOL_MAX_PAYLOAD are cut off
+void send_message(uint8_t type, const void* payload, uint8_t length);
+// Parses the bytes received so far without waiting. Returns RECEIVE_OK and
+// fills msg when they complete a frame with a good CRC, and RECEIVE_TIMEOUT
+// when they do not complete one. Anything that is not a frame is skipped up
+// to the next sync byte. A frame cut short by the line going idle, or one
+// with a bad CRC, is dropped with RECEIVE_CRC_ERROR.
+ReceiveStatus receive_message(Message* msg);
+
+// A move as a MSG_MOVE frame
 void send_string(const char* str);
-bool receive_string(char* buffer, int max_len, uint32_t timeout_cycles);
+// Waits up to timeout_ms for a MSG_MOVE frame and copies its move string
+// into buffer, answering pings meanwhile. Sleeps in LPM0 until the UART
+// driver sees a burst of bytes end, or its buffer half fill.
+// Returns early with RECEIVE_OVERFLOW or RECEIVE_CRC_ERROR if a frame was
+// lost on the way.
+ReceiveStatus receive_string(char* buffer, int max_len, uint16_t timeout_ms);
 
 #endif /* COMM_PROTOCOL_H_ */
@@ -16,3 +16,23 @@ void CLI_tx_byte(uint8_t txByte)
 {
     HAL_UART_tx_byte(txByte);
 }
+
+void CLI_tx_buffer(const uint8_t* data, uint16_t length)
+{
+    HAL_UART_send(data, length);
+}
+
+void CLI_wait_rx(uint16_t max_ms)
+{
+    HAL_UART_wait_rx(max_ms);
+}
+
+bool CLI_rx_idle(void)
+{
+    return HAL_UART_rx_idle();
+}
+
+bool CLI_rx_overflow(void)
+{
+    return HAL_UART_rx_overflow();
+}
@@ -7,6 +7,10 @@
 bool CLI_data_available(void);
 uint8_t CLI_rx_byte(void);
 void CLI_tx_byte(uint8_t txByte);
+void CLI_tx_buffer(const uint8_t* data, uint16_t length);
+void CLI_wait_rx(uint16_t max_ms);
+bool CLI_rx_idle(void);
+bool CLI_rx_overflow(void);
 
 
 #endif /* DRIVERS_CLI_H_ */
@@ -10,6 +10,53 @@ uint16_t Lcd_ScreenWidth, Lcd_ScreenHeigth;
 uint8_t Lcd_PenSolid, Lcd_FontSolid, Lcd_FlagRead;
 uint16_t Lcd_TouchTrim;
 
+// Drawn for characters a font does not have, as in grlib's string.c
+#define LCD_ABSENT_CHAR '.'
+
+// One row of pixels in display byte order, streamed out by DMA
+static uint8_t Lcd_PixelBuffer[2 * LCD_VERTICAL_MAX];
+static uint16_t Lcd_PixelBytes;
+
+static void CRYSTALFONTZ_flush_pixels(void)
+{
+    uint16_t i;
+
+    if (Lcd_PixelBytes >= LCD_DMA_MIN_BYTES)
+    {
+        HAL_LCD_writeDataDMA(Lcd_PixelBuffer, Lcd_PixelBytes);
+    }
+    else
+    {
+        for (i = 0; i < Lcd_PixelBytes; i++)
+        {
+            HAL_LCD_writeData(Lcd_PixelBuffer[i]);
+        }
+    }
+    Lcd_PixelBytes = 0;
+}
+
+static void CRYSTALFONTZ_buffer_pixel(uint16_t ulValue)
+{
+    Lcd_PixelBuffer[Lcd_PixelBytes++] = ulValue >> 8;
+    Lcd_PixelBuffer[Lcd_PixelBytes++] = ulValue;
+    if (Lcd_PixelBytes == sizeof(Lcd_PixelBuffer))
+    {
+        CRYSTALFONTZ_flush_pixels();
+    }
+}
+
+static void CRYSTALFONTZ_fill_pixels(uint16_t ulValue, uint32_t pixels)
+{
+    if (2 * pixels >= LCD_DMA_MIN_BYTES)
+    {
+        HAL_LCD_fillDMA(ulValue, pixels);
+    }
+    else
+    {
+        HAL_LCD_fillBurst(ulValue, pixels);
+    }
+}
+
 void CRYSTALFONTZ_init(void)
 {
     GPIO_setOutputLowOnPin(LCD_RST_PORT, LCD_RST_PIN);
@@ -49,12 +96,7 @@ void CRYSTALFONTZ_init(void)
 
     CRYSTALFONTZ_set_draw_frame(0, 0, 127, 127);
     HAL_LCD_writeCommand(CM_RAMWR);
-    int i;
-    for (i = 0; i < 16384; i++)
-    {
-        HAL_LCD_writeData(0xFF);
-        HAL_LCD_writeData(0xFF);
-    }
+    CRYSTALFONTZ_fill_pixels(0xFFFF, 16384);
 
     HAL_LCD_delay(10);
     HAL_LCD_writeCommand(CM_DISPON);
@@ -126,6 +168,261 @@ void CRYSTALFONTZ_set_orientation(uint8_t orientation)
 }
 
 
+//
+// Copies a width x height block of RGB565 pixels, stored high byte first in
+// the order the LCD takes them, to the screen in one RAMWR transfer.
+//
+void CRYSTALFONTZ_draw_tile(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pixels)
+{
+    uint16_t bytes = 2 * width * height;
+    uint16_t i;
+
+    CRYSTALFONTZ_set_draw_frame(x, y, x + width - 1, y + height - 1);
+    HAL_LCD_writeCommand(CM_RAMWR);
+    if (bytes >= LCD_DMA_MIN_BYTES)
+    {
+        HAL_LCD_writeDataDMA(pixels, bytes);
+    }
+    else
+    {
+        for (i = 0; i < bytes; i++)
+        {
+            HAL_LCD_writeData(pixels[i]);
+        }
+    }
+}
+
+
+//
+// Frame memory line shown on a screen row.  UP mirrors the rows (MY), so its
+// rows run up the frame memory, and its window offset of 3 puts row 0 on
+// line 128.
+//
+static uint16_t CRYSTALFONTZ_frame_line(uint16_t y)
+{
+    if (Lcd_Orientation == LCD_ORIENTATION_UP)
+    {
+        return LCD_FRAME_LINES - 1 - (y + 3);
+    }
+    return y + 1;
+}
+
+static void CRYSTALFONTZ_write_word(uint16_t value)
+{
+    HAL_LCD_writeData((uint8_t)(value >> 8));
+    HAL_LCD_writeData((uint8_t)(value));
+}
+
+static uint16_t Lcd_ScrollFirstLine, Lcd_ScrollHeight;
+
+//
+// Makes screen rows y to y + height - 1 a hardware scroll area: the rows
+// outside it stay where they are, and CRYSTALFONTZ_scroll rotates the rows
+// inside it without redrawing them.  Drawing still addresses the rows as
+// if nothing had scrolled.
+//
+void CRYSTALFONTZ_set_scroll_area(uint16_t y, uint16_t height)
+{
+    if (Lcd_Orientation == LCD_ORIENTATION_UP)
+    {
+        Lcd_ScrollFirstLine = CRYSTALFONTZ_frame_line(y + height - 1);
+    }
+    else
+    {
+        Lcd_ScrollFirstLine = CRYSTALFONTZ_frame_line(y);
+    }
+    Lcd_ScrollHeight = height;
+
+    HAL_LCD_writeCommand(CM_VSCRDEF);
+    CRYSTALFONTZ_write_word(Lcd_ScrollFirstLine);
+    CRYSTALFONTZ_write_word(height);
+    CRYSTALFONTZ_write_word(LCD_FRAME_LINES - Lcd_ScrollFirstLine - height);
+}
+
+//
+// Shows, on the first row of the scroll area, the row drawn offset rows
+// below it; the rows above it wrap around to the bottom.  One command, three
+// bytes.
+//
+void CRYSTALFONTZ_scroll(uint16_t offset)
+{
+    uint16_t start;
+
+    offset %= Lcd_ScrollHeight;
+    if (Lcd_Orientation == LCD_ORIENTATION_UP)
+    {
+        // The frame lines run the other way, so scroll the other way
+        start = (Lcd_ScrollHeight - offset) % Lcd_ScrollHeight;
+    }
+    else
+    {
+        start = offset;
+    }
+
+    HAL_LCD_writeCommand(CM_VSCRSADD);
+    CRYSTALFONTZ_write_word(Lcd_ScrollFirstLine + start);
+}
+
+//
+// Enters partial mode with only screen rows y0 to y1 displayed; the panel
+// does not drive the other rows, which saves power while nothing changes.
+//
+void CRYSTALFONTZ_set_partial_rows(uint16_t y0, uint16_t y1)
+{
+    uint16_t start = CRYSTALFONTZ_frame_line(y0);
+    uint16_t end = CRYSTALFONTZ_frame_line(y1);
+
+    HAL_LCD_writeCommand(CM_PTLAR);
+    if (start <= end)
+    {
+        CRYSTALFONTZ_write_word(start);
+        CRYSTALFONTZ_write_word(end);
+    }
+    else
+    {
+        CRYSTALFONTZ_write_word(end);
+        CRYSTALFONTZ_write_word(start);
+    }
+    HAL_LCD_writeCommand(CM_PTLON);
+}
+
+//
+// Leaves partial mode and displays every row again.
+//
+void CRYSTALFONTZ_set_normal_mode(void)
+{
+    HAL_LCD_writeCommand(CM_NORON);
+}
+
+//
+// Returns the glyph grlib would draw for a character of the font, including
+// the replacement for characters the font does not have.
+//
+static const uint8_t *CRYSTALFONTZ_glyph(const Graphics_Font *font, int8_t c)
+{
+    const uint8_t *glyphs;
+    const uint16_t *offset;
+    uint8_t first, last, absent;
+    uint8_t ch = (uint8_t)c;
+
+    if (font->format & GRAPHICS_FONT_EX_MARKER)
+    {
+        const Graphics_FontEx *fontEx = (const Graphics_FontEx *)font;
+
+        glyphs = fontEx->data;
+        offset = fontEx->offset;
+        first = fontEx->first;
+        last = fontEx->last;
+        if ((LCD_ABSENT_CHAR >= first) &&
+            (LCD_ABSENT_CHAR <= last))
+        {
+            absent = LCD_ABSENT_CHAR;
+        }
+        else
+        {
+            absent = first;
+        }
+    }
+    else
+    {
+        glyphs = font->data;
+        offset = font->offset;
+        first = 32;
+        last = 126;
+        absent = LCD_ABSENT_CHAR;
+    }
+
+    if ((ch >= first) && (ch <= last))
+    {
+        return glyphs + offset[ch - first];
+    }
+    return glyphs + offset[absent - first];
+}
+
+//
+// Draws an opaque string with its upper left corner at (x, y), like
+// Graphics_drawString, but as one draw window around the whole string and one
+// RAMWR transfer: the glyphs are decoded a screen row at a time into the
+// pixel buffer.  grlib sets a new window for every run of pixels instead.
+// Pixel-RLE fonts and strings that do not fit on the screen go through grlib.
+//
+void CRYSTALFONTZ_draw_string(const Graphics_Context *context,
+                              int8_t *string,
+                              int32_t length,
+                              int32_t x,
+                              int32_t y)
+{
+    const Graphics_Font *font = context->font;
+    uint16_t foreground = context->foreground;
+    uint16_t background = context->background;
+    int32_t width = Graphics_getStringWidth(context, string, length);
+    int32_t count, i;
+    uint8_t row, column;
+
+    if (width == 0)
+    {
+        return;
+    }
+    if (((font->format & ~GRAPHICS_FONT_EX_MARKER) !=
+         GRAPHICS_FONT_FMT_UNCOMPRESSED) ||
+        (x < 0) || (y < 0) ||
+        (x + width > LCD_HORIZONTAL_MAX) ||
+        (y + font->height > LCD_VERTICAL_MAX))
+    {
+        Graphics_drawString(context, string, length, x, y, OPAQUE_TEXT);
+        return;
+    }
+
+    for (count = 0; string[count] && (count != length); count++)
+    {
+    }
+
+    CRYSTALFONTZ_set_draw_frame(x, y, x + width - 1, y + font->height - 1);
+    HAL_LCD_writeCommand(CM_RAMWR);
+
+    for (row = 0; row < font->height; row++)
+    {
+        for (i = 0; i < count; i++)
+        {
+            const uint8_t *data = CRYSTALFONTZ_glyph(font, string[i]);
+            uint16_t bits = (data[0] - 2) * 8;
+            uint16_t bit = row * data[1];
+
+            // Rows past the end of the glyph data are background
+            for (column = 0; column < data[1]; column++, bit++)
+            {
+                if ((bit < bits) &&
+                    (data[2 + (bit >> 3)] & (0x80 >> (bit & 7))))
+                {
+                    CRYSTALFONTZ_buffer_pixel(foreground);
+                }
+                else
+                {
+                    CRYSTALFONTZ_buffer_pixel(background);
+                }
+            }
+        }
+    }
+
+    CRYSTALFONTZ_flush_pixels();
+}
+
+//
+// Same as Graphics_drawStringCentered, drawn with CRYSTALFONTZ_draw_string.
+//
+void CRYSTALFONTZ_draw_string_centered(const Graphics_Context *context,
+                                       int8_t *string,
+                                       int32_t length,
+                                       int32_t x,
+                                       int32_t y)
+{
+    CRYSTALFONTZ_draw_string(context, string, length,
+                             x - (Graphics_getStringWidth(context, string,
+                                                          length) / 2),
+                             y - (context->font->baseline / 2));
+}
+
+
 static void CRYSTALFONTZ_pixel_draw(void *pvDisplayData,
                                  int16_t lX,
                                  int16_t lY,
@@ -138,8 +435,7 @@ static void CRYSTALFONTZ_pixel_draw(void *pvDisplayData,
     // Write the pixel value.
     //
     HAL_LCD_writeCommand(CM_RAMWR);
-    HAL_LCD_writeData(ulValue>>8);
-    HAL_LCD_writeData(ulValue);
+    HAL_LCD_fillBurst(ulValue, 1);
 }
 
 static void CRYSTALFONTZ_pixel_draw_multiple(void *pvDisplayData,
@@ -178,9 +474,7 @@ static void CRYSTALFONTZ_pixel_draw_multiple(void *pvDisplayData,
                 for(; (lX0 < 8) && lCount; lX0++, lCount--)
                 {
                     // Draw this pixel in the appropriate color
-                    HAL_LCD_writeData((((uint32_t *)pucPalette)[(Data >>
-                                                             (7 - lX0)) & 1])>>8);
-                    HAL_LCD_writeData(((uint32_t *)pucPalette)[(Data >>
+                    CRYSTALFONTZ_buffer_pixel(((uint32_t *)pucPalette)[(Data >>
                                                              (7 - lX0)) & 1]);
                 }
 
@@ -213,8 +507,7 @@ static void CRYSTALFONTZ_pixel_draw_multiple(void *pvDisplayData,
                         Data = (*pucData >> 4);
                         Data = (*(uint16_t *)(pucPalette + Data));
                         // Write to LCD screen
-                        HAL_LCD_writeData(Data>>8);
-                        HAL_LCD_writeData(Data);
+                        CRYSTALFONTZ_buffer_pixel(Data);
 
                         // Decrement the count of pixels to draw
                         lCount--;
@@ -229,8 +522,7 @@ static void CRYSTALFONTZ_pixel_draw_multiple(void *pvDisplayData,
                             Data = (*pucData++ & 15);
                             Data = (*(uint16_t *)(pucPalette + Data));
                             // Write to LCD screen
-                            HAL_LCD_writeData(Data>>8);
-                            HAL_LCD_writeData(Data);
+                            CRYSTALFONTZ_buffer_pixel(Data);
 
                             // Decrement the count of pixels to draw
                             lCount--;
@@ -253,8 +545,7 @@ static void CRYSTALFONTZ_pixel_draw_multiple(void *pvDisplayData,
                 Data = *pucData++;
                 Data = (*(uint16_t *)(pucPalette + Data));
                 // Write to LCD screen
-                HAL_LCD_writeData(Data>>8);
-                HAL_LCD_writeData(Data);
+                CRYSTALFONTZ_buffer_pixel(Data);
             }
             // The image data has been drawn
             break;
@@ -280,11 +571,12 @@ static void CRYSTALFONTZ_pixel_draw_multiple(void *pvDisplayData,
                 pucData += 2;
 
                 // Translate this palette entry and write it to the screen
-                HAL_LCD_writeData(usData>>8);
-                HAL_LCD_writeData(usData);
+                CRYSTALFONTZ_buffer_pixel(usData);
             }
         }
     }
+
+    CRYSTALFONTZ_flush_pixels();
 }
 
 static void CRYSTALFONTZ_line_draw_h(void *pvDisplayData,
@@ -300,13 +592,8 @@ static void CRYSTALFONTZ_line_draw_h(void *pvDisplayData,
     //
     // Write the pixel value.
     //
-    int16_t i;
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = lX1; i <= lX2; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    CRYSTALFONTZ_fill_pixels(ulValue, lX2 - lX1 + 1);
 }
 
 static void CRYSTALFONTZ_line_draw_v(void *pvDisplayData,
@@ -320,13 +607,8 @@ static void CRYSTALFONTZ_line_draw_v(void *pvDisplayData,
     //
     // Write the pixel value.
     //
-    int16_t i;
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = lY1; i <= lY2; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    CRYSTALFONTZ_fill_pixels(ulValue, lY2 - lY1 + 1);
 }
 
 static void CRYSTALFONTZ_rect_fill(void *pvDisplayData,
@@ -343,14 +625,9 @@ static void CRYSTALFONTZ_rect_fill(void *pvDisplayData,
     //
     // Write the pixel value.
     //
-    int16_t i;
-    int16_t pixels = (x1 - x0 + 1) * (y1 - y0 + 1);
+    uint32_t pixels = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = 0; i <= pixels; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    CRYSTALFONTZ_fill_pixels(ulValue, pixels);
 }
 
 static uint32_t CRYSTALFONTZ_color_translate(void *pvDisplayData,
@@ -9,6 +9,9 @@
 #define LCD_VERTICAL_MAX                   128
 #define LCD_HORIZONTAL_MAX                 128
 
+// Lines of ST7735 frame memory; the panel shows lines 1 to 128
+#define LCD_FRAME_LINES                    132
+
 // LCD Screen Orientation Modes
 #define LCD_ORIENTATION_UP    0
 #define LCD_ORIENTATION_LEFT  1
@@ -35,6 +38,8 @@
 #define CM_RGBSET          0x2d
 #define CM_RAMRD           0x2E
 #define CM_PTLAR           0x30
+#define CM_VSCRDEF         0x33
+#define CM_VSCRSADD        0x37
 #define CM_MADCTL          0x36
 #define CM_COLMOD          0x3A
 #define CM_SETPWCTR        0xB1
@@ -59,6 +64,16 @@ extern Graphics_Display g_sCRYSTALFONTZ;
 void CRYSTALFONTZ_init(void);
 void CRYSTALFONTZ_set_draw_frame(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void CRYSTALFONTZ_set_orientation(uint8_t orientation);
+void CRYSTALFONTZ_draw_string(const Graphics_Context *context, int8_t *string, int32_t length, int32_t x, int32_t y);
+void CRYSTALFONTZ_draw_string_centered(const Graphics_Context *context, int8_t *string, int32_t length, int32_t x, int32_t y);
+void CRYSTALFONTZ_draw_tile(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pixels);
+
+// Hardware scrolling and partial mode work on frame memory lines, which are
+// screen rows only in the UP and DOWN orientations
+void CRYSTALFONTZ_set_scroll_area(uint16_t y, uint16_t height);
+void CRYSTALFONTZ_scroll(uint16_t offset);
+void CRYSTALFONTZ_set_partial_rows(uint16_t y0, uint16_t y1);
+void CRYSTALFONTZ_set_normal_mode(void);
 
 
 #endif /* __CRYSTALFONTZLCD_H__ */
@@ -0,0 +1,275 @@
+#include <game/ai.h>
+#include <game/book.h>
+#include <game/tt.h>
+#include <hal/hal_timer.h>
+
+// Evaluation weights, a man is worth 100
+#define KING_VALUE 160
+#define MAN_VALUE 100
+#define ADVANCE_BONUS 3   // Per row a man has advanced
+#define BACK_ROW_BONUS 8  // Per man still guarding its home row
+#define WIN_SCORE 30000
+
+// Nodes searched between two reads of the clock
+#define TIME_CHECK_INTERVAL 128
+
+// Deepest ply, leaving room to follow forced captures past the last iteration
+#define AI_MAX_PLY (AI_MAX_DEPTH + 8)
+
+// Worst-case stack. The post-build step runs ofd430 --call_graph and writes
+// each function's frame size, as the compiler laid it out, to
+// <project>_call_graph.xml (CCS shows the same data in its Stack Usage
+// view). The analysis cannot bound recursion, so the worst case is the
+// deepest path it reports, which is main -> play_ai_move ->
+// CHECKERS_ai_best_move -> search -> CHECKERS_generate_moves -> extend_chain
+// -> record_chain -> add_chain, plus (AI_MAX_PLY - 3) more search frames
+// (plies 2 to 22; ply 23 only evaluates) and CHECKERS_MAX_JUMPS more
+// extend_chain frames, plus the deepest interrupt. The linker stack
+// (--stack_size in the .cproject files) must cover that sum; it is 2048
+// bytes. search keeps nothing bigger than a few ints on the stack for that
+// reason: the move lists and undo records live in FRAM, one per ply.
+
+// One move list per ply, about 18KB in total, so they live in FRAM rather
+// than SRAM
+#pragma PERSISTENT(ply_moves)
+static MoveList ply_moves[AI_MAX_PLY] = {0};
+
+// What CHECKERS_make_move changes, to take a move back
+typedef struct {
+  uint32_t red;
+  uint32_t black;
+  uint32_t kings;
+  uint32_t hash;
+  Player current_player;
+} Undo;
+
+#pragma PERSISTENT(ply_undo)
+static Undo ply_undo[AI_MAX_PLY] = {0};
+
+// Search state
+static GameState position;
+static uint32_t start_ms;
+static uint16_t budget_ms;
+static bool timed;
+static uint32_t nodes;
+static bool aborted;
+static uint16_t overflows;
+static AiStats stats;
+
+static const uint8_t nibble_bits[16] = {0, 1, 1, 2, 1, 2, 2, 3,
+                                        1, 2, 2, 3, 2, 3, 3, 4};
+
+static int count_bits(uint32_t bb) {
+  int count = 0;
+  while (bb) {
+    count += nibble_bits[bb & 0xF];
+    bb >>= 4;
+  }
+  return count;
+}
+
+static void save(Undo* undo) {
+  undo->red = position.red;
+  undo->black = position.black;
+  undo->kings = position.kings;
+  undo->hash = position.hash;
+  undo->current_player = position.current_player;
+}
+
+static void restore(const Undo* undo) {
+  position.red = undo->red;
+  position.black = undo->black;
+  position.kings = undo->kings;
+  position.hash = undo->hash;
+  position.current_player = undo->current_player;
+}
+
+// Static score of the position for the side to move
+static int evaluate(void) {
+  uint32_t red_men = position.red & ~position.kings;
+  uint32_t black_men = position.black & ~position.kings;
+  int score = KING_VALUE * (count_bits(position.red & position.kings) -
+                            count_bits(position.black & position.kings));
+  int row;
+
+  // Men gain value as they advance: red moves up the board, black down
+  for (row = 0; row < 8; row++) {
+    score += (MAN_VALUE + ADVANCE_BONUS * (7 - row)) *
+             nibble_bits[(red_men >> (4 * row)) & 0xF];
+    score -= (MAN_VALUE + ADVANCE_BONUS * row) *
+             nibble_bits[(black_men >> (4 * row)) & 0xF];
+  }
+  score += BACK_ROW_BONUS *
+           (nibble_bits[red_men >> 28] - nibble_bits[black_men & 0xF]);
+
+  return (position.current_player == PLAYER_RED) ? score : -score;
+}
+
+static bool out_of_time(void) {
+  if ((++nodes % TIME_CHECK_INTERVAL) == 0 && timed &&
+      (HAL_TIMER_get_ms() - start_ms) >= budget_ms) {
+    aborted = true;
+  }
+  return aborted;
+}
+
+// Win scores depend on the distance from the root; the table stores them
+// relative to the node so they can be reused at a different ply
+static int score_to_tt(int score, int ply) {
+  if (score >= WIN_SCORE - AI_MAX_PLY) return score + ply;
+  if (score <= -WIN_SCORE + AI_MAX_PLY) return score - ply;
+  return score;
+}
+
+static int score_from_tt(int score, int ply) {
+  if (score >= WIN_SCORE - AI_MAX_PLY) return score - ply;
+  if (score <= -WIN_SCORE + AI_MAX_PLY) return score + ply;
+  return score;
+}
+
+// Negamax alpha-beta. Positions with a capture pending are searched past the
+// nominal depth, since captures are forced and would distort the evaluation.
+static int search(int depth, int ply, int alpha, int beta) {
+  MoveList* list = &ply_moves[ply];
+  Undo* undo = &ply_undo[ply];
+  const TtEntry* entry;
+  int original_alpha = alpha;
+  int best = -WIN_SCORE;
+  int best_index = TT_NO_MOVE;
+  int first = 0;
+  int n;
+
+  if (out_of_time()) return 0;
+  if (ply >= AI_MAX_PLY - 1) return evaluate();
+  if (depth <= 0 && !CHECKERS_has_capture(&position)) return evaluate();
+
+  entry = TT_probe(position.hash);
+  if (entry != NULL) {
+    if (entry->depth >= depth) {
+      int score = score_from_tt(entry->score, ply);
+
+      if (entry->bound == TT_EXACT) return score;
+      if (entry->bound == TT_LOWER && score >= beta) return score;
+      if (entry->bound == TT_UPPER && score <= alpha) return score;
+    }
+    first = entry->best;
+  }
+
+  CHECKERS_generate_moves(&position, list);
+  if (list->overflow) overflows++;  // Searched anyway, minus the lost moves
+  if (list->count == 0) return -WIN_SCORE + ply;  // Blocked or no pieces
+  if (first >= list->count) first = 0;
+
+  for (n = 0; n < list->count; n++) {
+    // The best move stored in the table goes first, the rest in list order
+    int i = (n == 0) ? first : (n <= first) ? n - 1 : n;
+    int score;
+
+    save(undo);
+    CHECKERS_make_move(&position, &list->moves[i]);
+    score = -search(depth - 1, ply + 1, -beta, -alpha);
+    restore(undo);
+    if (aborted) return 0;
+
+    if (score > best) {
+      best = score;
+      best_index = i;
+      if (score > alpha) {
+        alpha = score;
+        if (alpha >= beta) break;
+      }
+    }
+  }
+
+  TT_store(position.hash, depth, score_to_tt(best, ply),
+           (best <= original_alpha) ? TT_UPPER
+           : (best >= beta)         ? TT_LOWER
+                                    : TT_EXACT,
+           best_index);
+  return best;
+}
+
+bool CHECKERS_ai_best_move(const GameState* state, uint16_t time_budget_ms,
+                           Move* best_move) {
+  MoveList* root = &ply_moves[0];
+  Undo* undo = &ply_undo[0];
+  int depth;
+
+  start_ms = HAL_TIMER_get_ms();
+  budget_ms = time_budget_ms;
+  timed = true;
+  nodes = 0;
+  aborted = false;
+  overflows = 0;
+  stats.nodes = 0;
+  stats.depth = 0;
+  stats.score = 0;
+  stats.overflows = 0;
+
+  // Book positions need no search. The clock is as good a random source as
+  // any for choosing between book moves.
+  if (BOOK_probe(state, (uint16_t)start_ms, best_move)) return true;
+
+  TT_new_search();
+  position = *state;
+  CHECKERS_generate_moves(&position, root);
+  if (root->overflow) overflows++;
+  if (root->count == 0) return false;
+  *best_move = root->moves[0];
+
+  // Iterative deepening: each completed iteration replaces the best move, an
+  // iteration cut short by the time budget is discarded
+  for (depth = 1; root->count > 1 && depth <= AI_MAX_DEPTH; depth++) {
+    int alpha = -WIN_SCORE - 1;
+    int best_index = 0;
+    int i;
+
+    for (i = 0; i < root->count; i++) {
+      int score;
+
+      save(undo);
+      CHECKERS_make_move(&position, &root->moves[i]);
+      score = -search(depth - 1, 1, -WIN_SCORE - 1, -alpha);
+      restore(undo);
+      if (aborted) break;
+
+      if (score > alpha) {
+        alpha = score;
+        best_index = i;
+      }
+    }
+    if (aborted) break;
+
+    // Search the best move first in the next iteration
+    if (best_index != 0) {
+      Move move = root->moves[0];
+      root->moves[0] = root->moves[best_index];
+      root->moves[best_index] = move;
+    }
+    *best_move = root->moves[0];
+    stats.depth = depth;
+    stats.score = alpha;
+
+    // Nothing left to learn once the game is decided
+    if (alpha >= WIN_SCORE - AI_MAX_PLY || alpha <= -WIN_SCORE + AI_MAX_PLY)
+      break;
+  }
+
+  stats.nodes = nodes;
+  stats.overflows = overflows;
+  return true;
+}
+
+int16_t CHECKERS_ai_score_move(const GameState* state, const Move* move,
+                               uint8_t depth) {
+  timed = false;
+  nodes = 0;
+  aborted = false;
+  TT_new_search();
+
+  position = *state;
+  CHECKERS_make_move(&position, move);
+  return -search(depth - 1, 1, -WIN_SCORE - 1, WIN_SCORE + 1);
+}
+
+void CHECKERS_ai_get_stats(AiStats* ai_stats) { *ai_stats = stats; }
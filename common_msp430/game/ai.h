@@ -0,0 +1,29 @@
+#ifndef GAME_AI_H_
+#define GAME_AI_H_
+
+#include <game/checkers.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Deepest iteration the search will attempt
+#define AI_MAX_DEPTH 16
+
+typedef struct {
+  uint32_t nodes;  // Positions visited by the last search
+  uint8_t depth;   // Deepest completed iteration, 0 for a forced move
+  int16_t score;   // Score of the chosen move for the side to move
+  uint16_t overflows;  // Move lists that could not hold every move
+} AiStats;
+
+// Picks a move for the side to move, from the opening book if the position is
+// in it, otherwise with an iterative-deepening alpha-beta search that stops
+// after time_budget_ms. Returns false if there is no legal move.
+bool CHECKERS_ai_best_move(const GameState* state, uint16_t time_budget_ms,
+                           Move* best_move);
+void CHECKERS_ai_get_stats(AiStats* stats);
+// Scores a move from the mover's point of view with a search to a fixed depth
+// and no time limit. Meant for offline tools such as the book generator.
+int16_t CHECKERS_ai_score_move(const GameState* state, const Move* move,
+                               uint8_t depth);
+
+#endif /* GAME_AI_H_ */
@@ -0,0 +1,307 @@
+#include <game/board_view.h>
+#include <hal/hal_timer.h>
+#include <string.h>
+
+#define TILE_BYTES (2 * SQUARE_SIZE * SQUARE_SIZE)
+
+// Light squares never hold a piece; dark and last-move squares get one tile
+// per PieceType
+#define PIECE_TYPES (BLACK_KING + 1)
+#define TILE_LIGHT 0
+#define TILE_DARK(piece) (1 + (piece))
+#define TILE_LAST_MOVE(piece) (1 + PIECE_TYPES + (piece))
+#define TILE_COUNT (1 + 2 * PIECE_TYPES)
+
+// RGB565 pixels in the order the LCD takes them, so a square is one transfer.
+// Rasterized at startup; FRAM because 4.3 KB is too much for SRAM.
+#pragma PERSISTENT(tiles)
+static uint8_t tiles[TILE_COUNT][TILE_BYTES] = {0};
+
+// A tile with the sliding piece or a highlight border drawn in
+static uint8_t scratch[TILE_BYTES];
+
+// Frames the sliding piece takes to cross one square diagonally
+#define SLIDE_FRAMES_PER_SQUARE 12
+
+// A piece sliding along the squares of a move. The board already shows the
+// move applied, except that the destination is drawn empty until the piece
+// gets there.
+static struct {
+  bool active;
+  PieceType piece;
+  int8_t rows[CHECKERS_MAX_JUMPS + 1];  // The squares it passes through
+  int8_t cols[CHECKERS_MAX_JUMPS + 1];
+  uint8_t steps;     // Segments between those squares
+  uint8_t step;      // Segment the piece is on
+  uint8_t frame;     // Frames shown of that segment
+  int16_t x, y;      // Board pixel position of the piece this frame
+  uint64_t covered;  // Squares it overlaps at that position
+} slide;
+
+//*****************************************************************************
+//
+// Off-screen grlib display that draws into the tile its displayData points
+// to, so the tiles come out exactly as grlib would draw them on the LCD
+//
+//*****************************************************************************
+static void canvas_pixel_draw(void* displayData, int16_t x, int16_t y,
+                              uint16_t value) {
+  uint8_t* pixel = (uint8_t*)displayData + 2 * (y * SQUARE_SIZE + x);
+  pixel[0] = value >> 8;
+  pixel[1] = value;
+}
+
+static void canvas_pixel_draw_multiple(void* displayData, int16_t x, int16_t y,
+                                       int16_t x0, int16_t count, int16_t bpp,
+                                       const uint8_t* data,
+                                       const uint32_t* palette) {
+  // Tiles are built from rectangles and circles only
+}
+
+static void canvas_line_draw_h(void* displayData, int16_t x1, int16_t x2,
+                               int16_t y, uint16_t value) {
+  for (; x1 <= x2; x1++) canvas_pixel_draw(displayData, x1, y, value);
+}
+
+static void canvas_line_draw_v(void* displayData, int16_t x, int16_t y1,
+                               int16_t y2, uint16_t value) {
+  for (; y1 <= y2; y1++) canvas_pixel_draw(displayData, x, y1, value);
+}
+
+static void canvas_rect_fill(void* displayData, const Graphics_Rectangle* rect,
+                             uint16_t value) {
+  int16_t y;
+  for (y = rect->yMin; y <= rect->yMax; y++)
+    canvas_line_draw_h(displayData, rect->xMin, rect->xMax, y, value);
+}
+
+static void canvas_flush(void* displayData) {}
+
+static void canvas_clear(void* displayData, uint16_t value) {
+  Graphics_Rectangle rect = {0, 0, SQUARE_SIZE - 1, SQUARE_SIZE - 1};
+  canvas_rect_fill(displayData, &rect, value);
+}
+
+// The color translation is taken from the LCD driver in BOARD_VIEW_init
+static Graphics_Display canvas_display = {
+    sizeof(Graphics_Display),   0,
+    SQUARE_SIZE,                SQUARE_SIZE,
+    canvas_pixel_draw,          canvas_pixel_draw_multiple,
+    canvas_line_draw_h,         canvas_line_draw_v,
+    canvas_rect_fill,           0,
+    canvas_flush,               canvas_clear};
+static Graphics_Context canvas;
+static const Graphics_Rectangle tile_rect = {0, 0, SQUARE_SIZE - 1,
+                                             SQUARE_SIZE - 1};
+
+static void render_tile(uint8_t* tile, uint32_t background, PieceType piece) {
+  int center = SQUARE_SIZE / 2;
+
+  canvas_display.displayData = tile;
+
+  // Draw square background
+  Graphics_setForegroundColor(&canvas, background);
+  Graphics_fillRectangle(&canvas, &tile_rect);
+
+  // Draw piece
+  if (piece != EMPTY) {
+    // Set piece color
+    if (piece == RED_PIECE || piece == RED_KING) {
+      Graphics_setForegroundColor(&canvas, GRAPHICS_COLOR_RED);
+    } else {
+      Graphics_setForegroundColor(&canvas, GRAPHICS_COLOR_BLACK);
+    }
+    // Draw piece (filled circle)
+    Graphics_fillCircle(&canvas, center, center, 5);
+    // Draw king indicator (smaller circle inside)
+    if (piece == RED_KING || piece == BLACK_KING) {
+      Graphics_setForegroundColor(&canvas, GRAPHICS_COLOR_YELLOW);
+      Graphics_fillCircle(&canvas, center, center, 2);
+    }
+  }
+}
+
+void BOARD_VIEW_init(void) {
+  int piece;
+
+  canvas_display.callColorTranslate = g_sCRYSTALFONTZ.callColorTranslate;
+  Graphics_initContext(&canvas, &canvas_display);
+
+  render_tile(tiles[TILE_LIGHT], GRAPHICS_COLOR_WHITE, EMPTY);
+  for (piece = 0; piece < PIECE_TYPES; piece++) {
+    render_tile(tiles[TILE_DARK(piece)], GRAPHICS_COLOR_LIGHT_GRAY,
+                (PieceType)piece);
+    render_tile(tiles[TILE_LAST_MOVE(piece)], GRAPHICS_COLOR_YELLOW,
+                (PieceType)piece);
+  }
+}
+
+// Squares a tile-sized sprite at board pixel (x, y) overlaps, at most four
+static uint64_t squares_under(int x, int y) {
+  int row0 = y / SQUARE_SIZE, row1 = (y + SQUARE_SIZE - 1) / SQUARE_SIZE;
+  int col0 = x / SQUARE_SIZE, col1 = (x + SQUARE_SIZE - 1) / SQUARE_SIZE;
+  return CHECKERS_DIRTY_BIT(row0, col0) | CHECKERS_DIRTY_BIT(row0, col1) |
+         CHECKERS_DIRTY_BIT(row1, col0) | CHECKERS_DIRTY_BIT(row1, col1);
+}
+
+// Copies the sliding piece's pixels, those of its tile that differ from an
+// empty dark square, onto the part of tile they overlap
+static void draw_sprite(uint8_t* tile, int row, int col) {
+  const uint8_t* sprite = tiles[TILE_DARK(slide.piece)];
+  const uint8_t* empty = tiles[TILE_DARK(EMPTY)];
+  int dx = slide.x - col * SQUARE_SIZE;
+  int dy = slide.y - row * SQUARE_SIZE;
+  int x, y;
+
+  for (y = dy < 0 ? 0 : dy; y < SQUARE_SIZE && y - dy < SQUARE_SIZE; y++) {
+    for (x = dx < 0 ? 0 : dx; x < SQUARE_SIZE && x - dx < SQUARE_SIZE; x++) {
+      int from = 2 * ((y - dy) * SQUARE_SIZE + (x - dx));
+      int to = 2 * (y * SQUARE_SIZE + x);
+      if (sprite[from] != empty[from] || sprite[from + 1] != empty[from + 1]) {
+        tile[to] = sprite[from];
+        tile[to + 1] = sprite[from + 1];
+      }
+    }
+  }
+}
+
+static void draw_square(const GameState* state, int row, int col) {
+  PieceType piece = CHECKERS_piece_at(state, row, col);
+  bool under_sprite =
+      slide.active && (slide.covered & CHECKERS_DIRTY_BIT(row, col));
+  bool selected = state->selection_state == PIECE_SELECTED &&
+                  row == state->selected_row && col == state->selected_col;
+  bool hovered = row == state->hovered_row && col == state->hovered_col;
+  const uint8_t* tile;
+
+  if (slide.active && row == slide.rows[slide.steps] &&
+      col == slide.cols[slide.steps])
+    piece = EMPTY;
+
+  if (state->last_move_valid && ((row == state->last_move.from_row &&
+                                  col == state->last_move.from_col) ||
+                                 (row == state->last_move.to_row &&
+                                  col == state->last_move.to_col))) {
+    tile = tiles[TILE_LAST_MOVE(piece)];
+  } else if ((row + col) % 2 == 0) {
+    tile = tiles[TILE_LIGHT];
+  } else {
+    tile = tiles[TILE_DARK(piece)];
+  }
+
+  if (under_sprite || selected || hovered) {
+    memcpy(scratch, tile, TILE_BYTES);
+    tile = scratch;
+  }
+  if (under_sprite) draw_sprite(scratch, row, col);
+
+  // Draw highlights, the hover border covers the selection border
+  if (selected || hovered) {
+    canvas_display.displayData = scratch;
+    Graphics_setForegroundColor(
+        &canvas, hovered ? GRAPHICS_COLOR_GREEN : GRAPHICS_COLOR_BLUE);
+    Graphics_drawRectangle(&canvas, &tile_rect);
+  }
+
+  CRYSTALFONTZ_draw_tile(BOARD_OFFSET_X + col * SQUARE_SIZE,
+                         BOARD_OFFSET_Y + row * SQUARE_SIZE, SQUARE_SIZE,
+                         SQUARE_SIZE, tile);
+}
+
+// Moves the sliding piece on by a frame and marks the squares it leaves and
+// enters. Once it arrives it is drawn as part of the destination square.
+static void advance_slide(GameState* state) {
+  int row = slide.rows[slide.step], col = slide.cols[slide.step];
+  int d_row, d_col, frames;
+
+  state->dirty_squares |= slide.covered;
+  if (slide.step == slide.steps) {
+    slide.active = false;
+    state->dirty_squares |= CHECKERS_DIRTY_BIT(row, col);
+    return;
+  }
+
+  // A jump crosses two squares in twice the frames of a step
+  d_row = slide.rows[slide.step + 1] - row;
+  d_col = slide.cols[slide.step + 1] - col;
+  frames = SLIDE_FRAMES_PER_SQUARE * (d_row < 0 ? -d_row : d_row);
+  slide.x = col * SQUARE_SIZE + d_col * SQUARE_SIZE * slide.frame / frames;
+  slide.y = row * SQUARE_SIZE + d_row * SQUARE_SIZE * slide.frame / frames;
+  slide.covered = squares_under(slide.x, slide.y);
+  state->dirty_squares |= slide.covered;
+
+  if (++slide.frame == frames) {
+    slide.frame = 0;
+    slide.step++;
+  }
+}
+
+void BOARD_VIEW_slide_last_move(GameState* state) {
+  const Move* move = &state->last_move;
+  int row = move->from_row, col = move->from_col;
+  int i;
+
+  slide.rows[0] = row;
+  slide.cols[0] = col;
+  if (move->jumps == 0) {
+    slide.rows[1] = move->to_row;
+    slide.cols[1] = move->to_col;
+    slide.steps = 1;
+  } else {
+    for (i = 0; i < move->jumps; i++) {
+      int dir = (move->path >> (2 * i)) & 3;
+      row += (dir & 2) ? 2 : -2;
+      col += (dir & 1) ? 2 : -2;
+      slide.rows[i + 1] = row;
+      slide.cols[i + 1] = col;
+    }
+    slide.steps = move->jumps;
+  }
+  slide.piece = CHECKERS_piece_at(state, move->to_row, move->to_col);
+  slide.step = 0;
+  slide.frame = 0;
+  slide.covered = 0;
+  slide.active = true;
+}
+
+void BOARD_VIEW_draw(GameState* state) {
+  int row, col;
+
+  // No time for frames here, put the piece where it is going
+  if (slide.active) {
+    slide.step = slide.steps;
+    advance_slide(state);
+  }
+  for (row = 0; row < BOARD_SIZE; row++) {
+    // One byte of the bitmap per row, most rows have nothing to repaint
+    uint8_t dirty = state->dirty_squares >> (row * BOARD_SIZE);
+    for (col = 0; dirty != 0; col++, dirty >>= 1) {
+      if (dirty & 1) draw_square(state, row, col);
+    }
+  }
+  state->dirty_squares = 0;
+}
+
+bool BOARD_VIEW_draw_frame(GameState* state, uint16_t budget_ms) {
+  uint32_t start = HAL_TIMER_get_ms();
+  bool drawn = false;
+  int row, col;
+
+  if (slide.active) advance_slide(state);
+  for (row = 0; row < BOARD_SIZE; row++) {
+    uint8_t dirty = state->dirty_squares >> (row * BOARD_SIZE);
+    for (col = 0; dirty != 0; col++, dirty >>= 1) {
+      if (!(dirty & 1)) continue;
+      // Always draw one square, so even an overrun frame makes progress
+      if (drawn && HAL_TIMER_get_ms() - start >= budget_ms) return false;
+      draw_square(state, row, col);
+      state->dirty_squares &= ~CHECKERS_DIRTY_BIT(row, col);
+      drawn = true;
+    }
+  }
+  return !slide.active;
+}
+
+void BOARD_VIEW_invalidate(GameState* state) {
+  state->dirty_squares = CHECKERS_ALL_DIRTY;
+}
@@ -0,0 +1,29 @@
+#ifndef GAME_BOARD_VIEW_H_
+#define GAME_BOARD_VIEW_H_
+
+#include <drivers/crystalfontz.h>
+#include <game/checkers.h>
+#include <hal/hal_lcd.h>
+
+// Board layout on the LCD
+#define SQUARE_SIZE 14
+#define BOARD_OFFSET_X 8
+#define BOARD_OFFSET_Y 0  // Leaves 16 rows below for the move history
+
+// Rasterizes the square tiles into FRAM, call once after CRYSTALFONTZ_init
+void BOARD_VIEW_init(void);
+// Repaints the squares marked in state->dirty_squares and clears the marks
+void BOARD_VIEW_draw(GameState* state);
+// Repaints marked squares until budget_ms have passed, leaving the rest
+// marked for the next frame; at least one square is drawn per call. Returns
+// true once nothing is left to repaint and no piece is sliding.
+bool BOARD_VIEW_draw_frame(GameState* state, uint16_t budget_ms);
+// Slides the piece of state->last_move, which must just have been applied,
+// from square to square over the next BOARD_VIEW_draw_frame calls. Each
+// frame repaints only the squares the piece leaves and enters. Call before
+// the move is drawn; BOARD_VIEW_draw ends the slide at once.
+void BOARD_VIEW_slide_last_move(GameState* state);
+// Marks the whole board for repainting, e.g. after other drawing covered it
+void BOARD_VIEW_invalidate(GameState* state);
+
+#endif /* GAME_BOARD_VIEW_H_ */
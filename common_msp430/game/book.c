@@ -0,0 +1,60 @@
+#include <game/book.h>
+
+// Candidate moves for a record, kept in FRAM: a MoveList is about 670 bytes,
+// too much for the stack under CHECKERS_ai_best_move
+#pragma PERSISTENT(book_moves)
+static MoveList book_moves = {0};
+
+// Index of the first record with the given key, or opening_book_size
+static uint16_t lower_bound(uint32_t key) {
+  uint16_t low = 0;
+  uint16_t high = opening_book_size;
+
+  while (low < high) {
+    uint16_t mid = low + (high - low) / 2;
+    if (opening_book[mid].key < key)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  return low;
+}
+
+bool BOOK_probe(const GameState* state, uint16_t random, Move* move) {
+  uint16_t first = lower_bound(state->hash);
+  uint16_t last = first;
+  uint32_t total = 0;
+  uint32_t pick;
+  uint16_t packed;
+  MoveList* list = &book_moves;
+  int i;
+
+  while (last < opening_book_size && opening_book[last].key == state->hash) {
+    total += opening_book[last].weight;
+    last++;
+  }
+  if (total == 0) return false;
+
+  // Walk the candidates until the cumulative weight passes the pick
+  pick = random % total;
+  while (pick >= opening_book[first].weight) {
+    pick -= opening_book[first].weight;
+    first++;
+  }
+  packed = opening_book[first].move;
+
+  // The book only stores the two squares; the generator fills in the rest and
+  // rejects a record that does not fit the position
+  CHECKERS_generate_moves(state, list);
+  for (i = 0; i < list->count; i++) {
+    const Move* candidate = &list->moves[i];
+    if (CHECKERS_SQUARE(candidate->from_row, candidate->from_col) ==
+            BOOK_MOVE_FROM(packed) &&
+        CHECKERS_SQUARE(candidate->to_row, candidate->to_col) ==
+            BOOK_MOVE_TO(packed)) {
+      *move = *candidate;
+      return true;
+    }
+  }
+  return false;
+}
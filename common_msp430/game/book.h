@@ -0,0 +1,30 @@
+#ifndef GAME_BOOK_H_
+#define GAME_BOOK_H_
+
+#include <game/checkers.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Packed book move: origin square in bits 9..5, destination in bits 4..0
+#define BOOK_PACK_MOVE(from, to) ((uint16_t)(((from) << 5) | (to)))
+#define BOOK_MOVE_FROM(packed) ((packed) >> 5)
+#define BOOK_MOVE_TO(packed) ((packed) & 0x1F)
+
+// One candidate move for a position. The book is sorted by key, and the
+// candidates of a position are consecutive records.
+typedef struct {
+  uint32_t key;     // Zobrist key of the position
+  uint16_t move;    // BOOK_PACK_MOVE of the move
+  uint16_t weight;  // Relative probability of playing the move
+} BookEntry;
+
+// Generated by host/gen_book into book_data.c
+extern const BookEntry opening_book[];
+extern const uint16_t opening_book_size;
+
+// Picks a move for the position from the opening book, with a probability
+// proportional to its weight. random may be any value and selects among the
+// candidates. Returns false if the position is not in the book.
+bool BOOK_probe(const GameState* state, uint16_t random, Move* move);
+
+#endif /* GAME_BOOK_H_ */
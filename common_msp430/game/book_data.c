@@ -0,0 +1,2861 @@
+// Opening book generated by host/gen_book 4 10, do not edit.
+// 1078 positions, 2851 moves.
+
+#include <game/book.h>
+
+const BookEntry opening_book[] = {
+    {0x00E535BDUL, 0x0CF, 7},
+    {0x00E535BDUL, 0x0EE, 6},
+    {0x0128F0D8UL, 0x2B0, 7},
+    {0x0128F0D8UL, 0x2F2, 7},
+    {0x0128F0D8UL, 0x2B1, 3},
+    {0x0128F0D8UL, 0x336, 3},
+    {0x0128F0D8UL, 0x356, 1},
+    {0x0128F0D8UL, 0x290, 1},
+    {0x0218AA6BUL, 0x2B0, 7},
+    {0x0218AA6BUL, 0x2D2, 6},
+    {0x0218AA6BUL, 0x2F2, 3},
+    {0x0218AA6BUL, 0x2B1, 3},
+    {0x0218AA6BUL, 0x3FA, 1},
+    {0x0218AA6BUL, 0x290, 1},
+    {0x026DC682UL, 0x2F2, 7},
+    {0x026DC682UL, 0x2F3, 4},
+    {0x026DC682UL, 0x2B0, 3},
+    {0x026DC682UL, 0x336, 3},
+    {0x026DC682UL, 0x356, 2},
+    {0x026DC682UL, 0x290, 1},
+    {0x026DC682UL, 0x2B1, 1},
+    {0x028CC21BUL, 0x24E, 7},
+    {0x028CC21BUL, 0x2B0, 4},
+    {0x028CC21BUL, 0x2F3, 3},
+    {0x028CC21BUL, 0x2D1, 2},
+    {0x028CC21BUL, 0x3D9, 1},
+    {0x028CC21BUL, 0x2B1, 1},
+    {0x029185C7UL, 0x2F2, 7},
+    {0x029185C7UL, 0x2F3, 5},
+    {0x029185C7UL, 0x356, 4},
+    {0x029185C7UL, 0x2B0, 3},
+    {0x029185C7UL, 0x336, 1},
+    {0x02B8ADE4UL, 0x357, 7},
+    {0x02B8ADE4UL, 0x290, 4},
+    {0x02B8ADE4UL, 0x2B1, 3},
+    {0x02B8ADE4UL, 0x2B0, 1},
+    {0x02B8ADE4UL, 0x2D1, 1},
+    {0x02B8ADE4UL, 0x2D2, 1},
+    {0x02C0BD60UL, 0x2B0, 7},
+    {0x02C0BD60UL, 0x2F2, 7},
+    {0x02C0BD60UL, 0x2D2, 7},
+    {0x02C0BD60UL, 0x2B1, 6},
+    {0x02C0BD60UL, 0x2D1, 4},
+    {0x02C0BD60UL, 0x290, 4},
+    {0x02D8C799UL, 0x2D1, 7},
+    {0x02D8C799UL, 0x2F2, 7},
+    {0x02D8C799UL, 0x2F3, 1},
+    {0x0338E474UL, 0x111, 7},
+    {0x0338E474UL, 0x130, 7},
+    {0x03E72EE7UL, 0x357, 7},
+    {0x03E72EE7UL, 0x2B1, 5},
+    {0x03E72EE7UL, 0x2D2, 5},
+    {0x03E72EE7UL, 0x2B0, 2},
+    {0x03E72EE7UL, 0x290, 2},
+    {0x03E72EE7UL, 0x26F, 1},
+    {0x048FBF9BUL, 0x28D, 7},
+    {0x048FBF9BUL, 0x2AC, 6},
+    {0x04C87B57UL, 0x22D, 7},
+    {0x04C87B57UL, 0x22E, 7},
+    {0x04C87B57UL, 0x2B0, 2},
+    {0x04C87B57UL, 0x2F2, 2},
+    {0x04C87B57UL, 0x356, 2},
+    {0x04C87B57UL, 0x336, 2},
+    {0x04D1C9C6UL, 0x08D, 7},
+    {0x04D1C9C6UL, 0x0AC, 7},
+    {0x04D7BBEBUL, 0x2AE, 7},
+    {0x04D7BBEBUL, 0x2CD, 1},
+    {0x04DCFF9EUL, 0x356, 7},
+    {0x04DCFF9EUL, 0x336, 5},
+    {0x04DCFF9EUL, 0x377, 3},
+    {0x050773C8UL, 0x0A9, 7},
+    {0x050773C8UL, 0x10C, 4},
+    {0x050773C8UL, 0x14E, 4},
+    {0x050773C8UL, 0x0C9, 3},
+    {0x050773C8UL, 0x14F, 1},
+    {0x0541F159UL, 0x088, 7},
+    {0x0541F159UL, 0x16F, 5},
+    {0x0541F159UL, 0x0A8, 4},
+    {0x0541F159UL, 0x14E, 4},
+    {0x0541F159UL, 0x12E, 4},
+    {0x0541F159UL, 0x14F, 4},
+    {0x0541F159UL, 0x12D, 1},
+    {0x059EF5AAUL, 0x153, 7},
+    {0x059EF5AAUL, 0x172, 3},
+    {0x060E4282UL, 0x330, 7},
+    {0x060E4282UL, 0x311, 6},
+    {0x06A90F77UL, 0x2F3, 7},
+    {0x06A90F77UL, 0x2B0, 1},
+    {0x06C95FE3UL, 0x2D1, 7},
+    {0x06FA4F72UL, 0x2AC, 7},
+    {0x07569058UL, 0x2CF, 7},
+    {0x07569058UL, 0x2EE, 4},
+    {0x0796A86FUL, 0x20C, 7},
+    {0x082F3E6AUL, 0x153, 7},
+    {0x08B6B808UL, 0x14F, 7},
+    {0x08B6B808UL, 0x12D, 4},
+    {0x08B6B808UL, 0x0A8, 3},
+    {0x08B6B808UL, 0x14E, 3},
+    {0x08B6B808UL, 0x088, 3},
+    {0x08B6B808UL, 0x16F, 1},
+    {0x08B6B808UL, 0x12E, 1},
+    {0x08F03A99UL, 0x0C9, 7},
+    {0x08F03A99UL, 0x0A9, 7},
+    {0x08F03A99UL, 0x14F, 7},
+    {0x08F03A99UL, 0x10C, 4},
+    {0x08F03A99UL, 0x14E, 1},
+    {0x08F03A99UL, 0x16F, 1},
+    {0x09054092UL, 0x2AE, 7},
+    {0x09317079UL, 0x2F3, 7},
+    {0x09317079UL, 0x2B0, 3},
+    {0x09317079UL, 0x2B1, 1},
+    {0x097CD448UL, 0x2D1, 7},
+    {0x097CD448UL, 0x2B1, 6},
+    {0x097CD448UL, 0x314, 5},
+    {0x097CD448UL, 0x2B0, 3},
+    {0x097CD448UL, 0x2F2, 3},
+    {0x097CD448UL, 0x2D2, 3},
+    {0x098E6B4EUL, 0x2F2, 7},
+    {0x0A0EE8B7UL, 0x132, 7},
+    {0x0A0EE8B7UL, 0x151, 7},
+    {0x0A3C2462UL, 0x377, 7},
+    {0x0A3C2462UL, 0x357, 5},
+    {0x0A3C2462UL, 0x20D, 1},
+    {0x0A3C2462UL, 0x315, 1},
+    {0x0A57BF3DUL, 0x22E, 7},
+    {0x0A57BF3DUL, 0x22D, 4},
+    {0x0A57BF3DUL, 0x314, 4},
+    {0x0A57BF3DUL, 0x2F3, 3},
+    {0x0A57BF3DUL, 0x356, 1},
+    {0x0AD67DD4UL, 0x311, 7},
+    {0x0AD67DD4UL, 0x330, 4},
+    {0x0B55D0F4UL, 0x24B, 7},
+    {0x0C3FED91UL, 0x2AE, 7},
+    {0x0C3FED91UL, 0x2CD, 7},
+    {0x0C993B18UL, 0x2F2, 7},
+    {0x0C993B18UL, 0x356, 3},
+    {0x0C993B18UL, 0x2B1, 3},
+    {0x0C993B18UL, 0x336, 3},
+    {0x0CF2DB12UL, 0x2B0, 7},
+    {0x0CF2DB12UL, 0x2B1, 7},
+    {0x0CF2DB12UL, 0x2D1, 5},
+    {0x0CF2DB12UL, 0x3FA, 4},
+    {0x0CF2DB12UL, 0x290, 3},
+    {0x0DE0AD07UL, 0x14F, 7},
+    {0x0DE0AD07UL, 0x16F, 6},
+    {0x0DE0AD07UL, 0x12E, 6},
+    {0x0DE0AD07UL, 0x14E, 5},
+    {0x0DE0AD07UL, 0x0A8, 4},
+    {0x0DE0AD07UL, 0x088, 3},
+    {0x0DE19132UL, 0x22A, 7},
+    {0x0DE19132UL, 0x249, 3},
+    {0x0E2DBC18UL, 0x20D, 7},
+    {0x0E2DBC18UL, 0x2B1, 6},
+    {0x0E2DBC18UL, 0x2D1, 4},
+    {0x0E2DBC18UL, 0x357, 3},
+    {0x0E2DBC18UL, 0x314, 2},
+    {0x0E2DBC18UL, 0x377, 2},
+    {0x0F37F431UL, 0x2D2, 7},
+    {0x0F37F431UL, 0x2F2, 4},
+    {0x0F37F431UL, 0x2F3, 4},
+    {0x0F3D09DBUL, 0x2F3, 7},
+    {0x0F3D09DBUL, 0x3B9, 5},
+    {0x0F3D09DBUL, 0x2B1, 3},
+    {0x0F3D09DBUL, 0x2B0, 1},
+    {0x0F3D09DBUL, 0x3D9, 1},
+    {0x0F3F11B1UL, 0x356, 7},
+    {0x0F3F11B1UL, 0x2F3, 6},
+    {0x0F3F11B1UL, 0x2B0, 4},
+    {0x0F3F11B1UL, 0x2B1, 2},
+    {0x0FA961ABUL, 0x2D1, 7},
+    {0x102F0A38UL, 0x20C, 7},
+    {0x102F0A38UL, 0x2D1, 1},
+    {0x102F0A38UL, 0x2F2, 1},
+    {0x102F0A38UL, 0x2D2, 1},
+    {0x10569EE2UL, 0x2CD, 7},
+    {0x106286FFUL, 0x12D, 7},
+    {0x106286FFUL, 0x088, 7},
+    {0x106286FFUL, 0x0A8, 4},
+    {0x106286FFUL, 0x16F, 4},
+    {0x106286FFUL, 0x14F, 4},
+    {0x10E8DC1DUL, 0x10C, 7},
+    {0x10E8DC1DUL, 0x14F, 6},
+    {0x10E8DC1DUL, 0x0C9, 5},
+    {0x10E8DC1DUL, 0x0A9, 4},
+    {0x10E8DC1DUL, 0x14E, 2},
+    {0x11833B1AUL, 0x20C, 7},
+    {0x11833B1AUL, 0x2D2, 3},
+    {0x11833B1AUL, 0x2F3, 2},
+    {0x11E54E8EUL, 0x2D1, 7},
+    {0x11E54E8EUL, 0x290, 6},
+    {0x11E54E8EUL, 0x2B1, 3},
+    {0x11E54E8EUL, 0x2B0, 1},
+    {0x11E86043UL, 0x353, 7},
+    {0x1231618EUL, 0x22D, 7},
+    {0x1231618EUL, 0x20C, 4},
+    {0x125B96C1UL, 0x22E, 7},
+    {0x125B96C1UL, 0x314, 1},
+    {0x125B96C1UL, 0x356, 1},
+    {0x13371708UL, 0x20C, 7},
+    {0x13371708UL, 0x314, 2},
+    {0x133BB019UL, 0x314, 7},
+    {0x133BB019UL, 0x24E, 6},
+    {0x13D6B061UL, 0x2AC, 7},
+    {0x1426E5E5UL, 0x2B1, 7},
+    {0x1426E5E5UL, 0x2B0, 5},
+    {0x1426E5E5UL, 0x2D1, 5},
+    {0x1426E5E5UL, 0x290, 2},
+    {0x1426E5E5UL, 0x3FB, 2},
+    {0x14B37377UL, 0x1B1, 7},
+    {0x14B37377UL, 0x1B0, 4},
+    {0x14B37377UL, 0x0A8, 2},
+    {0x14EBD366UL, 0x2CD, 7},
+    {0x155243AEUL, 0x14E, 7},
+    {0x155243AEUL, 0x0EB, 3},
+    {0x155243AEUL, 0x10C, 1},
+    {0x159C5869UL, 0x1B4, 7},
+    {0x15F7C336UL, 0x16F, 7},
+    {0x15F7C336UL, 0x0A9, 4},
+    {0x15F7C336UL, 0x14F, 4},
+    {0x15F7C336UL, 0x1B1, 4},
+    {0x15F7C336UL, 0x14E, 3},
+    {0x15F7C336UL, 0x10C, 1},
+    {0x163FF2B3UL, 0x2CF, 7},
+    {0x163FF2B3UL, 0x2EE, 7},
+    {0x16A91FCDUL, 0x2F2, 7},
+    {0x16A91FCDUL, 0x335, 2},
+    {0x16A91FCDUL, 0x2D2, 1},
+    {0x16A91FCDUL, 0x2F3, 1},
+    {0x16A91FCDUL, 0x315, 1},
+    {0x1727B347UL, 0x1F3, 7},
+    {0x1727B347UL, 0x0EB, 6},
+    {0x1727B347UL, 0x10C, 2},
+    {0x1727B347UL, 0x12D, 2},
+    {0x172F12B5UL, 0x22E, 7},
+    {0x173BDDCDUL, 0x22D, 7},
+    {0x173BDDCDUL, 0x2F3, 5},
+    {0x173BDDCDUL, 0x2F2, 1},
+    {0x173BDDCDUL, 0x2D2, 1},
+    {0x177D5F5CUL, 0x2D1, 7},
+    {0x17DB6557UL, 0x351, 7},
+    {0x17DB6557UL, 0x332, 4},
+    {0x17EF3041UL, 0x332, 7},
+    {0x17EF3041UL, 0x351, 1},
+    {0x1815B6A3UL, 0x22E, 7},
+    {0x1815B6A3UL, 0x2F2, 5},
+    {0x1815B6A3UL, 0x2D2, 5},
+    {0x182D93A9UL, 0x12D, 7},
+    {0x182D93A9UL, 0x14E, 7},
+    {0x182D93A9UL, 0x088, 7},
+    {0x182D93A9UL, 0x0A8, 6},
+    {0x182D93A9UL, 0x16F, 5},
+    {0x182D93A9UL, 0x12E, 3},
+    {0x182D93A9UL, 0x14F, 1},
+    {0x18384206UL, 0x2F3, 7},
+    {0x18384206UL, 0x2B0, 4},
+    {0x18384206UL, 0x2F2, 1},
+    {0x190D18F4UL, 0x20C, 7},
+    {0x190D18F4UL, 0x2D1, 5},
+    {0x190D18F4UL, 0x2F2, 4},
+    {0x190D18F4UL, 0x2F3, 1},
+    {0x192FFC60UL, 0x1B1, 7},
+    {0x192FFC60UL, 0x10C, 5},
+    {0x192FFC60UL, 0x14E, 5},
+    {0x192FFC60UL, 0x0A9, 5},
+    {0x192FFC60UL, 0x14F, 3},
+    {0x1A148397UL, 0x2F2, 7},
+    {0x1A148397UL, 0x2B0, 6},
+    {0x1A148397UL, 0x2D2, 5},
+    {0x1A148397UL, 0x290, 4},
+    {0x1A148397UL, 0x2B1, 4},
+    {0x1A148397UL, 0x2D1, 1},
+    {0x1A4DB2EFUL, 0x377, 7},
+    {0x1A4DB2EFUL, 0x336, 3},
+    {0x1A4DB2EFUL, 0x357, 3},
+    {0x1A4DB2EFUL, 0x356, 1},
+    {0x1A8A160DUL, 0x2D2, 7},
+    {0x1A8A160DUL, 0x2F2, 5},
+    {0x1A8A160DUL, 0x2F3, 5},
+    {0x1A8A160DUL, 0x2B0, 2},
+    {0x1AA311A4UL, 0x2B1, 7},
+    {0x1AA311A4UL, 0x314, 5},
+    {0x1AA311A4UL, 0x377, 5},
+    {0x1AA311A4UL, 0x24F, 2},
+    {0x1AA311A4UL, 0x357, 1},
+    {0x1ACC949CUL, 0x2B0, 7},
+    {0x1ACC949CUL, 0x2F2, 7},
+    {0x1ACC949CUL, 0x2B1, 4},
+    {0x1ACC949CUL, 0x290, 1},
+    {0x1AEE3F0EUL, 0x2F3, 7},
+    {0x1AEE3F0EUL, 0x336, 7},
+    {0x1AEE3F0EUL, 0x2F2, 6},
+    {0x1AEE3F0EUL, 0x2B0, 5},
+    {0x1AEE3F0EUL, 0x2B1, 5},
+    {0x1AEE3F0EUL, 0x290, 4},
+    {0x1B18D40DUL, 0x22D, 7},
+    {0x1B18D40DUL, 0x22E, 7},
+    {0x1B18D40DUL, 0x2F2, 5},
+    {0x1B18D40DUL, 0x290, 5},
+    {0x1B18D40DUL, 0x2F3, 5},
+    {0x1B18D40DUL, 0x315, 3},
+    {0x1B18D40DUL, 0x335, 2},
+    {0x1B18D40DUL, 0x2D2, 2},
+    {0x1BF447DAUL, 0x1D1, 7},
+    {0x1BF447DAUL, 0x1D2, 7},
+    {0x1BF447DAUL, 0x12D, 4},
+    {0x1BF447DAUL, 0x10D, 3},
+    {0x1BF447DAUL, 0x0EA, 2},
+    {0x1BF447DAUL, 0x0CA, 2},
+    {0x1C1B259EUL, 0x2EE, 7},
+    {0x1C829CA3UL, 0x24E, 7},
+    {0x1C829CA3UL, 0x24F, 6},
+    {0x1C829CA3UL, 0x20D, 4},
+    {0x1C829CA3UL, 0x314, 3},
+    {0x1C829CA3UL, 0x20C, 2},
+    {0x1CCEB39FUL, 0x20C, 7},
+    {0x1CCEB39FUL, 0x2D2, 5},
+    {0x1D5917DDUL, 0x14E, 7},
+    {0x1D5917DDUL, 0x12D, 6},
+    {0x1D5917DDUL, 0x0A8, 4},
+    {0x1D5917DDUL, 0x12E, 4},
+    {0x1D5917DDUL, 0x14F, 2},
+    {0x1D7FB7C0UL, 0x111, 7},
+    {0x1D7FB7C0UL, 0x130, 4},
+    {0x1DD34D3FUL, 0x10C, 7},
+    {0x1DD34D3FUL, 0x0A9, 7},
+    {0x1DD34D3FUL, 0x14F, 6},
+    {0x1DDDBDAFUL, 0x151, 7},
+    {0x1DDDBDAFUL, 0x132, 4},
+    {0x1DFBE96DUL, 0x2B0, 7},
+    {0x1DFBE96DUL, 0x2F2, 7},
+    {0x1DFBE96DUL, 0x2D2, 7},
+    {0x1DFBE96DUL, 0x2F3, 6},
+    {0x1E054E28UL, 0x2CF, 7},
+    {0x1E054E28UL, 0x2EE, 6},
+    {0x1E953AF7UL, 0x10D, 7},
+    {0x1EAAE58FUL, 0x22D, 7},
+    {0x1EAAE58FUL, 0x315, 5},
+    {0x1EAAE58FUL, 0x2F2, 2},
+    {0x1EAAE58FUL, 0x335, 2},
+    {0x1EAAE58FUL, 0x2D2, 2},
+    {0x1EAAE58FUL, 0x2F3, 2},
+    {0x1EC5761FUL, 0x314, 7},
+    {0x1EC5761FUL, 0x2D1, 4},
+    {0x1EC5761FUL, 0x2F3, 4},
+    {0x1EC5761FUL, 0x2B1, 2},
+    {0x1EFEA1A8UL, 0x12D, 7},
+    {0x1EFEA1A8UL, 0x10D, 7},
+    {0x1EFEA1A8UL, 0x12E, 6},
+    {0x1EFEA1A8UL, 0x1F3, 6},
+    {0x1EFEA1A8UL, 0x10C, 5},
+    {0x1EFEA1A8UL, 0x0CA, 4},
+    {0x1EFEA1A8UL, 0x0EA, 2},
+    {0x1F8E1984UL, 0x377, 7},
+    {0x1F8E1984UL, 0x336, 2},
+    {0x1F8E1984UL, 0x356, 1},
+    {0x1F8E1984UL, 0x357, 1},
+    {0x1F9A8193UL, 0x2F3, 7},
+    {0x1F9A8193UL, 0x2D2, 6},
+    {0x1F9A8193UL, 0x20C, 2},
+    {0x1F9A8193UL, 0x2F2, 1},
+    {0x1FE38F4FUL, 0x377, 7},
+    {0x1FE38F4FUL, 0x314, 6},
+    {0x1FE38F4FUL, 0x357, 6},
+    {0x20728166UL, 0x357, 7},
+    {0x20728166UL, 0x290, 6},
+    {0x20728166UL, 0x336, 5},
+    {0x20728166UL, 0x2B0, 1},
+    {0x20728166UL, 0x356, 1},
+    {0x20739252UL, 0x111, 7},
+    {0x20739252UL, 0x130, 7},
+    {0x208CD1D0UL, 0x2F3, 7},
+    {0x208CD1D0UL, 0x2B1, 1},
+    {0x20C5DBF4UL, 0x290, 7},
+    {0x20C5DBF4UL, 0x2F2, 6},
+    {0x20C5DBF4UL, 0x2B0, 1},
+    {0x20C5DBF4UL, 0x3B9, 1},
+    {0x20D9B57EUL, 0x0EA, 7},
+    {0x20D9B57EUL, 0x10C, 4},
+    {0x20D9B57EUL, 0x12D, 4},
+    {0x20D9B57EUL, 0x0CA, 4},
+    {0x20D9B57EUL, 0x10D, 4},
+    {0x20D9B57EUL, 0x1F3, 4},
+    {0x20D9B57EUL, 0x1F2, 3},
+    {0x2193B1BFUL, 0x2D1, 7},
+    {0x2193B1BFUL, 0x2B1, 7},
+    {0x2193B1BFUL, 0x2F2, 5},
+    {0x2193B1BFUL, 0x2F3, 1},
+    {0x21AF00C6UL, 0x2B0, 7},
+    {0x21AF00C6UL, 0x2F2, 7},
+    {0x21AF00C6UL, 0x2D2, 6},
+    {0x21AF00C6UL, 0x3B8, 1},
+    {0x21AF00C6UL, 0x2F3, 1},
+    {0x21AF00C6UL, 0x398, 1},
+    {0x21ECEF8CUL, 0x10C, 7},
+    {0x21ECEF8CUL, 0x1D2, 5},
+    {0x21ECEF8CUL, 0x10D, 4},
+    {0x21ECEF8CUL, 0x0EA, 3},
+    {0x21ECEF8CUL, 0x1D1, 1},
+    {0x21F08106UL, 0x3B8, 7},
+    {0x21F08106UL, 0x2F2, 6},
+    {0x21F08106UL, 0x2F3, 6},
+    {0x21F08106UL, 0x2D1, 3},
+    {0x21F08106UL, 0x2D2, 3},
+    {0x21F08106UL, 0x20D, 2},
+    {0x2207718FUL, 0x2F2, 7},
+    {0x22494193UL, 0x10C, 7},
+    {0x22494193UL, 0x12D, 4},
+    {0x22494193UL, 0x12E, 4},
+    {0x22494193UL, 0x14F, 4},
+    {0x230A093DUL, 0x2F3, 7},
+    {0x230A093DUL, 0x2B0, 6},
+    {0x230A093DUL, 0x3FA, 3},
+    {0x230A093DUL, 0x2D2, 3},
+    {0x2332A4F2UL, 0x372, 7},
+    {0x2332A4F2UL, 0x353, 5},
+    {0x2333533AUL, 0x2B0, 7},
+    {0x2333533AUL, 0x2B1, 6},
+    {0x2333533AUL, 0x2F3, 6},
+    {0x2333533AUL, 0x24E, 5},
+    {0x2333533AUL, 0x356, 3},
+    {0x2333533AUL, 0x336, 3},
+    {0x24088243UL, 0x2B0, 7},
+    {0x24088243UL, 0x2D1, 7},
+    {0x24088243UL, 0x2F3, 7},
+    {0x24088243UL, 0x2F2, 4},
+    {0x24088243UL, 0x290, 4},
+    {0x24088243UL, 0x2B1, 4},
+    {0x24088243UL, 0x2D2, 4},
+    {0x241DE67EUL, 0x2CF, 7},
+    {0x241DE67EUL, 0x2EE, 3},
+    {0x24FA5CB9UL, 0x2AC, 7},
+    {0x24FA5CB9UL, 0x28D, 3},
+    {0x25424437UL, 0x2B0, 7},
+    {0x25424437UL, 0x2D2, 7},
+    {0x25424437UL, 0x3FA, 4},
+    {0x25424437UL, 0x2D1, 1},
+    {0x25424437UL, 0x290, 1},
+    {0x256176D5UL, 0x356, 7},
+    {0x256176D5UL, 0x2B1, 6},
+    {0x256176D5UL, 0x2B0, 4},
+    {0x256176D5UL, 0x377, 4},
+    {0x256176D5UL, 0x336, 3},
+    {0x256176D5UL, 0x357, 2},
+    {0x258229C5UL, 0x2D1, 7},
+    {0x2714863CUL, 0x2F3, 7},
+    {0x2714863CUL, 0x2B0, 6},
+    {0x2714863CUL, 0x3B9, 6},
+    {0x2714863CUL, 0x24E, 5},
+    {0x2714863CUL, 0x3D9, 5},
+    {0x2714863CUL, 0x2D1, 3},
+    {0x27D10C01UL, 0x20C, 7},
+    {0x27D10C01UL, 0x2D2, 5},
+    {0x27D10C01UL, 0x2D1, 4},
+    {0x27D10C01UL, 0x2F2, 3},
+    {0x27D10C01UL, 0x2B1, 1},
+    {0x27E8962EUL, 0x2B0, 7},
+    {0x27E8962EUL, 0x377, 7},
+    {0x27E8962EUL, 0x2D2, 4},
+    {0x27E8962EUL, 0x357, 4},
+    {0x27E8962EUL, 0x2D1, 1},
+    {0x27E8962EUL, 0x2B1, 1},
+    {0x286487AAUL, 0x2D1, 7},
+    {0x286487AAUL, 0x20C, 4},
+    {0x286487AAUL, 0x2F3, 4},
+    {0x286487AAUL, 0x2D2, 3},
+    {0x29029D5DUL, 0x2AC, 7},
+    {0x290E5C98UL, 0x2F2, 7},
+    {0x290E5C98UL, 0x20C, 4},
+    {0x290E5C98UL, 0x2F3, 4},
+    {0x290E5C98UL, 0x2B1, 1},
+    {0x290E5C98UL, 0x2D2, 1},
+    {0x2918D77CUL, 0x2B1, 7},
+    {0x2918D77CUL, 0x2B0, 2},
+    {0x2918D77CUL, 0x2D1, 2},
+    {0x2918D77CUL, 0x290, 2},
+    {0x291CC91BUL, 0x22D, 7},
+    {0x291CC91BUL, 0x315, 5},
+    {0x291CC91BUL, 0x20D, 4},
+    {0x291CC91BUL, 0x356, 2},
+    {0x291CC91BUL, 0x335, 1},
+    {0x29775244UL, 0x314, 7},
+    {0x29775244UL, 0x377, 7},
+    {0x29775244UL, 0x2D1, 6},
+    {0x29775244UL, 0x357, 5},
+    {0x29775244UL, 0x2D2, 4},
+    {0x29775244UL, 0x2B1, 1},
+    {0x29FB4811UL, 0x2CF, 7},
+    {0x29FB4811UL, 0x2EE, 7},
+    {0x2A37A26EUL, 0x335, 7},
+    {0x2A37A26EUL, 0x2D1, 4},
+    {0x2A37A26EUL, 0x315, 3},
+    {0x2A37A26EUL, 0x2F2, 1},
+    {0x2A37A26EUL, 0x290, 1},
+    {0x2A37A26EUL, 0x2D2, 1},
+    {0x2AB80A20UL, 0x2B0, 7},
+    {0x2AB80A20UL, 0x336, 6},
+    {0x2AB80A20UL, 0x2F2, 5},
+    {0x2AB80A20UL, 0x290, 5},
+    {0x2AB80A20UL, 0x356, 3},
+    {0x2AB80A20UL, 0x2B1, 3},
+    {0x2AB80A20UL, 0x2F3, 3},
+    {0x2AC51D68UL, 0x2F2, 7},
+    {0x2B242DB1UL, 0x228, 7},
+    {0x2B242DB1UL, 0x22A, 3},
+    {0x2B30A978UL, 0x24E, 7},
+    {0x2B30A978UL, 0x356, 2},
+    {0x2B30A978UL, 0x2B1, 2},
+    {0x2B30A978UL, 0x2F3, 2},
+    {0x2B30A978UL, 0x336, 2},
+    {0x2B30A978UL, 0x2B0, 1},
+    {0x2B776DB4UL, 0x28D, 7},
+    {0x2B776DB4UL, 0x2AC, 7},
+    {0x2C584997UL, 0x2B0, 7},
+    {0x2C584997UL, 0x2F2, 7},
+    {0x2C584997UL, 0x2D2, 7},
+    {0x2C584997UL, 0x290, 5},
+    {0x2C584997UL, 0x2D1, 1},
+    {0x2C584997UL, 0x2B1, 1},
+    {0x2D0D5161UL, 0x356, 7},
+    {0x2D0D5161UL, 0x336, 5},
+    {0x2D0D5161UL, 0x314, 4},
+    {0x2D0D5161UL, 0x22D, 3},
+    {0x2D0D5161UL, 0x2F2, 1},
+    {0x2D0D5161UL, 0x2F3, 1},
+    {0x2D498D20UL, 0x2CF, 7},
+    {0x2D66CA3EUL, 0x377, 7},
+    {0x2D66CA3EUL, 0x357, 3},
+    {0x2D66CA3EUL, 0x20D, 1},
+    {0x2D66CA3EUL, 0x2D2, 1},
+    {0x2D741034UL, 0x22E, 7},
+    {0x2D741034UL, 0x2F2, 3},
+    {0x2D741034UL, 0x2F3, 3},
+    {0x2D741034UL, 0x2D2, 2},
+    {0x2E3FFE5AUL, 0x2AE, 7},
+    {0x2E3FFE5AUL, 0x2CD, 7},
+    {0x2E4781B8UL, 0x3FA, 7},
+    {0x2E4781B8UL, 0x2B0, 5},
+    {0x2E4781B8UL, 0x2F3, 5},
+    {0x2EB4EF6FUL, 0x377, 7},
+    {0x2EB4EF6FUL, 0x2D2, 4},
+    {0x2EB4EF6FUL, 0x357, 4},
+    {0x2EB4EF6FUL, 0x2D1, 3},
+    {0x2EB4EF6FUL, 0x2B0, 1},
+    {0x2EB4EF6FUL, 0x2B1, 1},
+    {0x2F395A7BUL, 0x2B0, 7},
+    {0x2F395A7BUL, 0x2D1, 5},
+    {0x2F395A7BUL, 0x2B1, 4},
+    {0x2F395A7BUL, 0x3FB, 2},
+    {0x2F73B23DUL, 0x28D, 7},
+    {0x2F73B23DUL, 0x2AC, 6},
+    {0x2FCEFDC6UL, 0x10D, 7},
+    {0x2FCEFDC6UL, 0x10C, 4},
+    {0x2FCEFDC6UL, 0x12D, 3},
+    {0x2FCEFDC6UL, 0x14F, 2},
+    {0x2FCEFDC6UL, 0x14E, 1},
+    {0x2FCEFDC6UL, 0x12E, 1},
+    {0x2FEB6C6CUL, 0x377, 7},
+    {0x2FEB6C6CUL, 0x357, 7},
+    {0x2FEB6C6CUL, 0x2B0, 4},
+    {0x2FEB6C6CUL, 0x2D1, 4},
+    {0x2FEB6C6CUL, 0x2B1, 4},
+    {0x2FEB6C6CUL, 0x2D2, 4},
+    {0x30613391UL, 0x22D, 7},
+    {0x30613391UL, 0x2F2, 7},
+    {0x30613391UL, 0x290, 6},
+    {0x30613391UL, 0x2F3, 2},
+    {0x307C612EUL, 0x2D1, 7},
+    {0x307C612EUL, 0x20C, 2},
+    {0x307C612EUL, 0x377, 1},
+    {0x307D5D1BUL, 0x0A9, 7},
+    {0x307D5D1BUL, 0x14F, 6},
+    {0x307D5D1BUL, 0x0C9, 5},
+    {0x307D5D1BUL, 0x10C, 4},
+    {0x307D5D1BUL, 0x10D, 4},
+    {0x313CF2FFUL, 0x315, 7},
+    {0x313CF2FFUL, 0x2F2, 5},
+    {0x313CF2FFUL, 0x2F3, 5},
+    {0x313CF2FFUL, 0x2D2, 2},
+    {0x313CF2FFUL, 0x2D1, 1},
+    {0x317B7BB8UL, 0x314, 7},
+    {0x317B7BB8UL, 0x377, 7},
+    {0x317B7BB8UL, 0x357, 7},
+    {0x317B7BB8UL, 0x2D1, 1},
+    {0x31CCE98BUL, 0x2F3, 7},
+    {0x31CCE98BUL, 0x2B1, 2},
+    {0x32033B42UL, 0x2F3, 7},
+    {0x32033B42UL, 0x2D1, 4},
+    {0x32033B42UL, 0x2B1, 4},
+    {0x32033B42UL, 0x2B0, 3},
+    {0x32033B42UL, 0x290, 3},
+    {0x3208ADF2UL, 0x14F, 7},
+    {0x3208ADF2UL, 0x10D, 2},
+    {0x32A31665UL, 0x353, 7},
+    {0x32A31665UL, 0x372, 4},
+    {0x32CC6205UL, 0x290, 7},
+    {0x32CC6205UL, 0x2B0, 6},
+    {0x32CC6205UL, 0x2D1, 6},
+    {0x32CC6205UL, 0x2B1, 4},
+    {0x32CC6205UL, 0x357, 4},
+    {0x3396C318UL, 0x2F2, 7},
+    {0x3459AC42UL, 0x249, 7},
+    {0x3459AC42UL, 0x209, 3},
+    {0x348C7760UL, 0x2B0, 7},
+    {0x348C7760UL, 0x2F2, 7},
+    {0x348C7760UL, 0x290, 4},
+    {0x348C7760UL, 0x2D2, 3},
+    {0x348C7760UL, 0x2D1, 1},
+    {0x34901371UL, 0x351, 7},
+    {0x34A44667UL, 0x351, 7},
+    {0x34A44667UL, 0x332, 5},
+    {0x35637E05UL, 0x26A, 7},
+    {0x35637E05UL, 0x228, 4},
+    {0x359DB3D7UL, 0x2EE, 7},
+    {0x37C09029UL, 0x2F3, 7},
+    {0x37C09029UL, 0x2B0, 2},
+    {0x37D54186UL, 0x12E, 7},
+    {0x37ED648CUL, 0x2B1, 7},
+    {0x37ED648CUL, 0x24E, 6},
+    {0x37ED648CUL, 0x2B0, 4},
+    {0x37ED648CUL, 0x2D1, 4},
+    {0x37ED648CUL, 0x24F, 2},
+    {0x37F80551UL, 0x1B0, 7},
+    {0x37F80551UL, 0x0A8, 4},
+    {0x37F80551UL, 0x1B1, 3},
+    {0x37F80551UL, 0x14E, 1},
+    {0x37F80551UL, 0x12E, 1},
+    {0x3858EF27UL, 0x24E, 7},
+    {0x3858EF27UL, 0x2F3, 6},
+    {0x3858EF27UL, 0x2B1, 4},
+    {0x3858EF27UL, 0x2B0, 2},
+    {0x386AFA86UL, 0x2EE, 7},
+    {0x386AFA86UL, 0x2CF, 4},
+    {0x38BF31FCUL, 0x1D2, 7},
+    {0x38BF31FCUL, 0x10D, 3},
+    {0x38BF31FCUL, 0x12D, 2},
+    {0x38BF31FCUL, 0x0CA, 2},
+    {0x38BF31FCUL, 0x0EA, 1},
+    {0x38C153FAUL, 0x0EA, 7},
+    {0x38C153FAUL, 0x12D, 5},
+    {0x38C153FAUL, 0x0CA, 5},
+    {0x38C153FAUL, 0x10D, 4},
+    {0x38C153FAUL, 0x1F3, 4},
+    {0x38C153FAUL, 0x12E, 3},
+    {0x38C153FAUL, 0x10C, 2},
+    {0x39B7E642UL, 0x377, 7},
+    {0x39B7E642UL, 0x315, 7},
+    {0x39B7E642UL, 0x22D, 3},
+    {0x39B7E642UL, 0x335, 3},
+    {0x3B0D7ED0UL, 0x088, 7},
+    {0x3B0D7ED0UL, 0x14F, 3},
+    {0x3B0D7ED0UL, 0x0A8, 2},
+    {0x3B0D7ED0UL, 0x16F, 2},
+    {0x3B0D7ED0UL, 0x14E, 1},
+    {0x3B26676DUL, 0x2F2, 7},
+    {0x3B26676DUL, 0x315, 7},
+    {0x3B26676DUL, 0x2D1, 1},
+    {0x3B26676DUL, 0x335, 1},
+    {0x3B26676DUL, 0x2D2, 1},
+    {0x3B26676DUL, 0x2F3, 1},
+    {0x3C2E624EUL, 0x2AC, 7},
+    {0x3CC36236UL, 0x22D, 7},
+    {0x3CC36236UL, 0x22E, 7},
+    {0x3CC36236UL, 0x314, 6},
+    {0x3D8E0039UL, 0x315, 7},
+    {0x3D8E0039UL, 0x335, 6},
+    {0x3D8E0039UL, 0x2D1, 4},
+    {0x3D8E0039UL, 0x2F3, 4},
+    {0x3D967AC0UL, 0x2B0, 7},
+    {0x3D967AC0UL, 0x2D2, 1},
+    {0x3DA344EEUL, 0x24E, 7},
+    {0x3DA344EEUL, 0x314, 3},
+    {0x3DB5D78EUL, 0x10D, 7},
+    {0x3DDE4CD1UL, 0x10D, 7},
+    {0x3E80902AUL, 0x22E, 7},
+    {0x3E80902AUL, 0x2D2, 3},
+    {0x3E80902AUL, 0x2F2, 1},
+    {0x3E80902AUL, 0x335, 1},
+    {0x3E80902AUL, 0x2F3, 1},
+    {0x3E80902AUL, 0x315, 1},
+    {0x3F08A461UL, 0x332, 7},
+    {0x3F08A461UL, 0x351, 4},
+    {0x3FC9EA85UL, 0x24E, 7},
+    {0x3FC9EA85UL, 0x20D, 6},
+    {0x3FC9EA85UL, 0x315, 3},
+    {0x3FC9EA85UL, 0x20C, 2},
+    {0x3FC9EA85UL, 0x2D1, 2},
+    {0x3FC9EA85UL, 0x335, 2},
+    {0x3FC9EA85UL, 0x24F, 2},
+    {0x3FC9EA85UL, 0x357, 2},
+    {0x3FC9EA85UL, 0x377, 1},
+    {0x400B1F2BUL, 0x088, 7},
+    {0x400B1F2BUL, 0x12D, 5},
+    {0x400B1F2BUL, 0x0A8, 4},
+    {0x400B1F2BUL, 0x12E, 4},
+    {0x400B1F2BUL, 0x14F, 4},
+    {0x400B1F2BUL, 0x14E, 1},
+    {0x40338DA4UL, 0x111, 7},
+    {0x413BBD35UL, 0x332, 7},
+    {0x413BBD35UL, 0x351, 7},
+    {0x41571FFAUL, 0x2CF, 7},
+    {0x41571FFAUL, 0x2EE, 7},
+    {0x41CEA6C7UL, 0x24E, 7},
+    {0x41CEA6C7UL, 0x20D, 7},
+    {0x41CEA6C7UL, 0x20C, 5},
+    {0x41CEA6C7UL, 0x314, 5},
+    {0x41CEA6C7UL, 0x24F, 5},
+    {0x427EEFC2UL, 0x14F, 7},
+    {0x427EEFC2UL, 0x0A8, 4},
+    {0x427EEFC2UL, 0x12D, 4},
+    {0x427EEFC2UL, 0x088, 4},
+    {0x427EEFC2UL, 0x12E, 4},
+    {0x42D6BBF7UL, 0x20C, 7},
+    {0x42D6BBF7UL, 0x2F3, 7},
+    {0x42D6BBF7UL, 0x2D2, 6},
+    {0x42D6BBF7UL, 0x3D9, 3},
+    {0x42D6BBF7UL, 0x2B1, 3},
+    {0x42D6BBF7UL, 0x2D1, 2},
+    {0x42D6BBF7UL, 0x2F2, 1},
+    {0x42D787C2UL, 0x1D7, 7},
+    {0x42D787C2UL, 0x1D5, 6},
+    {0x4349744CUL, 0x2CF, 7},
+    {0x4349744CUL, 0x2EE, 4},
+    {0x43B0A100UL, 0x2AC, 7},
+    {0x43B0A100UL, 0x28D, 5},
+    {0x43B29BCCUL, 0x12D, 7},
+    {0x43B29BCCUL, 0x10C, 1},
+    {0x43B29BCCUL, 0x10D, 1},
+    {0x43B685ABUL, 0x16F, 7},
+    {0x43B685ABUL, 0x1D1, 7},
+    {0x43B685ABUL, 0x0EA, 6},
+    {0x43B685ABUL, 0x10C, 5},
+    {0x43B685ABUL, 0x12D, 4},
+    {0x43B685ABUL, 0x0CA, 4},
+    {0x43B685ABUL, 0x10D, 4},
+    {0x43BC60C5UL, 0x20C, 7},
+    {0x43D90093UL, 0x10C, 7},
+    {0x43D90093UL, 0x12E, 4},
+    {0x43D90093UL, 0x12D, 1},
+    {0x43D90093UL, 0x14E, 1},
+    {0x442306EAUL, 0x22A, 7},
+    {0x442306EAUL, 0x26A, 3},
+    {0x44964412UL, 0x2F3, 7},
+    {0x44964412UL, 0x2F2, 4},
+    {0x44964412UL, 0x315, 4},
+    {0x44964412UL, 0x22D, 3},
+    {0x44964412UL, 0x335, 1},
+    {0x44964412UL, 0x290, 1},
+    {0x44964412UL, 0x2D2, 1},
+    {0x45420483UL, 0x2B1, 7},
+    {0x45420483UL, 0x2B0, 5},
+    {0x45420483UL, 0x290, 2},
+    {0x45420483UL, 0x2D2, 2},
+    {0x4556D884UL, 0x2B0, 7},
+    {0x4556D884UL, 0x377, 7},
+    {0x4556D884UL, 0x2B1, 7},
+    {0x4556D884UL, 0x357, 5},
+    {0x4556D884UL, 0x2D1, 4},
+    {0x45598CC7UL, 0x2D2, 7},
+    {0x45598CC7UL, 0x2F2, 5},
+    {0x4560AF11UL, 0x2B0, 7},
+    {0x4560AF11UL, 0x2F2, 7},
+    {0x4560AF11UL, 0x356, 7},
+    {0x4560AF11UL, 0x2F3, 7},
+    {0x4560AF11UL, 0x336, 7},
+    {0x4560AF11UL, 0x2B1, 5},
+    {0x4560AF11UL, 0x290, 4},
+    {0x4619BE3AUL, 0x2B0, 7},
+    {0x4619BE3AUL, 0x2D1, 7},
+    {0x4619BE3AUL, 0x2F3, 7},
+    {0x4619BE3AUL, 0x2B1, 4},
+    {0x4763237EUL, 0x372, 7},
+    {0x4763237EUL, 0x353, 4},
+    {0x47A303B6UL, 0x14F, 7},
+    {0x47A303B6UL, 0x10D, 5},
+    {0x47A303B6UL, 0x10C, 4},
+    {0x47A303B6UL, 0x0C9, 2},
+    {0x47A303B6UL, 0x16F, 2},
+    {0x47C62C69UL, 0x2D2, 7},
+    {0x47C62C69UL, 0x2F3, 5},
+    {0x47C62C69UL, 0x22E, 2},
+    {0x47C62C69UL, 0x2F2, 1},
+    {0x47C898E9UL, 0x16F, 7},
+    {0x47C898E9UL, 0x1D1, 5},
+    {0x47C898E9UL, 0x14F, 5},
+    {0x47C898E9UL, 0x0C9, 2},
+    {0x47C898E9UL, 0x0A9, 2},
+    {0x47C898E9UL, 0x10D, 2},
+    {0x47C898E9UL, 0x1D2, 2},
+    {0x4808EAAAUL, 0x356, 7},
+    {0x4808EAAAUL, 0x377, 7},
+    {0x4808EAAAUL, 0x357, 5},
+    {0x4808EAAAUL, 0x2B0, 4},
+    {0x4808EAAAUL, 0x336, 4},
+    {0x481E79CAUL, 0x1F2, 7},
+    {0x481E79CAUL, 0x12E, 7},
+    {0x481E79CAUL, 0x10C, 5},
+    {0x481E79CAUL, 0x10D, 5},
+    {0x481E79CAUL, 0x0EA, 3},
+    {0x481E79CAUL, 0x0CA, 3},
+    {0x481E79CAUL, 0x12D, 1},
+    {0x48B54DD2UL, 0x2F2, 7},
+    {0x48D164D1UL, 0x356, 7},
+    {0x48D164D1UL, 0x2B0, 5},
+    {0x48D164D1UL, 0x2B1, 4},
+    {0x48D164D1UL, 0x2F3, 4},
+    {0x48D164D1UL, 0x336, 4},
+    {0x48D164D1UL, 0x2F2, 2},
+    {0x48E71344UL, 0x2B0, 7},
+    {0x48E71344UL, 0x2D1, 7},
+    {0x48E71344UL, 0x377, 6},
+    {0x48E71344UL, 0x357, 6},
+    {0x48E71344UL, 0x2B1, 4},
+    {0x49055AB9UL, 0x20C, 7},
+    {0x49055AB9UL, 0x20D, 6},
+    {0x49055AB9UL, 0x314, 2},
+    {0x49055AB9UL, 0x357, 1},
+    {0x4968CC72UL, 0x2B0, 7},
+    {0x4968CC72UL, 0x356, 7},
+    {0x4968CC72UL, 0x377, 7},
+    {0x4968CC72UL, 0x357, 7},
+    {0x4968CC72UL, 0x336, 1},
+    {0x496EC1E6UL, 0x356, 7},
+    {0x496EC1E6UL, 0x315, 7},
+    {0x496EC1E6UL, 0x20C, 5},
+    {0x496EC1E6UL, 0x2F2, 4},
+    {0x496EC1E6UL, 0x335, 4},
+    {0x496EC1E6UL, 0x336, 4},
+    {0x496EC1E6UL, 0x2F3, 1},
+    {0x49A78CFFUL, 0x315, 7},
+    {0x49A78CFFUL, 0x335, 6},
+    {0x49A78CFFUL, 0x2F2, 4},
+    {0x49A78CFFUL, 0x2D2, 3},
+    {0x49A78CFFUL, 0x290, 2},
+    {0x49A78CFFUL, 0x2F3, 1},
+    {0x4A6AB516UL, 0x249, 7},
+    {0x4A6AB516UL, 0x209, 3},
+    {0x4A6B8923UL, 0x0EA, 7},
+    {0x4A6B8923UL, 0x10C, 7},
+    {0x4A6B8923UL, 0x1F3, 6},
+    {0x4A6B8923UL, 0x12D, 4},
+    {0x4A6B8923UL, 0x12E, 3},
+    {0x4A6B8923UL, 0x1F2, 1},
+    {0x4A6B8923UL, 0x0CA, 1},
+    {0x4A6B8923UL, 0x10D, 1},
+    {0x4A77E7A9UL, 0x22E, 7},
+    {0x4A77E7A9UL, 0x2D2, 7},
+    {0x4A77E7A9UL, 0x2F2, 4},
+    {0x4A77E7A9UL, 0x290, 1},
+    {0x4A77E7A9UL, 0x2F3, 1},
+    {0x4A77E7A9UL, 0x398, 1},
+    {0x4A7D1A43UL, 0x2B1, 7},
+    {0x4A7D1A43UL, 0x2F3, 6},
+    {0x4A7D1A43UL, 0x2D1, 5},
+    {0x4A7D1A43UL, 0x3B9, 4},
+    {0x4A7D1A43UL, 0x2B0, 1},
+    {0x4AA30A25UL, 0x332, 7},
+    {0x4AA30A25UL, 0x351, 1},
+    {0x4B10A7BFUL, 0x10D, 7},
+    {0x4B10A7BFUL, 0x1D1, 5},
+    {0x4B10A7BFUL, 0x10C, 1},
+    {0x4B10A7BFUL, 0x14F, 1},
+    {0x4B1D3C9BUL, 0x2B0, 7},
+    {0x4B1D3C9BUL, 0x2F2, 6},
+    {0x4B1D3C9BUL, 0x3B9, 4},
+    {0x4B1D3C9BUL, 0x2D2, 3},
+    {0x4B42BD5BUL, 0x3B9, 7},
+    {0x4B42BD5BUL, 0x2F2, 6},
+    {0x4B42BD5BUL, 0x2F3, 4},
+    {0x4B42BD5BUL, 0x2D1, 3},
+    {0x4B5436BFUL, 0x2B0, 7},
+    {0x4B5436BFUL, 0x2D1, 7},
+    {0x4B5436BFUL, 0x2B1, 7},
+    {0x4B5436BFUL, 0x2F3, 7},
+    {0x4B5ED3D1UL, 0x10C, 7},
+    {0x4B5ED3D1UL, 0x1D2, 5},
+    {0x4B73C8D7UL, 0x2EE, 7},
+    {0x4B73C8D7UL, 0x2CF, 2},
+    {0x4C642794UL, 0x315, 7},
+    {0x4C642794UL, 0x2F2, 5},
+    {0x4C642794UL, 0x2D1, 2},
+    {0x4C642794UL, 0x335, 2},
+    {0x4C642794UL, 0x2F3, 2},
+    {0x4CAD6A8DUL, 0x20C, 7},
+    {0x4CAD6A8DUL, 0x20D, 3},
+    {0x4CAD6A8DUL, 0x356, 2},
+    {0x4CAD6A8DUL, 0x2F2, 1},
+    {0x4CAD6A8DUL, 0x315, 1},
+    {0x4CC6F1D2UL, 0x20C, 7},
+    {0x4CC6F1D2UL, 0x314, 4},
+    {0x4CC6F1D2UL, 0x20D, 3},
+    {0x4CC6F1D2UL, 0x377, 2},
+    {0x4D3BE799UL, 0x2B1, 7},
+    {0x4D3BE799UL, 0x357, 5},
+    {0x4D3BE799UL, 0x2D2, 4},
+    {0x4D3BE799UL, 0x2B0, 1},
+    {0x4D3BE799UL, 0x290, 1},
+    {0x4D5522C6UL, 0x24E, 7},
+    {0x4D5522C6UL, 0x2B0, 5},
+    {0x4D5522C6UL, 0x377, 5},
+    {0x4D5522C6UL, 0x2D1, 4},
+    {0x4D5522C6UL, 0x2B1, 2},
+    {0x4D5522C6UL, 0x357, 2},
+    {0x4D63305CUL, 0x20C, 7},
+    {0x4D63305CUL, 0x2D2, 5},
+    {0x4D63305CUL, 0x2D1, 2},
+    {0x4D63305CUL, 0x2F2, 2},
+    {0x4D63305CUL, 0x2B1, 1},
+    {0x4DBAD4EBUL, 0x10C, 7},
+    {0x4DBAD4EBUL, 0x0A9, 7},
+    {0x4DBAD4EBUL, 0x14F, 6},
+    {0x4DBAD4EBUL, 0x0C9, 5},
+    {0x4E14A854UL, 0x2B1, 7},
+    {0x4E14A854UL, 0x2D1, 4},
+    {0x4E14A854UL, 0x2B0, 2},
+    {0x4E14A854UL, 0x2D2, 2},
+    {0x4E47E851UL, 0x2AC, 7},
+    {0x4E47E851UL, 0x28D, 3},
+    {0x4F7D5BEAUL, 0x20C, 7},
+    {0x4F7D5BEAUL, 0x22E, 7},
+    {0x4F7D5BEAUL, 0x22D, 5},
+    {0x4F7D5BEAUL, 0x314, 4},
+    {0x4FCF2402UL, 0x14E, 7},
+    {0x4FCF2402UL, 0x14F, 7},
+    {0x4FCF2402UL, 0x10C, 4},
+    {0x4FCF2402UL, 0x0A9, 4},
+    {0x4FCF2402UL, 0x0C9, 2},
+    {0x4FEC16E0UL, 0x10D, 7},
+    {0x4FEC16E0UL, 0x0A9, 4},
+    {0x4FEC16E0UL, 0x0C9, 1},
+    {0x4FEC16E0UL, 0x14F, 1},
+    {0x50AD3632UL, 0x22E, 7},
+    {0x50AD3632UL, 0x357, 7},
+    {0x50AD3632UL, 0x26F, 4},
+    {0x50AD3632UL, 0x2B0, 1},
+    {0x50ADAB56UL, 0x24B, 7},
+    {0x523C27FCUL, 0x20C, 7},
+    {0x523C27FCUL, 0x335, 6},
+    {0x523C27FCUL, 0x315, 6},
+    {0x523C27FCUL, 0x356, 4},
+    {0x526F012DUL, 0x315, 7},
+    {0x526F012DUL, 0x357, 7},
+    {0x526F012DUL, 0x22D, 6},
+    {0x526F012DUL, 0x22E, 6},
+    {0x526F012DUL, 0x335, 4},
+    {0x526F012DUL, 0x290, 4},
+    {0x52D8C6DBUL, 0x2EE, 7},
+    {0x53800848UL, 0x2B0, 7},
+    {0x53800848UL, 0x2F3, 4},
+    {0x53800848UL, 0x2B1, 1},
+    {0x53800848UL, 0x3DA, 1},
+    {0x53F611EFUL, 0x335, 7},
+    {0x53F611EFUL, 0x377, 6},
+    {0x53F611EFUL, 0x2D2, 6},
+    {0x53F611EFUL, 0x315, 6},
+    {0x53F611EFUL, 0x357, 6},
+    {0x5430EE2CUL, 0x314, 7},
+    {0x5430EE2CUL, 0x2D2, 7},
+    {0x5430EE2CUL, 0x2D1, 4},
+    {0x5430EE2CUL, 0x2B1, 4},
+    {0x5430EE2CUL, 0x2B0, 3},
+    {0x5430EE2CUL, 0x2F2, 2},
+    {0x5507F685UL, 0x20C, 7},
+    {0x5507F685UL, 0x2F2, 7},
+    {0x5507F685UL, 0x2D2, 5},
+    {0x5507F685UL, 0x315, 5},
+    {0x5507F685UL, 0x2F3, 4},
+    {0x5507F685UL, 0x2D1, 3},
+    {0x5507F685UL, 0x335, 1},
+    {0x55399FA1UL, 0x2AE, 7},
+    {0x55399FA1UL, 0x2CD, 7},
+    {0x55B2B47DUL, 0x377, 7},
+    {0x55B2B47DUL, 0x315, 7},
+    {0x55B2B47DUL, 0x20C, 6},
+    {0x55B2B47DUL, 0x2D2, 6},
+    {0x55B2B47DUL, 0x20D, 2},
+    {0x55B2B47DUL, 0x335, 1},
+    {0x55D92F22UL, 0x2F3, 7},
+    {0x55D92F22UL, 0x20C, 6},
+    {0x55D92F22UL, 0x314, 5},
+    {0x5693D6A6UL, 0x28D, 7},
+    {0x5693D6A6UL, 0x2AC, 7},
+    {0x56C096A3UL, 0x2B1, 7},
+    {0x56C096A3UL, 0x2F2, 6},
+    {0x56C096A3UL, 0x2B0, 2},
+    {0x56C096A3UL, 0x2D1, 2},
+    {0x56E90EC4UL, 0x20C, 7},
+    {0x56E90EC4UL, 0x357, 4},
+    {0x56E90EC4UL, 0x377, 2},
+    {0x56E90EC4UL, 0x315, 2},
+    {0x571B8559UL, 0x2F2, 7},
+    {0x571B8559UL, 0x22D, 6},
+    {0x571B8559UL, 0x22E, 6},
+    {0x571B8559UL, 0x314, 5},
+    {0x571B8559UL, 0x336, 5},
+    {0x571B8559UL, 0x356, 4},
+    {0x571B8559UL, 0x2F3, 1},
+    {0x57382817UL, 0x10D, 7},
+    {0x57382817UL, 0x14F, 7},
+    {0x57382817UL, 0x0C9, 6},
+    {0x57382817UL, 0x0A9, 6},
+    {0x57382817UL, 0x10C, 4},
+    {0x57382817UL, 0x16F, 4},
+    {0x57382817UL, 0x1D1, 3},
+    {0x58A6FF25UL, 0x22D, 7},
+    {0x58A6FF25UL, 0x290, 4},
+    {0x58A6FF25UL, 0x357, 3},
+    {0x58A6FF25UL, 0x356, 1},
+    {0x58A6FF25UL, 0x377, 1},
+    {0x5924FF45UL, 0x2F2, 7},
+    {0x596A8B2BUL, 0x24B, 7},
+    {0x5A1AAA3CUL, 0x2CF, 7},
+    {0x5A1AAA3CUL, 0x2EE, 7},
+    {0x5A40C228UL, 0x314, 7},
+    {0x5A40C228UL, 0x20C, 1},
+    {0x5AC1D5C6UL, 0x209, 7},
+    {0x5AC1D5C6UL, 0x26A, 7},
+    {0x5ACF6146UL, 0x0C9, 7},
+    {0x5ACF6146UL, 0x10C, 7},
+    {0x5ACF6146UL, 0x1D2, 6},
+    {0x5ACF6146UL, 0x0A9, 5},
+    {0x5ACF6146UL, 0x10D, 4},
+    {0x5ACF6146UL, 0x14F, 3},
+    {0x5AD30FCCUL, 0x2F2, 7},
+    {0x5AD30FCCUL, 0x290, 6},
+    {0x5B62BB5CUL, 0x0EA, 7},
+    {0x5B62BB5CUL, 0x12D, 7},
+    {0x5B62BB5CUL, 0x0CA, 6},
+    {0x5B62BB5CUL, 0x10D, 4},
+    {0x5B62BB5CUL, 0x10C, 3},
+    {0x5B856587UL, 0x2D2, 7},
+    {0x5B856587UL, 0x2D1, 6},
+    {0x5B856587UL, 0x314, 4},
+    {0x5BA48641UL, 0x335, 7},
+    {0x5BA48641UL, 0x20C, 4},
+    {0x5BA48641UL, 0x377, 3},
+    {0x5BA48641UL, 0x315, 3},
+    {0x5BA48641UL, 0x357, 3},
+    {0x5BFB0781UL, 0x228, 7},
+    {0x5BFB0781UL, 0x22A, 4},
+    {0x5D963A74UL, 0x2F2, 7},
+    {0x5DE3569DUL, 0x2F2, 7},
+    {0x5DE3569DUL, 0x2B1, 4},
+    {0x5DE3569DUL, 0x336, 4},
+    {0x5E8F83F5UL, 0x22A, 7},
+    {0x5E8F83F5UL, 0x228, 5},
+    {0x5EBB996AUL, 0x2D2, 7},
+    {0x5EBB996AUL, 0x315, 6},
+    {0x5EBB996AUL, 0x377, 4},
+    {0x5EBB996AUL, 0x357, 1},
+    {0x5ECD80CDUL, 0x2B0, 7},
+    {0x5ECD80CDUL, 0x2F3, 7},
+    {0x5ECD80CDUL, 0x2B1, 5},
+    {0x5ECD80CDUL, 0x2D1, 2},
+    {0x5EE418AAUL, 0x315, 7},
+    {0x5EE418AAUL, 0x377, 5},
+    {0x5EE418AAUL, 0x357, 5},
+    {0x5EE418AAUL, 0x20C, 4},
+    {0x5EE418AAUL, 0x26F, 3},
+    {0x5EE418AAUL, 0x2D1, 1},
+    {0x5EE418AAUL, 0x2D2, 1},
+    {0x5FA0A8EBUL, 0x2B1, 7},
+    {0x5FA0A8EBUL, 0x2D1, 6},
+    {0x5FA0A8EBUL, 0x2F2, 5},
+    {0x5FA0A8EBUL, 0x2F3, 5},
+    {0x5FDECAEDUL, 0x24E, 7},
+    {0x5FDECAEDUL, 0x22E, 6},
+    {0x5FDECAEDUL, 0x357, 4},
+    {0x5FDECAEDUL, 0x335, 3},
+    {0x5FDECAEDUL, 0x315, 3},
+    {0x5FDECAEDUL, 0x377, 1},
+    {0x603AD332UL, 0x0AE, 7},
+    {0x603AD332UL, 0x0CD, 5},
+    {0x609276B5UL, 0x12D, 7},
+    {0x609276B5UL, 0x12E, 6},
+    {0x609276B5UL, 0x14E, 1},
+    {0x609276B5UL, 0x0EB, 1},
+    {0x60F8EB36UL, 0x2B0, 7},
+    {0x60F8EB36UL, 0x2F2, 7},
+    {0x60F8EB36UL, 0x356, 7},
+    {0x60F8EB36UL, 0x290, 7},
+    {0x60F8EB36UL, 0x2F3, 7},
+    {0x60F8EB36UL, 0x336, 7},
+    {0x60F8EB36UL, 0x2B1, 5},
+    {0x60F9EDEAUL, 0x10D, 7},
+    {0x61DAA8C9UL, 0x132, 7},
+    {0x624206C4UL, 0x0A9, 7},
+    {0x624206C4UL, 0x10C, 6},
+    {0x624206C4UL, 0x14F, 6},
+    {0x624206C4UL, 0x0C9, 5},
+    {0x624206C4UL, 0x16F, 5},
+    {0x624206C4UL, 0x14E, 3},
+    {0x62449E05UL, 0x332, 7},
+    {0x62449E05UL, 0x351, 4},
+    {0x6285D0E1UL, 0x20D, 7},
+    {0x6285D0E1UL, 0x24E, 5},
+    {0x6285D0E1UL, 0x20C, 2},
+    {0x6285D0E1UL, 0x335, 2},
+    {0x6285D0E1UL, 0x377, 2},
+    {0x6285D0E1UL, 0x24F, 2},
+    {0x6285D0E1UL, 0x315, 2},
+    {0x63CCAA4EUL, 0x2F2, 7},
+    {0x63CCAA4EUL, 0x22D, 6},
+    {0x63CCAA4EUL, 0x335, 1},
+    {0x63CCAA4EUL, 0x2D2, 1},
+    {0x63CCAA4EUL, 0x2F3, 1},
+    {0x6483EECFUL, 0x16F, 7},
+    {0x6483EECFUL, 0x0A9, 4},
+    {0x6483EECFUL, 0x14F, 4},
+    {0x6483EECFUL, 0x10C, 3},
+    {0x6483EECFUL, 0x10D, 3},
+    {0x6483EECFUL, 0x0C9, 2},
+    {0x64E5EEB4UL, 0x3B9, 7},
+    {0x64E5EEB4UL, 0x2B0, 6},
+    {0x64E5EEB4UL, 0x2F3, 6},
+    {0x64E5EEB4UL, 0x2D1, 5},
+    {0x64E5EEB4UL, 0x2B1, 1},
+    {0x6509C3ECUL, 0x132, 7},
+    {0x6509C3ECUL, 0x151, 7},
+    {0x6585C86CUL, 0x2F2, 7},
+    {0x6585C86CUL, 0x2F3, 7},
+    {0x6585C86CUL, 0x2D2, 6},
+    {0x6585C86CUL, 0x290, 4},
+    {0x6585C86CUL, 0x3B9, 1},
+    {0x658D699EUL, 0x0EB, 7},
+    {0x65935B0CUL, 0x10D, 7},
+    {0x65935B0CUL, 0x0EA, 6},
+    {0x65935B0CUL, 0x1F3, 6},
+    {0x65935B0CUL, 0x10C, 2},
+    {0x65935B0CUL, 0x12D, 2},
+    {0x65CCC248UL, 0x2F3, 7},
+    {0x65CCC248UL, 0x2B0, 1},
+    {0x65CCC248UL, 0x2D1, 1},
+    {0x65CCC248UL, 0x2B1, 1},
+    {0x66825979UL, 0x2AE, 7},
+    {0x66825979UL, 0x2CD, 7},
+    {0x66901E5DUL, 0x356, 7},
+    {0x66901E5DUL, 0x377, 7},
+    {0x66901E5DUL, 0x2B0, 4},
+    {0x66901E5DUL, 0x357, 3},
+    {0x66901E5DUL, 0x336, 1},
+    {0x6752915AUL, 0x0A8, 7},
+    {0x6752915AUL, 0x14E, 6},
+    {0x6752915AUL, 0x088, 6},
+    {0x6752915AUL, 0x12E, 6},
+    {0x6752915AUL, 0x14F, 6},
+    {0x67A909FDUL, 0x2F2, 7},
+    {0x67A909FDUL, 0x2D1, 6},
+    {0x67A909FDUL, 0x2B1, 6},
+    {0x67A909FDUL, 0x2B0, 5},
+    {0x67A909FDUL, 0x290, 5},
+    {0x67A909FDUL, 0x3FA, 2},
+    {0x67A909FDUL, 0x2D2, 2},
+    {0x67A909FDUL, 0x3DA, 2},
+    {0x67F03885UL, 0x356, 7},
+    {0x67F03885UL, 0x377, 7},
+    {0x67F03885UL, 0x336, 7},
+    {0x67F03885UL, 0x357, 4},
+    {0x67F03885UL, 0x290, 1},
+    {0x685BD199UL, 0x10C, 7},
+    {0x685BD199UL, 0x14F, 7},
+    {0x68B6F8BCUL, 0x0EB, 7},
+    {0x68B6F8BCUL, 0x10C, 4},
+    {0x69E87C03UL, 0x332, 7},
+    {0x69E87C03UL, 0x351, 7},
+    {0x6A25B7C0UL, 0x314, 7},
+    {0x6A25B7C0UL, 0x20C, 5},
+    {0x6A25B7C0UL, 0x20D, 3},
+    {0x6A4E2C9FUL, 0x20C, 7},
+    {0x6A4E2C9FUL, 0x377, 5},
+    {0x6A4E2C9FUL, 0x315, 2},
+    {0x6A9298DFUL, 0x22D, 7},
+    {0x6A9298DFUL, 0x315, 1},
+    {0x6A9298DFUL, 0x357, 1},
+    {0x6AD8CA32UL, 0x2AE, 7},
+    {0x6AD8CA32UL, 0x2CD, 7},
+    {0x6AECFAD9UL, 0x314, 7},
+    {0x6AECFAD9UL, 0x2F3, 7},
+    {0x6AECFAD9UL, 0x2D1, 4},
+    {0x6AECFAD9UL, 0x2F2, 4},
+    {0x6AECFAD9UL, 0x2B1, 4},
+    {0x6AECFAD9UL, 0x2D2, 3},
+    {0x6AECFAD9UL, 0x2B0, 2},
+    {0x6AFCB0A6UL, 0x2D1, 7},
+    {0x6AFCB0A6UL, 0x2B0, 5},
+    {0x6AFCB0A6UL, 0x377, 2},
+    {0x6AFCB0A6UL, 0x357, 2},
+    {0x6AFCB0A6UL, 0x2B1, 1},
+    {0x6AFCB0A6UL, 0x2D2, 1},
+    {0x6B533344UL, 0x2EE, 7},
+    {0x6CB3F66AUL, 0x330, 7},
+    {0x6CB3F66AUL, 0x311, 6},
+    {0x6D249432UL, 0x20C, 7},
+    {0x6D249432UL, 0x2D1, 1},
+    {0x6D249432UL, 0x2F3, 1},
+    {0x6D7F5763UL, 0x2D1, 7},
+    {0x6D7F5763UL, 0x2B1, 7},
+    {0x6D7F5763UL, 0x2B0, 6},
+    {0x6D7F5763UL, 0x377, 6},
+    {0x6D7F5763UL, 0x357, 6},
+    {0x6D863DEDUL, 0x088, 7},
+    {0x6D863DEDUL, 0x14F, 7},
+    {0x6D863DEDUL, 0x0A8, 5},
+    {0x6D863DEDUL, 0x16F, 3},
+    {0x6E4AB5D4UL, 0x153, 7},
+    {0x6E4AB5D4UL, 0x172, 3},
+    {0x6E6587B6UL, 0x2CD, 7},
+    {0x6F2F51B2UL, 0x314, 7},
+    {0x6F2F51B2UL, 0x2F3, 3},
+    {0x6F2F51B2UL, 0x2F2, 2},
+    {0x6F5133B4UL, 0x22D, 7},
+    {0x6F5133B4UL, 0x22E, 7},
+    {0x6F5133B4UL, 0x335, 5},
+    {0x6F5133B4UL, 0x377, 5},
+    {0x6F5133B4UL, 0x315, 5},
+    {0x6F5133B4UL, 0x357, 5},
+    {0x6F8D87F4UL, 0x20C, 7},
+    {0x6F8D87F4UL, 0x377, 4},
+    {0x6F8D87F4UL, 0x315, 4},
+    {0x6FA9211FUL, 0x2D1, 7},
+    {0x6FA9211FUL, 0x2B0, 5},
+    {0x6FA9211FUL, 0x2F2, 4},
+    {0x6FA9211FUL, 0x2D2, 4},
+    {0x6FA9211FUL, 0x2B1, 1},
+    {0x6FBAC720UL, 0x0A8, 7},
+    {0x6FBAC720UL, 0x14E, 4},
+    {0x6FBAC720UL, 0x12E, 4},
+    {0x6FBAC720UL, 0x14F, 1},
+    {0x6FE61CABUL, 0x20C, 7},
+    {0x6FE61CABUL, 0x22D, 6},
+    {0x6FE61CABUL, 0x20D, 3},
+    {0x6FE61CABUL, 0x314, 1},
+    {0x6FF3CD04UL, 0x088, 7},
+    {0x6FF3CD04UL, 0x14F, 7},
+    {0x6FF3CD04UL, 0x14E, 5},
+    {0x6FF3CD04UL, 0x12D, 4},
+    {0x6FF3CD04UL, 0x16F, 3},
+    {0x6FF3CD04UL, 0x0A8, 1},
+    {0x6FF3CD04UL, 0x12E, 1},
+    {0x70236D9DUL, 0x377, 7},
+    {0x70236D9DUL, 0x2D2, 5},
+    {0x70236D9DUL, 0x315, 4},
+    {0x70236D9DUL, 0x357, 2},
+    {0x70382A50UL, 0x2F3, 7},
+    {0x70382A50UL, 0x2F2, 6},
+    {0x70382A50UL, 0x2B0, 3},
+    {0x70382A50UL, 0x22E, 3},
+    {0x7062C64BUL, 0x14E, 7},
+    {0x7062C64BUL, 0x0EB, 7},
+    {0x7062C64BUL, 0x10C, 4},
+    {0x7062C64BUL, 0x12E, 4},
+    {0x713552E2UL, 0x2B0, 7},
+    {0x713552E2UL, 0x2F2, 4},
+    {0x713552E2UL, 0x2D2, 4},
+    {0x713552E2UL, 0x2F3, 3},
+    {0x717751DAUL, 0x314, 7},
+    {0x717751DAUL, 0x20C, 5},
+    {0x71B686DAUL, 0x10C, 7},
+    {0x71B686DAUL, 0x14E, 6},
+    {0x71B686DAUL, 0x12D, 4},
+    {0x71B686DAUL, 0x10D, 4},
+    {0x71B686DAUL, 0x14F, 4},
+    {0x720CF4C5UL, 0x2CD, 7},
+    {0x720CF4C5UL, 0x2AE, 3},
+    {0x723F8859UL, 0x2AC, 7},
+    {0x724DDAB9UL, 0x377, 7},
+    {0x724DDAB9UL, 0x2B0, 1},
+    {0x724DDAB9UL, 0x357, 1},
+    {0x728A7E5BUL, 0x2F3, 7},
+    {0x728A7E5BUL, 0x2F2, 4},
+    {0x728A7E5BUL, 0x2D2, 4},
+    {0x728A7E5BUL, 0x2B0, 3},
+    {0x73BF24A9UL, 0x20C, 7},
+    {0x73BF24A9UL, 0x2F2, 1},
+    {0x7450F37FUL, 0x2F2, 7},
+    {0x7450F37FUL, 0x22E, 7},
+    {0x7450F37FUL, 0x335, 3},
+    {0x7450F37FUL, 0x22D, 2},
+    {0x74B77275UL, 0x2CF, 7},
+    {0x74E56480UL, 0x330, 7},
+    {0x74E56480UL, 0x311, 5},
+    {0x7528BDCEUL, 0x2D1, 7},
+    {0x753C72B6UL, 0x20C, 7},
+    {0x753C72B6UL, 0x335, 5},
+    {0x753C72B6UL, 0x377, 5},
+    {0x753C72B6UL, 0x357, 5},
+    {0x753C72B6UL, 0x315, 1},
+    {0x764C80A3UL, 0x20C, 7},
+    {0x764C80A3UL, 0x2F2, 7},
+    {0x764C80A3UL, 0x314, 5},
+    {0x764C80A3UL, 0x2F3, 4},
+    {0x767C8FC2UL, 0x20C, 7},
+    {0x767C8FC2UL, 0x2F2, 5},
+    {0x767C8FC2UL, 0x2D2, 3},
+    {0x767C8FC2UL, 0x2D1, 2},
+    {0x767C8FC2UL, 0x3B9, 2},
+    {0x767C8FC2UL, 0x2F3, 1},
+    {0x76925904UL, 0x20C, 7},
+    {0x76925904UL, 0x315, 4},
+    {0x76925904UL, 0x2F2, 3},
+    {0x76925904UL, 0x20D, 3},
+    {0x76925904UL, 0x335, 2},
+    {0x76925904UL, 0x356, 2},
+    {0x76925904UL, 0x2F3, 1},
+    {0x76F9C25BUL, 0x2D2, 7},
+    {0x76F9C25BUL, 0x20C, 6},
+    {0x76F9C25BUL, 0x314, 6},
+    {0x76F9C25BUL, 0x2D1, 4},
+    {0x76F9C25BUL, 0x377, 3},
+    {0x76F9C25BUL, 0x20D, 3},
+    {0x76F9C25BUL, 0x2B1, 1},
+    {0x773659C6UL, 0x2AE, 7},
+    {0x773659C6UL, 0x2CD, 5},
+    {0x7749D530UL, 0x2D2, 7},
+    {0x7749D530UL, 0x2F3, 7},
+    {0x7749D530UL, 0x2B0, 4},
+    {0x7749D530UL, 0x2F2, 4},
+    {0x7749D530UL, 0x398, 2},
+    {0x776EF9D7UL, 0x088, 7},
+    {0x776EF9D7UL, 0x14F, 7},
+    {0x776EF9D7UL, 0x0A8, 6},
+    {0x776EF9D7UL, 0x14E, 1},
+    {0x776EF9D7UL, 0x12E, 1},
+    {0x777B980AUL, 0x335, 7},
+    {0x777B980AUL, 0x2D2, 7},
+    {0x777B980AUL, 0x315, 7},
+    {0x777B980AUL, 0x2D1, 4},
+    {0x777B980AUL, 0x290, 3},
+    {0x777B980AUL, 0x2F2, 2},
+    {0x777D1FE8UL, 0x2F2, 7},
+    {0x777D1FE8UL, 0x2B0, 4},
+    {0x777D1FE8UL, 0x2D2, 2},
+    {0x783D5BD6UL, 0x330, 7},
+    {0x783D5BD6UL, 0x311, 4},
+    {0x78CE13A1UL, 0x2D1, 7},
+    {0x78CE13A1UL, 0x315, 5},
+    {0x78CE13A1UL, 0x2D2, 4},
+    {0x78CE13A1UL, 0x335, 2},
+    {0x78E35776UL, 0x314, 7},
+    {0x78E35776UL, 0x2B1, 7},
+    {0x78E35776UL, 0x24E, 1},
+    {0x790BB40EUL, 0x315, 7},
+    {0x790BB40EUL, 0x20C, 6},
+    {0x790BB40EUL, 0x335, 5},
+    {0x790BB40EUL, 0x2D1, 3},
+    {0x790BB40EUL, 0x2D2, 2},
+    {0x790BB40EUL, 0x2F3, 1},
+    {0x7951DC1AUL, 0x2CF, 7},
+    {0x7951DC1AUL, 0x2EE, 7},
+    {0x798AA3E0UL, 0x209, 7},
+    {0x7A21FD0DUL, 0x24B, 7},
+    {0x7A5568F5UL, 0x14F, 7},
+    {0x7A5568F5UL, 0x1B0, 4},
+    {0x7A5568F5UL, 0x12E, 4},
+    {0x7A5568F5UL, 0x0A8, 3},
+    {0x7A5568F5UL, 0x14E, 3},
+    {0x7A5568F5UL, 0x16F, 1},
+    {0x7A5568F5UL, 0x088, 1},
+    {0x7A9D3665UL, 0x20C, 7},
+    {0x7A9D3665UL, 0x2D1, 5},
+    {0x7A9D3665UL, 0x2F2, 5},
+    {0x7A9D3665UL, 0x2D2, 5},
+    {0x7A9D3665UL, 0x2B1, 4},
+    {0x7AAAD6D1UL, 0x20D, 7},
+    {0x7AAAD6D1UL, 0x20C, 5},
+    {0x7AAAD6D1UL, 0x24E, 5},
+    {0x7AAAD6D1UL, 0x315, 5},
+    {0x7AAAD6D1UL, 0x336, 5},
+    {0x7AAAD6D1UL, 0x335, 3},
+    {0x7AE4A2BFUL, 0x2AE, 7},
+    {0x7B310747UL, 0x2D2, 7},
+    {0x7B310747UL, 0x20C, 6},
+    {0x7B310747UL, 0x2F2, 4},
+    {0x7B310747UL, 0x2B1, 4},
+    {0x7B310747UL, 0x2F3, 4},
+    {0x7C78DA67UL, 0x2B0, 7},
+    {0x7C78DA67UL, 0x2F2, 7},
+    {0x7C78DA67UL, 0x2F3, 6},
+    {0x7C78DA67UL, 0x3DA, 2},
+    {0x7CE220DBUL, 0x0CF, 7},
+    {0x7CE220DBUL, 0x0EE, 7},
+    {0x7CEBDECDUL, 0x2F3, 7},
+    {0x7CEBDECDUL, 0x2F2, 6},
+    {0x7CEBDECDUL, 0x2D1, 5},
+    {0x7CEBDECDUL, 0x2D2, 1},
+    {0x7D18FCBFUL, 0x2B1, 7},
+    {0x7D18FCBFUL, 0x2F3, 6},
+    {0x7D18FCBFUL, 0x2B0, 4},
+    {0x7D3EBB02UL, 0x22A, 7},
+    {0x7D3EBB02UL, 0x26A, 7},
+    {0x7D89E190UL, 0x2F3, 7},
+    {0x7D89E190UL, 0x2F2, 4},
+    {0x7D89E190UL, 0x290, 2},
+    {0x7D958F1AUL, 0x1F3, 7},
+    {0x7D958F1AUL, 0x0EB, 5},
+    {0x7D958F1AUL, 0x10C, 3},
+    {0x7D958F1AUL, 0x10D, 2},
+    {0x7D958F1AUL, 0x1F2, 1},
+    {0x7DA0D72DUL, 0x2F2, 7},
+    {0x7DAF6E8CUL, 0x20C, 7},
+    {0x7DAF6E8CUL, 0x314, 7},
+    {0x7E56678EUL, 0x2CD, 7},
+    {0x7F320ABEUL, 0x209, 7},
+    {0x7F4A77DEUL, 0x0A8, 7},
+    {0x7F4A77DEUL, 0x12E, 7},
+    {0x7F4A77DEUL, 0x14E, 2},
+    {0x7F4A77DEUL, 0x14F, 2},
+    {0x7F7D370AUL, 0x2B0, 7},
+    {0x7F7D370AUL, 0x2D1, 7},
+    {0x7F7D370AUL, 0x2B1, 7},
+    {0x7F7D370AUL, 0x290, 5},
+    {0x7F7D370AUL, 0x2F2, 4},
+    {0x7F7D370AUL, 0x2D2, 4},
+    {0x7FFC1179UL, 0x356, 7},
+    {0x7FFC1179UL, 0x336, 7},
+    {0x7FFC1179UL, 0x290, 6},
+    {0x7FFC1179UL, 0x377, 4},
+    {0x7FFC1179UL, 0x357, 4},
+    {0x7FFC1179UL, 0x22D, 3},
+    {0x7FFC1179UL, 0x2B0, 1},
+    {0x80EA1789UL, 0x2AC, 7},
+    {0x80FFD51DUL, 0x2B0, 7},
+    {0x80FFD51DUL, 0x2D1, 4},
+    {0x80FFD51DUL, 0x2B1, 2},
+    {0x80FFD51DUL, 0x290, 1},
+    {0x80FFD51DUL, 0x2D2, 1},
+    {0x80FFD51DUL, 0x3FB, 1},
+    {0x819ED774UL, 0x22D, 7},
+    {0x819ED774UL, 0x377, 6},
+    {0x819ED774UL, 0x290, 6},
+    {0x819ED774UL, 0x315, 4},
+    {0x819ED774UL, 0x357, 1},
+    {0x81C7065BUL, 0x1F3, 7},
+    {0x81C7065BUL, 0x0EB, 5},
+    {0x81C7065BUL, 0x1F2, 4},
+    {0x82610BBCUL, 0x332, 7},
+    {0x82610BBCUL, 0x351, 4},
+    {0x82906FD5UL, 0x28D, 7},
+    {0x82906FD5UL, 0x2AC, 3},
+    {0x82A21E0AUL, 0x336, 7},
+    {0x82A21E0AUL, 0x314, 6},
+    {0x8337A9D9UL, 0x20C, 7},
+    {0x8337A9D9UL, 0x314, 6},
+    {0x8337A9D9UL, 0x377, 3},
+    {0x8337A9D9UL, 0x357, 3},
+    {0x84077A25UL, 0x2F3, 7},
+    {0x84077A25UL, 0x22D, 4},
+    {0x84077A25UL, 0x2B0, 4},
+    {0x84077A25UL, 0x2F2, 4},
+    {0x84077A25UL, 0x290, 4},
+    {0x8496670AUL, 0x2F3, 7},
+    {0x8496670AUL, 0x2B1, 5},
+    {0x8496670AUL, 0x2B0, 1},
+    {0x84C9FE4EUL, 0x1F3, 7},
+    {0x84C9FE4EUL, 0x0EA, 3},
+    {0x84C9FE4EUL, 0x10C, 1},
+    {0x84C9FE4EUL, 0x0CA, 1},
+    {0x84DB7ECCUL, 0x290, 7},
+    {0x84DB7ECCUL, 0x2F2, 5},
+    {0x84DB7ECCUL, 0x2D1, 4},
+    {0x84DB7ECCUL, 0x335, 4},
+    {0x84DB7ECCUL, 0x2D2, 4},
+    {0x84DB7ECCUL, 0x2F3, 1},
+    {0x8503555BUL, 0x2CF, 7},
+    {0x8503555BUL, 0x2EE, 7},
+    {0x85A9C012UL, 0x2F2, 7},
+    {0x85A9C012UL, 0x2D2, 7},
+    {0x85A9C012UL, 0x2D1, 4},
+    {0x85A9C012UL, 0x20C, 1},
+    {0x85BF4BF6UL, 0x2B0, 7},
+    {0x85BF4BF6UL, 0x2D1, 7},
+    {0x85BF4BF6UL, 0x2B1, 7},
+    {0x85BF4BF6UL, 0x2F3, 7},
+    {0x85BF4BF6UL, 0x3FB, 2},
+    {0x85D69E21UL, 0x1D1, 7},
+    {0x85D69E21UL, 0x10D, 3},
+    {0x85D69E21UL, 0x14F, 3},
+    {0x85D69E21UL, 0x0C9, 2},
+    {0x85F641D2UL, 0x2B0, 7},
+    {0x85F641D2UL, 0x2F2, 6},
+    {0x85F641D2UL, 0x3D9, 1},
+    {0x860C6E0DUL, 0x2D1, 7},
+    {0x860C6E0DUL, 0x2B1, 4},
+    {0x860C6E0DUL, 0x2B0, 3},
+    {0x860C6E0DUL, 0x377, 3},
+    {0x860C6E0DUL, 0x357, 1},
+    {0x86E397E3UL, 0x2B1, 7},
+    {0x86E397E3UL, 0x356, 6},
+    {0x86E397E3UL, 0x336, 6},
+    {0x86E397E3UL, 0x357, 5},
+    {0x86E397E3UL, 0x377, 4},
+    {0x86E397E3UL, 0x2B0, 1},
+    {0x8761B561UL, 0x20C, 7},
+    {0x8761B561UL, 0x314, 2},
+    {0x8761B561UL, 0x20D, 2},
+    {0x8761B561UL, 0x336, 2},
+    {0x8761B561UL, 0x356, 1},
+    {0x87767CA4UL, 0x10C, 7},
+    {0x87767CA4UL, 0x10D, 7},
+    {0x87767CA4UL, 0x12D, 4},
+    {0x87767CA4UL, 0x12E, 4},
+    {0x87767CA4UL, 0x14F, 2},
+    {0x87767CA4UL, 0x14E, 1},
+    {0x8894BDF7UL, 0x335, 7},
+    {0x8894BDF7UL, 0x2F2, 6},
+    {0x8894BDF7UL, 0x315, 6},
+    {0x8894BDF7UL, 0x2D2, 3},
+    {0x8894BDF7UL, 0x2F3, 3},
+    {0x88BBC957UL, 0x2F2, 7},
+    {0x88BBC957UL, 0x2D2, 7},
+    {0x88BBC957UL, 0x2F3, 5},
+    {0x88BBC957UL, 0x2B0, 2},
+    {0x88BBC957UL, 0x3D9, 2},
+    {0x88F41C0AUL, 0x2EE, 7},
+    {0x89B6B1E5UL, 0x2F3, 7},
+    {0x89B6B1E5UL, 0x2F2, 4},
+    {0x8AF1C0F1UL, 0x12D, 7},
+    {0x8AF1C0F1UL, 0x14F, 6},
+    {0x8AF1C0F1UL, 0x10C, 5},
+    {0x8AF1C0F1UL, 0x14E, 5},
+    {0x8AF1C0F1UL, 0x10D, 5},
+    {0x8AF1C0F1UL, 0x12E, 5},
+    {0x8B1B5C71UL, 0x2F3, 7},
+    {0x8B1B5C71UL, 0x2F2, 6},
+    {0x8B29114BUL, 0x22E, 7},
+    {0x8B29114BUL, 0x2D2, 3},
+    {0x8B29114BUL, 0x2F2, 2},
+    {0x8B57297CUL, 0x2B0, 7},
+    {0x8B57297CUL, 0x22D, 4},
+    {0x8B57297CUL, 0x377, 2},
+    {0x8B57297CUL, 0x290, 2},
+    {0x8B57297CUL, 0x356, 1},
+    {0x8B57297CUL, 0x22E, 1},
+    {0x8B8BD258UL, 0x2B0, 7},
+    {0x8B8BD258UL, 0x2F2, 7},
+    {0x8B8BD258UL, 0x356, 7},
+    {0x8B8BD258UL, 0x2B1, 6},
+    {0x8B8BD258UL, 0x2F3, 6},
+    {0x8B8BD258UL, 0x336, 1},
+    {0x8BAE43F2UL, 0x14F, 7},
+    {0x8BAE43F2UL, 0x12D, 2},
+    {0x8BAE43F2UL, 0x16F, 2},
+    {0x8BAE43F2UL, 0x10D, 2},
+    {0x8BAE43F2UL, 0x14E, 1},
+    {0x8BB98A37UL, 0x20C, 7},
+    {0x8BB98A37UL, 0x357, 2},
+    {0x8BB98A37UL, 0x314, 1},
+    {0x8BB98A37UL, 0x377, 1},
+    {0x8C21A834UL, 0x10C, 7},
+    {0x8C21A834UL, 0x1F2, 6},
+    {0x8C21A834UL, 0x1F3, 6},
+    {0x8C21A834UL, 0x0EA, 4},
+    {0x8C21A834UL, 0x0CA, 3},
+    {0x8C21A834UL, 0x12D, 2},
+    {0x8C21A834UL, 0x12E, 1},
+    {0x8C3DC6BEUL, 0x2D1, 7},
+    {0x8C3DC6BEUL, 0x2F2, 3},
+    {0x8C3DC6BEUL, 0x2D2, 3},
+    {0x8C3DC6BEUL, 0x2F3, 3},
+    {0x8C3DC6BEUL, 0x3B9, 3},
+    {0x8C95928BUL, 0x14F, 7},
+    {0x8C95928BUL, 0x088, 4},
+    {0x8C95928BUL, 0x12E, 3},
+    {0x8C95928BUL, 0x14E, 2},
+    {0x8C95928BUL, 0x0A8, 1},
+    {0x8CE10773UL, 0x20D, 7},
+    {0x8CE10773UL, 0x20C, 6},
+    {0x8CE10773UL, 0x22D, 4},
+    {0x8CE10773UL, 0x2F2, 1},
+    {0x8D1D5ED8UL, 0x2AC, 7},
+    {0x8D1D5ED8UL, 0x28D, 3},
+    {0x8D219BE5UL, 0x209, 7},
+    {0x8D4E1EDDUL, 0x2B1, 7},
+    {0x8D4E1EDDUL, 0x2D1, 4},
+    {0x8D4E1EDDUL, 0x2B0, 1},
+    {0x8D571D8CUL, 0x2F2, 7},
+    {0x8D571D8CUL, 0x2B1, 7},
+    {0x8D571D8CUL, 0x2D2, 7},
+    {0x8D571D8CUL, 0x2D1, 5},
+    {0x8D571D8CUL, 0x2F3, 4},
+    {0x8D571D8CUL, 0x3B8, 1},
+    {0x8E0F944FUL, 0x2B0, 7},
+    {0x8E0F944FUL, 0x2D1, 4},
+    {0x8E0F944FUL, 0x377, 4},
+    {0x8E0F944FUL, 0x2B1, 4},
+    {0x8E0F944FUL, 0x357, 4},
+    {0x8E23AD08UL, 0x22E, 7},
+    {0x8E23AD08UL, 0x2D2, 3},
+    {0x8E23AD08UL, 0x22D, 2},
+    {0x8E7A215CUL, 0x20C, 7},
+    {0x8E7A215CUL, 0x314, 3},
+    {0x8E7A215CUL, 0x20D, 3},
+    {0x8ED8F71AUL, 0x2F3, 7},
+    {0x8ED8F71AUL, 0x2D1, 4},
+    {0x8ED8F71AUL, 0x335, 4},
+    {0x8ED8F71AUL, 0x315, 3},
+    {0x8EE06262UL, 0x14F, 7},
+    {0x8EE06262UL, 0x0A8, 3},
+    {0x8EE06262UL, 0x088, 3},
+    {0x8EE06262UL, 0x14E, 1},
+    {0x8EFF6CC5UL, 0x2F2, 7},
+    {0x8F61022FUL, 0x16F, 7},
+    {0x8F61022FUL, 0x1D2, 7},
+    {0x8F61022FUL, 0x10D, 1},
+    {0x8F873717UL, 0x2B0, 7},
+    {0x8F873717UL, 0x2D2, 5},
+    {0x8F873717UL, 0x377, 4},
+    {0x8F873717UL, 0x2B1, 4},
+    {0x8F873717UL, 0x2D1, 3},
+    {0x8F873717UL, 0x290, 3},
+    {0x8F873717UL, 0x357, 3},
+    {0x8FCAB9B8UL, 0x353, 7},
+    {0x8FCAB9B8UL, 0x372, 4},
+    {0x8FEF968FUL, 0x20C, 7},
+    {0x8FEF968FUL, 0x314, 6},
+    {0x8FEF968FUL, 0x356, 6},
+    {0x8FEF968FUL, 0x336, 2},
+    {0x900F65E3UL, 0x26F, 7},
+    {0x900F65E3UL, 0x377, 7},
+    {0x900F65E3UL, 0x357, 5},
+    {0x900F65E3UL, 0x2D2, 4},
+    {0x900F65E3UL, 0x315, 1},
+    {0x902022FDUL, 0x2CF, 7},
+    {0x902022FDUL, 0x2EE, 7},
+    {0x9050E423UL, 0x377, 7},
+    {0x9050E423UL, 0x315, 7},
+    {0x9050E423UL, 0x2D2, 4},
+    {0x9050E423UL, 0x357, 4},
+    {0x9050E423UL, 0x22D, 3},
+    {0x9050E423UL, 0x335, 1},
+    {0x9126519BUL, 0x10D, 7},
+    {0x9126519BUL, 0x10C, 4},
+    {0x9126519BUL, 0x0EA, 1},
+    {0x9126519BUL, 0x12D, 1},
+    {0x91669175UL, 0x209, 7},
+    {0x91669175UL, 0x249, 7},
+    {0x92788D60UL, 0x20C, 7},
+    {0x92788D60UL, 0x335, 5},
+    {0x92788D60UL, 0x315, 5},
+    {0x92788D60UL, 0x2D2, 3},
+    {0x92788D60UL, 0x2D1, 1},
+    {0x92788D60UL, 0x2F3, 1},
+    {0x92EA7CB1UL, 0x12E, 7},
+    {0x9331F7CFUL, 0x22D, 7},
+    {0x9331F7CFUL, 0x24E, 6},
+    {0x9331F7CFUL, 0x357, 6},
+    {0x9331F7CFUL, 0x22E, 5},
+    {0x9331F7CFUL, 0x315, 4},
+    {0x9331F7CFUL, 0x335, 3},
+    {0x9331F7CFUL, 0x24F, 3},
+    {0x93565187UL, 0x2AE, 7},
+    {0x94394EB0UL, 0x0EA, 7},
+    {0x94394EB0UL, 0x10C, 4},
+    {0x94394EB0UL, 0x12E, 4},
+    {0x94394EB0UL, 0x1F3, 4},
+    {0x94394EB0UL, 0x12D, 3},
+    {0x94394EB0UL, 0x0CA, 2},
+    {0x9492E7CCUL, 0x2CF, 7},
+    {0x9492E7CCUL, 0x2EE, 7},
+    {0x94ABBF61UL, 0x2D1, 7},
+    {0x94ABBF61UL, 0x314, 7},
+    {0x94ABBF61UL, 0x2B1, 7},
+    {0x94ABBF61UL, 0x2F3, 7},
+    {0x95435C19UL, 0x20C, 7},
+    {0x95435C19UL, 0x315, 7},
+    {0x95435C19UL, 0x335, 4},
+    {0x95435C19UL, 0x2F3, 2},
+    {0x959A202AUL, 0x2F2, 7},
+    {0x959A202AUL, 0x2B1, 6},
+    {0x959A202AUL, 0x2D1, 5},
+    {0x959A202AUL, 0x2D2, 4},
+    {0x959A202AUL, 0x2B0, 1},
+    {0x95C9602FUL, 0x2AC, 7},
+    {0x964573BBUL, 0x22D, 7},
+    {0x964573BBUL, 0x20C, 3},
+    {0x964573BBUL, 0x314, 3},
+    {0x964573BBUL, 0x22E, 2},
+    {0x964573BBUL, 0x20D, 1},
+    {0x967D56B1UL, 0x088, 7},
+    {0x967D56B1UL, 0x14F, 7},
+    {0x967D56B1UL, 0x0A8, 6},
+    {0x967D56B1UL, 0x16F, 6},
+    {0x967D56B1UL, 0x14E, 4},
+    {0x967D56B1UL, 0x12E, 3},
+    {0x967D56B1UL, 0x12D, 1},
+    {0x97ACB2B5UL, 0x2F2, 7},
+    {0x982BEBEAUL, 0x2F2, 7},
+    {0x982BEBEAUL, 0x2B0, 2},
+    {0x989C79D9UL, 0x314, 7},
+    {0x98A1B108UL, 0x249, 7},
+    {0x98A1B108UL, 0x22A, 3},
+    {0x98DFD30EUL, 0x2D2, 7},
+    {0x98DFD30EUL, 0x2D1, 5},
+    {0x98DFD30EUL, 0x2F2, 5},
+    {0x98DFD30EUL, 0x2B1, 3},
+    {0x990BA5F5UL, 0x111, 7},
+    {0x990BA5F5UL, 0x130, 7},
+    {0x99D46F66UL, 0x377, 7},
+    {0x99D46F66UL, 0x2B0, 3},
+    {0x9A498D45UL, 0x0CD, 7},
+    {0x9A498D45UL, 0x0AE, 6},
+    {0x9BCC9D71UL, 0x16F, 7},
+    {0x9BCC9D71UL, 0x0A9, 5},
+    {0x9BCC9D71UL, 0x14E, 4},
+    {0x9BCC9D71UL, 0x14F, 4},
+    {0x9BCC9D71UL, 0x0C9, 1},
+    {0x9C0B53D9UL, 0x2F2, 7},
+    {0x9C0B53D9UL, 0x2B0, 6},
+    {0x9C0B53D9UL, 0x2D2, 5},
+    {0x9C0B53D9UL, 0x290, 4},
+    {0x9C0B53D9UL, 0x2F3, 4},
+    {0x9C1DC0B9UL, 0x0EA, 7},
+    {0x9C1DC0B9UL, 0x10D, 7},
+    {0x9C1DC0B9UL, 0x12D, 6},
+    {0x9C1DC0B9UL, 0x1F3, 6},
+    {0x9C1DC0B9UL, 0x10C, 5},
+    {0x9C1DC0B9UL, 0x0CA, 5},
+    {0x9C1DC0B9UL, 0x12E, 4},
+    {0x9C854051UL, 0x10C, 7},
+    {0x9C854051UL, 0x10D, 7},
+    {0x9C854051UL, 0x0A9, 5},
+    {0x9C854051UL, 0x14F, 5},
+    {0x9C854051UL, 0x1D1, 3},
+    {0x9C854051UL, 0x0C9, 1},
+    {0x9C88DB75UL, 0x315, 7},
+    {0x9C88DB75UL, 0x335, 1},
+    {0x9C992EDBUL, 0x20D, 7},
+    {0x9C992EDBUL, 0x2D2, 6},
+    {0x9C992EDBUL, 0x2D1, 5},
+    {0x9C992EDBUL, 0x3B8, 4},
+    {0x9C992EDBUL, 0x2F2, 2},
+    {0x9CA95E67UL, 0x314, 7},
+    {0x9CD75AB5UL, 0x336, 7},
+    {0x9CD75AB5UL, 0x2F3, 4},
+    {0x9CD75AB5UL, 0x356, 3},
+    {0x9CFA1E62UL, 0x2D1, 7},
+    {0x9CFA1E62UL, 0x2B1, 7},
+    {0x9CFA1E62UL, 0x2F2, 6},
+    {0x9CFA1E62UL, 0x2F3, 4},
+    {0x9CFA1E62UL, 0x2D2, 2},
+    {0x9D1B2EBBUL, 0x22A, 7},
+    {0x9D1B2EBBUL, 0x26A, 7},
+    {0x9D6B7501UL, 0x2B0, 7},
+    {0x9D6B7501UL, 0x2F3, 7},
+    {0x9D6B7501UL, 0x2D1, 2},
+    {0x9D6B7501UL, 0x3FA, 2},
+    {0x9DAE6C43UL, 0x290, 7},
+    {0x9DAE6C43UL, 0x2B0, 5},
+    {0x9DAE6C43UL, 0x2F2, 5},
+    {0x9DAE6C43UL, 0x356, 2},
+    {0x9DAE6C43UL, 0x2F3, 2},
+    {0x9DAE6C43UL, 0x336, 2},
+    {0x9DD5357CUL, 0x209, 7},
+    {0x9E5B0B2FUL, 0x372, 7},
+    {0x9E5B0B2FUL, 0x353, 2},
+    {0xA01744A0UL, 0x20C, 7},
+    {0xA07CDFFFUL, 0x315, 7},
+    {0xA07CDFFFUL, 0x377, 6},
+    {0xA07CDFFFUL, 0x20C, 4},
+    {0xA07CDFFFUL, 0x335, 4},
+    {0xA07CDFFFUL, 0x357, 4},
+    {0xA07CDFFFUL, 0x2D2, 1},
+    {0xA0896706UL, 0x2CD, 7},
+    {0xA0A1C89DUL, 0x153, 7},
+    {0xA0A1C89DUL, 0x172, 3},
+    {0xA0D67218UL, 0x2B0, 7},
+    {0xA0D67218UL, 0x2F2, 7},
+    {0xA0D67218UL, 0x290, 5},
+    {0xA0D67218UL, 0x2B1, 2},
+    {0xA0D67218UL, 0x2D2, 2},
+    {0xA0D67218UL, 0x2D1, 1},
+    {0xA151BA69UL, 0x088, 7},
+    {0xA151BA69UL, 0x0A8, 4},
+    {0xA151BA69UL, 0x14F, 4},
+    {0xA151BA69UL, 0x14E, 2},
+    {0xA151BA69UL, 0x12D, 1},
+    {0xA1E9682CUL, 0x315, 7},
+    {0xA1E9682CUL, 0x336, 4},
+    {0xA1E9682CUL, 0x356, 2},
+    {0xA28C707DUL, 0x1F3, 7},
+    {0xA28C707DUL, 0x1F2, 5},
+    {0xA28C707DUL, 0x0EB, 2},
+    {0xA2EC20E9UL, 0x10D, 7},
+    {0xA2EC20E9UL, 0x0EA, 5},
+    {0xA2EC20E9UL, 0x10C, 5},
+    {0xA2EC20E9UL, 0x0CA, 2},
+    {0xA35D9479UL, 0x290, 7},
+    {0xA35D9479UL, 0x2B0, 6},
+    {0xA35D9479UL, 0x2F2, 4},
+    {0xA35D9479UL, 0x22D, 1},
+    {0xA3CFE97BUL, 0x2D2, 7},
+    {0xA3CFE97BUL, 0x2F2, 6},
+    {0xA3CFE97BUL, 0x2D1, 5},
+    {0xA3CFE97BUL, 0x2F3, 5},
+    {0xA3CFE97BUL, 0x3B8, 3},
+    {0xA4069353UL, 0x22A, 7},
+    {0xA4069353UL, 0x26A, 6},
+    {0xA417CDEFUL, 0x2B0, 7},
+    {0xA417CDEFUL, 0x377, 7},
+    {0xA417CDEFUL, 0x2D2, 7},
+    {0xA417CDEFUL, 0x2D1, 4},
+    {0xA417CDEFUL, 0x2B1, 2},
+    {0xA417CDEFUL, 0x290, 1},
+    {0xA417CDEFUL, 0x357, 1},
+    {0xA42AC347UL, 0x20C, 7},
+    {0xA42AC347UL, 0x356, 4},
+    {0xA42AC347UL, 0x336, 4},
+    {0xA42AC347UL, 0x315, 2},
+    {0xA515D973UL, 0x2B1, 7},
+    {0xA515D973UL, 0x2D2, 6},
+    {0xA515D973UL, 0x2B0, 5},
+    {0xA515D973UL, 0x3FA, 2},
+    {0xA515D973UL, 0x290, 1},
+    {0xA536EB91UL, 0x356, 7},
+    {0xA536EB91UL, 0x336, 5},
+    {0xA536EB91UL, 0x357, 4},
+    {0xA536EB91UL, 0x2B0, 1},
+    {0xA5D8EFF0UL, 0x2CD, 7},
+    {0xA69DE807UL, 0x1D1, 7},
+    {0xA69DE807UL, 0x1D2, 7},
+    {0xA69DE807UL, 0x10D, 2},
+    {0xA69DE807UL, 0x14F, 2},
+    {0xA69DE807UL, 0x0C9, 1},
+    {0xA6C43928UL, 0x377, 7},
+    {0xA6C43928UL, 0x315, 5},
+    {0xA6C43928UL, 0x22D, 4},
+    {0xA6C43928UL, 0x335, 4},
+    {0xA6C43928UL, 0x357, 4},
+    {0xA7431B78UL, 0x2B0, 7},
+    {0xA7431B78UL, 0x2F3, 7},
+    {0xA7431B78UL, 0x2D1, 4},
+    {0xA7431B78UL, 0x3D9, 1},
+    {0xA78790D3UL, 0x356, 7},
+    {0xA78790D3UL, 0x2F3, 7},
+    {0xA78790D3UL, 0x2B0, 4},
+    {0xA78790D3UL, 0x290, 4},
+    {0xA78790D3UL, 0x2B1, 3},
+    {0xA78790D3UL, 0x2F2, 1},
+    {0xA79008EAUL, 0x2B0, 7},
+    {0xA79008EAUL, 0x2F2, 4},
+    {0xA79008EAUL, 0x2D2, 3},
+    {0xA79008EAUL, 0x2B1, 1},
+    {0xA79008EAUL, 0x2F3, 1},
+    {0xA7AEB8F0UL, 0x377, 7},
+    {0xA7AEB8F0UL, 0x2D2, 6},
+    {0xA7AEB8F0UL, 0x357, 3},
+    {0xA7AEB8F0UL, 0x2B0, 2},
+    {0xA7AEB8F0UL, 0x2D1, 2},
+    {0xA7AEB8F0UL, 0x2B1, 2},
+    {0xA8502A57UL, 0x2F3, 7},
+    {0xA8502A57UL, 0x2F2, 6},
+    {0xA8502A57UL, 0x2B1, 6},
+    {0xA8502A57UL, 0x2D2, 3},
+    {0xA85851F6UL, 0x2B0, 7},
+    {0xA85851F6UL, 0x290, 7},
+    {0xA85851F6UL, 0x2B1, 7},
+    {0xA85851F6UL, 0x2D2, 5},
+    {0xA85851F6UL, 0x3DA, 1},
+    {0xA87B6314UL, 0x377, 7},
+    {0xA87B6314UL, 0x357, 7},
+    {0xA87B6314UL, 0x356, 4},
+    {0xA87B6314UL, 0x2B1, 4},
+    {0xA87B6314UL, 0x336, 4},
+    {0xA87B6314UL, 0x2B0, 2},
+    {0xA88EAE8BUL, 0x16F, 7},
+    {0xA88EAE8BUL, 0x14F, 7},
+    {0xA88EAE8BUL, 0x10C, 3},
+    {0xA88EAE8BUL, 0x14E, 3},
+    {0xA88EAE8BUL, 0x12D, 1},
+    {0xA88EAE8BUL, 0x10D, 1},
+    {0xA88EAE8BUL, 0x12E, 1},
+    {0xA899674EUL, 0x314, 7},
+    {0xA899674EUL, 0x20C, 6},
+    {0xA899674EUL, 0x22D, 5},
+    {0xA899674EUL, 0x20D, 2},
+    {0xA8F2FC11UL, 0x357, 7},
+    {0xA8F2FC11UL, 0x377, 5},
+    {0xA8F2FC11UL, 0x20C, 4},
+    {0xA8F2FC11UL, 0x315, 4},
+    {0xA8F2FC11UL, 0x335, 2},
+    {0xA8F2FC11UL, 0x2D1, 1},
+    {0xA8F2FC11UL, 0x20D, 1},
+    {0xA9A6062FUL, 0x2D1, 7},
+    {0xA9A6062FUL, 0x2D2, 6},
+    {0xA9A6062FUL, 0x377, 5},
+    {0xA9A6062FUL, 0x357, 2},
+    {0xA9A6062FUL, 0x2B1, 1},
+    {0xA9B9EC13UL, 0x14E, 7},
+    {0xA9B9EC13UL, 0x088, 7},
+    {0xA9B9EC13UL, 0x16F, 6},
+    {0xA9B9EC13UL, 0x14F, 6},
+    {0xA9B9EC13UL, 0x0A8, 5},
+    {0xA9B9EC13UL, 0x12E, 5},
+    {0xA9B9EC13UL, 0x12D, 2},
+    {0xAA002C86UL, 0x357, 7},
+    {0xAA002C86UL, 0x2B0, 6},
+    {0xAA002C86UL, 0x290, 6},
+    {0xAA002C86UL, 0x2D1, 3},
+    {0xAA002C86UL, 0x377, 3},
+    {0xAA002C86UL, 0x24F, 2},
+    {0xAA002C86UL, 0x2B1, 2},
+    {0xAA0E93FDUL, 0x2B0, 7},
+    {0xAA0E93FDUL, 0x2F3, 7},
+    {0xAA0E93FDUL, 0x3D9, 4},
+    {0xAB27BF01UL, 0x2D1, 7},
+    {0xAB27BF01UL, 0x2B1, 7},
+    {0xAB27BF01UL, 0x2F3, 7},
+    {0xAB27BF01UL, 0x2B0, 6},
+    {0xAB27BF01UL, 0x3FB, 2},
+    {0xAB565D6EUL, 0x2EE, 7},
+    {0xAB75F2E8UL, 0x2D2, 7},
+    {0xAB75F2E8UL, 0x335, 6},
+    {0xAB75F2E8UL, 0x377, 5},
+    {0xAB75F2E8UL, 0x315, 5},
+    {0xAC81CF9EUL, 0x353, 7},
+    {0xACA4E0A9UL, 0x315, 7},
+    {0xACA4E0A9UL, 0x335, 6},
+    {0xACA4E0A9UL, 0x356, 3},
+    {0xACA4E0A9UL, 0x336, 1},
+    {0xACE071A9UL, 0x0A9, 7},
+    {0xACE071A9UL, 0x0C9, 5},
+    {0xACE071A9UL, 0x10C, 4},
+    {0xACE071A9UL, 0x14E, 4},
+    {0xACE071A9UL, 0x14F, 4},
+    {0xAD10035DUL, 0x153, 7},
+    {0xAD10035DUL, 0x172, 6},
+    {0xAD31577AUL, 0x20C, 7},
+    {0xAD31577AUL, 0x377, 6},
+    {0xAD31577AUL, 0x315, 4},
+    {0xAD31577AUL, 0x357, 4},
+    {0xAD31577AUL, 0x335, 1},
+    {0xAD3F313FUL, 0x2AE, 7},
+    {0xAD3F313FUL, 0x2CD, 7},
+    {0xAD5ACC25UL, 0x20D, 7},
+    {0xAD5ACC25UL, 0x20C, 5},
+    {0xAD5ACC25UL, 0x314, 5},
+    {0xAD5ACC25UL, 0x22D, 4},
+    {0xAD93813CUL, 0x2F3, 7},
+    {0xAD93813CUL, 0x2D1, 4},
+    {0xAD93813CUL, 0x2B1, 4},
+    {0xAD93813CUL, 0x2D2, 4},
+    {0xAD93813CUL, 0x314, 3},
+    {0xAE6AEDC3UL, 0x24B, 7},
+    {0xAE6AEDC3UL, 0x209, 6},
+    {0xAF31D580UL, 0x132, 7},
+    {0xAF31D580UL, 0x151, 7},
+    {0xAFE940E3UL, 0x330, 7},
+    {0xAFE940E3UL, 0x311, 6},
+    {0xB036AED5UL, 0x2D2, 7},
+    {0xB036AED5UL, 0x2F3, 6},
+    {0xB036AED5UL, 0x2F2, 5},
+    {0xB036AED5UL, 0x3B8, 5},
+    {0xB088A38BUL, 0x22D, 7},
+    {0xB088A38BUL, 0x26F, 1},
+    {0xB08C6F01UL, 0x2B0, 7},
+    {0xB08C6F01UL, 0x290, 5},
+    {0xB08C6F01UL, 0x2B1, 5},
+    {0xB08C6F01UL, 0x2D2, 5},
+    {0xB0A9B16EUL, 0x356, 7},
+    {0xB0A9B16EUL, 0x2B1, 7},
+    {0xB0A9B16EUL, 0x2B0, 4},
+    {0xB0A9B16EUL, 0x2F3, 4},
+    {0xB0A9B16EUL, 0x336, 4},
+    {0xB0A9B16EUL, 0x290, 3},
+    {0xB103F427UL, 0x2D2, 7},
+    {0xB103F427UL, 0x2F3, 5},
+    {0xB103F427UL, 0x2D1, 4},
+    {0xB103F427UL, 0x2B1, 4},
+    {0xB103F427UL, 0x20C, 2},
+    {0xB103F427UL, 0x2F2, 2},
+    {0xB133FB46UL, 0x20C, 7},
+    {0xB133FB46UL, 0x314, 7},
+    {0xB133FB46UL, 0x20D, 5},
+    {0xB2102F82UL, 0x22E, 7},
+    {0xB22DE753UL, 0x209, 7},
+    {0xB293A72EUL, 0x2F2, 7},
+    {0xB293A72EUL, 0x2D2, 3},
+    {0xB293A72EUL, 0x2B0, 2},
+    {0xB293A72EUL, 0x3FA, 2},
+    {0xB293A72EUL, 0x2F3, 2},
+    {0xB2FD5362UL, 0x2CF, 7},
+    {0xB2FD5362UL, 0x2EE, 2},
+    {0xB31D9F91UL, 0x20C, 7},
+    {0xB31D9F91UL, 0x22D, 1},
+    {0xB34413C5UL, 0x357, 7},
+    {0xB34413C5UL, 0x314, 6},
+    {0xB34413C5UL, 0x377, 6},
+    {0xB34413C5UL, 0x2D1, 5},
+    {0xB34413C5UL, 0x26F, 3},
+    {0xB34413C5UL, 0x2B1, 1},
+    {0xB3E51296UL, 0x1F2, 7},
+    {0xB3E51296UL, 0x0EA, 6},
+    {0xB3E51296UL, 0x10D, 6},
+    {0xB3E51296UL, 0x10C, 5},
+    {0xB3E51296UL, 0x0CA, 5},
+    {0xB3E51296UL, 0x12D, 4},
+    {0xB3E51296UL, 0x1F3, 4},
+    {0xB3E51296UL, 0x12E, 2},
+    {0xB3F381F6UL, 0x2F3, 7},
+    {0xB3F381F6UL, 0x2D1, 5},
+    {0xB3F381F6UL, 0x2B0, 4},
+    {0xB3F381F6UL, 0x2B1, 4},
+    {0xB3F381F6UL, 0x3FA, 2},
+    {0xB4344F5EUL, 0x10C, 7},
+    {0xB4344F5EUL, 0x0A9, 6},
+    {0xB4344F5EUL, 0x14F, 6},
+    {0xB4344F5EUL, 0x14E, 4},
+    {0xB4344F5EUL, 0x0C9, 2},
+    {0xB46CEF4FUL, 0x2AE, 7},
+    {0xB46CEF4FUL, 0x2CD, 7},
+    {0xB4BE15BCUL, 0x12D, 7},
+    {0xB4BE15BCUL, 0x0A8, 6},
+    {0xB4BE15BCUL, 0x088, 4},
+    {0xB4BE15BCUL, 0x14F, 4},
+    {0xB4BE15BCUL, 0x190, 4},
+    {0xB4C05F4CUL, 0x20C, 7},
+    {0xB4C05F4CUL, 0x2F3, 3},
+    {0xB4E7C493UL, 0x2F2, 7},
+    {0xB50E059DUL, 0x20C, 7},
+    {0xB50E059DUL, 0x315, 7},
+    {0xB50E059DUL, 0x2F2, 5},
+    {0xB50E059DUL, 0x335, 5},
+    {0xB50E059DUL, 0x20D, 5},
+    {0xB50E059DUL, 0x22E, 5},
+    {0xB50E059DUL, 0x336, 4},
+    {0xB6048D2EUL, 0x314, 7},
+    {0xB6DE34FAUL, 0x20C, 7},
+    {0xB6DE34FAUL, 0x22D, 7},
+    {0xB7723896UL, 0x12E, 7},
+    {0xB7E0C947UL, 0x2F3, 7},
+    {0xB7E0C947UL, 0x2D1, 4},
+    {0xB7E0C947UL, 0x2F2, 4},
+    {0xB7E0C947UL, 0x20D, 3},
+    {0xB7E0C947UL, 0x335, 1},
+    {0xB7E0C947UL, 0x2D2, 1},
+    {0xB7E0C947UL, 0x315, 1},
+    {0xB8024CEFUL, 0x2D1, 7},
+    {0xB8024CEFUL, 0x2B1, 7},
+    {0xB8024CEFUL, 0x2D2, 7},
+    {0xB8024CEFUL, 0x2B0, 5},
+    {0xB8024CEFUL, 0x290, 4},
+    {0xB8662AEAUL, 0x14E, 7},
+    {0xB8662AEAUL, 0x0A8, 4},
+    {0xB8662AEAUL, 0x12D, 4},
+    {0xB8662AEAUL, 0x12E, 4},
+    {0xB8662AEAUL, 0x14F, 1},
+    {0xB9016AFCUL, 0x2F2, 7},
+    {0xB9016AFCUL, 0x2D2, 7},
+    {0xB9016AFCUL, 0x20C, 6},
+    {0xB9016AFCUL, 0x2F3, 5},
+    {0xB9016AFCUL, 0x2D1, 1},
+    {0xB902FB63UL, 0x0CD, 7},
+    {0xB902FB63UL, 0x0AE, 6},
+    {0xB90FDE7CUL, 0x10C, 7},
+    {0xB90FDE7CUL, 0x0A9, 3},
+    {0xB90FDE7CUL, 0x0C9, 1},
+    {0xB90FDE7CUL, 0x14E, 1},
+    {0xB90FDE7CUL, 0x14F, 1},
+    {0xB985849EUL, 0x12D, 7},
+    {0xB985849EUL, 0x088, 7},
+    {0xB985849EUL, 0x14F, 5},
+    {0xB985849EUL, 0x0A8, 4},
+    {0xB985849EUL, 0x12E, 1},
+    {0xB9C1C5BBUL, 0x10D, 7},
+    {0xB9F06058UL, 0x336, 7},
+    {0xB9F06058UL, 0x20C, 5},
+    {0xB9F06058UL, 0x335, 5},
+    {0xB9F06058UL, 0x24E, 4},
+    {0xB9F06058UL, 0x20D, 4},
+    {0xB9F06058UL, 0x315, 4},
+    {0xB9F06058UL, 0x356, 2},
+    {0xBA40D3D3UL, 0x130, 7},
+    {0xBA40D3D3UL, 0x111, 5},
+    {0xBAF4821FUL, 0x2B0, 7},
+    {0xBAF4821FUL, 0x2F2, 7},
+    {0xBAF4821FUL, 0x2F3, 7},
+    {0xBAF4821FUL, 0x336, 7},
+    {0xBAF4821FUL, 0x22E, 6},
+    {0xBAF4821FUL, 0x356, 5},
+    {0xBB94A528UL, 0x2D1, 7},
+    {0xBB94A528UL, 0x2F2, 4},
+    {0xBB94A528UL, 0x2D2, 3},
+    {0xBBC3C087UL, 0x20D, 7},
+    {0xBBC3C087UL, 0x2F2, 5},
+    {0xBBC3C087UL, 0x2D1, 4},
+    {0xBBC3C087UL, 0x2F3, 4},
+    {0xBBC3C087UL, 0x2D2, 3},
+    {0xBBC3C087UL, 0x3B8, 2},
+    {0xBBDFAE0DUL, 0x10C, 7},
+    {0xBBDFAE0DUL, 0x12D, 5},
+    {0xBBDFAE0DUL, 0x1F2, 1},
+    {0xBBDFAE0DUL, 0x10D, 1},
+    {0xBC10C157UL, 0x14E, 7},
+    {0xBC10C157UL, 0x0A9, 7},
+    {0xBC10C157UL, 0x14F, 7},
+    {0xBC10C157UL, 0x0C9, 6},
+    {0xBC10C157UL, 0x10C, 5},
+    {0xBC10C157UL, 0x1B1, 4},
+    {0xBC31EBBDUL, 0x132, 7},
+    {0xBC31EBBDUL, 0x151, 7},
+    {0xBCD71772UL, 0x2F2, 7},
+    {0xBCD71772UL, 0x2B0, 6},
+    {0xBCD71772UL, 0x2D2, 6},
+    {0xBD0CD107UL, 0x2CD, 7},
+    {0xBD7B2650UL, 0x2D2, 7},
+    {0xBD7B2650UL, 0x2F3, 7},
+    {0xBD7B2650UL, 0x2B0, 4},
+    {0xBD7B2650UL, 0x2F2, 4},
+    {0xBD7B2650UL, 0x398, 4},
+    {0xBDC1E784UL, 0x2B1, 7},
+    {0xBDC1E784UL, 0x2B0, 6},
+    {0xBDC1E784UL, 0x2D1, 5},
+    {0xBDC1E784UL, 0x3FB, 1},
+    {0xBE8E813AUL, 0x377, 7},
+    {0xBE8E813AUL, 0x2B1, 7},
+    {0xBE8E813AUL, 0x2B0, 5},
+    {0xBE8E813AUL, 0x2D2, 4},
+    {0xBE8E813AUL, 0x357, 4},
+    {0xBE8E813AUL, 0x290, 2},
+    {0xBE8E813AUL, 0x2D1, 1},
+    {0xBEC810D4UL, 0x377, 7},
+    {0xBEC810D4UL, 0x335, 5},
+    {0xBEC810D4UL, 0x315, 5},
+    {0xBEC810D4UL, 0x357, 5},
+    {0xBEC810D4UL, 0x22D, 1},
+    {0xBF9C2C93UL, 0x314, 7},
+    {0xBF9C2C93UL, 0x336, 7},
+    {0xBF9C2C93UL, 0x356, 6},
+    {0xBFB16844UL, 0x2D1, 7},
+    {0xBFB16844UL, 0x2D2, 6},
+    {0xBFB16844UL, 0x2F2, 4},
+    {0xBFB16844UL, 0x2F3, 2},
+    {0xBFD10239UL, 0x377, 7},
+    {0xBFD10239UL, 0x2B1, 7},
+    {0xBFD10239UL, 0x2D1, 4},
+    {0xBFD10239UL, 0x2D2, 3},
+    {0xBFD10239UL, 0x290, 1},
+    {0xC1C84600UL, 0x228, 7},
+    {0xC1C84600UL, 0x24B, 7},
+    {0xC1D67492UL, 0x2B1, 7},
+    {0xC1D67492UL, 0x2F3, 5},
+    {0xC1D67492UL, 0x2B0, 4},
+    {0xC1D67492UL, 0x3B9, 2},
+    {0xC220FC5CUL, 0x22D, 7},
+    {0xC220FC5CUL, 0x2B0, 4},
+    {0xC220FC5CUL, 0x2F2, 4},
+    {0xC220FC5CUL, 0x356, 3},
+    {0xC220FC5CUL, 0x290, 1},
+    {0xC30BD04EUL, 0x16F, 7},
+    {0xC30BD04EUL, 0x088, 7},
+    {0xC30BD04EUL, 0x12D, 4},
+    {0xC30BD04EUL, 0x14F, 4},
+    {0xC30BD04EUL, 0x14E, 3},
+    {0xC30BD04EUL, 0x0A8, 1},
+    {0xC30BD04EUL, 0x12E, 1},
+    {0xC33FC853UL, 0x2AE, 7},
+    {0xC33FC853UL, 0x2CD, 7},
+    {0xC3759ABEUL, 0x377, 7},
+    {0xC3759ABEUL, 0x315, 4},
+    {0xC3759ABEUL, 0x335, 3},
+    {0xC3759ABEUL, 0x357, 3},
+    {0xC3759ABEUL, 0x22D, 1},
+    {0xC3A92EFEUL, 0x20C, 7},
+    {0xC3A92EFEUL, 0x377, 1},
+    {0xC3A92EFEUL, 0x20D, 1},
+    {0xC43873C7UL, 0x2CF, 7},
+    {0xC43873C7UL, 0x2EE, 7},
+    {0xC4479F91UL, 0x111, 7},
+    {0xC4479F91UL, 0x130, 7},
+    {0xC4613F8CUL, 0x14E, 7},
+    {0xC4613F8CUL, 0x088, 3},
+    {0xC4613F8CUL, 0x12D, 1},
+    {0xC4613F8CUL, 0x12E, 1},
+    {0xC4613F8CUL, 0x14F, 1},
+    {0xC4D7592BUL, 0x2D1, 7},
+    {0xC4E595FEUL, 0x132, 7},
+    {0xC4E595FEUL, 0x151, 7},
+    {0xC505EE05UL, 0x0CD, 7},
+    {0xC505EE05UL, 0x0AE, 6},
+    {0xC554F40BUL, 0x330, 7},
+    {0xC554F40BUL, 0x311, 6},
+    {0xC593E96AUL, 0x2D1, 7},
+    {0xC5A0F9FBUL, 0x2AC, 7},
+    {0xC5A0F9FBUL, 0x28D, 6},
+    {0xC5C7D601UL, 0x2B0, 7},
+    {0xC5C7D601UL, 0x2D2, 7},
+    {0xC5C7D601UL, 0x357, 7},
+    {0xC5C7D601UL, 0x2D1, 6},
+    {0xC5C7D601UL, 0x377, 5},
+    {0xC5C7D601UL, 0x2B1, 5},
+    {0xC5C7D601UL, 0x290, 4},
+    {0xC64E237EUL, 0x2B0, 7},
+    {0xC64E237EUL, 0x2D1, 3},
+    {0xC65DC541UL, 0x0A8, 7},
+    {0xC65DC541UL, 0x14E, 4},
+    {0xC65DC541UL, 0x088, 4},
+    {0xC65DC541UL, 0x12E, 4},
+    {0xC65DC541UL, 0x14F, 4},
+    {0xC66A8595UL, 0x20D, 7},
+    {0xC66A8595UL, 0x20C, 1},
+    {0xC66A8595UL, 0x2D1, 1},
+    {0xC66A8595UL, 0x377, 1},
+    {0xC6B631D5UL, 0x377, 7},
+    {0xC6B631D5UL, 0x315, 5},
+    {0xC6B631D5UL, 0x335, 1},
+    {0xC6B631D5UL, 0x357, 1},
+    {0xC78D0D62UL, 0x2AE, 7},
+    {0xC792CDDEUL, 0x22E, 7},
+    {0xC792CDDEUL, 0x2F3, 5},
+    {0xC792CDDEUL, 0x2F2, 4},
+    {0xC792CDDEUL, 0x356, 4},
+    {0xC792CDDEUL, 0x2B0, 2},
+    {0xC792CDDEUL, 0x336, 2},
+    {0xC7C3790CUL, 0x335, 7},
+    {0xC7C3790CUL, 0x20C, 4},
+    {0xC7C3790CUL, 0x24F, 4},
+    {0xC7C3790CUL, 0x24E, 1},
+    {0xC7C3790CUL, 0x356, 1},
+    {0xC7C3790CUL, 0x20D, 1},
+    {0xC7C3790CUL, 0x2F3, 1},
+    {0xC7C3790CUL, 0x315, 1},
+    {0xC7C3790CUL, 0x336, 1},
+    {0xC7D50912UL, 0x2AC, 7},
+    {0xC8406A54UL, 0x24E, 7},
+    {0xC8406A54UL, 0x2B0, 7},
+    {0xC8406A54UL, 0x2B1, 7},
+    {0xC8406A54UL, 0x2F3, 5},
+    {0xC8406A54UL, 0x356, 4},
+    {0xC8406A54UL, 0x336, 2},
+    {0xC842723EUL, 0x2B0, 7},
+    {0xC842723EUL, 0x2B1, 4},
+    {0xC842723EUL, 0x2F3, 4},
+    {0xC97574D4UL, 0x0EB, 7},
+    {0xC97574D4UL, 0x1F3, 6},
+    {0xC97DD526UL, 0x2F2, 7},
+    {0xC97DD526UL, 0x2D1, 6},
+    {0xC97DD526UL, 0x2F3, 6},
+    {0xC97DD526UL, 0x3B9, 4},
+    {0xC97DD526UL, 0x2D2, 2},
+    {0xC98CCB5DUL, 0x311, 7},
+    {0xC98CCB5DUL, 0x330, 4},
+    {0xC9F3C6AEUL, 0x0A9, 7},
+    {0xC9F3C6AEUL, 0x14F, 7},
+    {0xC9F3C6AEUL, 0x10C, 6},
+    {0xC9F3C6AEUL, 0x1D2, 6},
+    {0xC9F3C6AEUL, 0x0C9, 4},
+    {0xC9F3C6AEUL, 0x10D, 4},
+    {0xCA3782D7UL, 0x356, 7},
+    {0xCA3782D7UL, 0x2B0, 1},
+    {0xCA3782D7UL, 0x336, 1},
+    {0xCAE088D1UL, 0x2F2, 7},
+    {0xCAE088D1UL, 0x2D2, 7},
+    {0xCAE088D1UL, 0x314, 6},
+    {0xCAE088D1UL, 0x2B1, 6},
+    {0xCAE088D1UL, 0x2B0, 4},
+    {0xCAE088D1UL, 0x2F3, 1},
+    {0xCB0949DFUL, 0x20C, 7},
+    {0xCB0949DFUL, 0x22E, 5},
+    {0xCB0949DFUL, 0x314, 3},
+    {0xCB0949DFUL, 0x20D, 3},
+    {0xCB252F7EUL, 0x20C, 7},
+    {0xCB252F7EUL, 0x2D1, 6},
+    {0xCB252F7EUL, 0x314, 4},
+    {0xCB252F7EUL, 0x2F2, 3},
+    {0xCB252F7EUL, 0x2F3, 2},
+    {0xCB252F7EUL, 0x2B1, 1},
+    {0xCB7588E3UL, 0x153, 7},
+    {0xCB7588E3UL, 0x172, 3},
+    {0xCB8DA0F7UL, 0x2D1, 7},
+    {0xCB8DA0F7UL, 0x290, 7},
+    {0xCB8DA0F7UL, 0x2B1, 7},
+    {0xCB8DA0F7UL, 0x2B0, 5},
+    {0xCB8DA0F7UL, 0x3FA, 4},
+    {0xCB8DA0F7UL, 0x3DA, 2},
+    {0xCC1EFE07UL, 0x209, 7},
+    {0xCC2BC029UL, 0x2B0, 7},
+    {0xCC2BC029UL, 0x2F2, 7},
+    {0xCC2BC029UL, 0x2B1, 6},
+    {0xCC2BC029UL, 0x2D1, 1},
+    {0xCC2BC029UL, 0x2D2, 1},
+    {0xCC6A6BFFUL, 0x0EB, 7},
+    {0xCC6A6BFFUL, 0x10D, 7},
+    {0xCC6A6BFFUL, 0x14E, 6},
+    {0xCC6A6BFFUL, 0x10C, 4},
+    {0xCC6A6BFFUL, 0x12D, 1},
+    {0xCC6A6BFFUL, 0x12E, 1},
+    {0xCCF3D722UL, 0x2D1, 7},
+    {0xCD6C1899UL, 0x2CF, 7},
+    {0xCE173AE4UL, 0x2B0, 7},
+    {0xCE173AE4UL, 0x356, 7},
+    {0xCE173AE4UL, 0x377, 7},
+    {0xCE173AE4UL, 0x22E, 6},
+    {0xCE173AE4UL, 0x357, 5},
+    {0xCE173AE4UL, 0x336, 4},
+    {0xCE4E0B9CUL, 0x2F3, 7},
+    {0xCE4E0B9CUL, 0x2B1, 4},
+    {0xCE4E0B9CUL, 0x2B0, 2},
+    {0xCE4E0B9CUL, 0x2D1, 2},
+    {0xCE63FF39UL, 0x2B0, 7},
+    {0xCE63FF39UL, 0x2D1, 6},
+    {0xCE7DCDABUL, 0x22E, 7},
+    {0xCE7DCDABUL, 0x24E, 4},
+    {0xCE7DCDABUL, 0x22D, 3},
+    {0xCF34B704UL, 0x20C, 7},
+    {0xCF34B704UL, 0x20D, 6},
+    {0xCF34B704UL, 0x2F3, 5},
+    {0xCF34B704UL, 0x315, 5},
+    {0xCF34B704UL, 0x335, 4},
+    {0xCF34B704UL, 0x2D2, 3},
+    {0xCF34B704UL, 0x2D1, 1},
+    {0xCF34B704UL, 0x2F2, 1},
+    {0xCF655B18UL, 0x2AE, 7},
+    {0xCF655B18UL, 0x2CD, 7},
+    {0xCF91379CUL, 0x2F2, 7},
+    {0xCF91379CUL, 0x2B0, 6},
+    {0xCF91379CUL, 0x22E, 6},
+    {0xCF91379CUL, 0x336, 5},
+    {0xCF91379CUL, 0x356, 4},
+    {0xCF91379CUL, 0x2F3, 4},
+    {0xCFC38D91UL, 0x2B0, 7},
+    {0xCFC38D91UL, 0x2B1, 7},
+    {0xCFC38D91UL, 0x356, 4},
+    {0xCFC38D91UL, 0x2F2, 3},
+    {0xD0034F81UL, 0x20C, 7},
+    {0xD0034F81UL, 0x315, 7},
+    {0xD0034F81UL, 0x335, 5},
+    {0xD0034F81UL, 0x356, 5},
+    {0xD0034F81UL, 0x2F3, 2},
+    {0xD0034F81UL, 0x336, 1},
+    {0xD08C06E8UL, 0x28D, 7},
+    {0xD08C06E8UL, 0x2AC, 7},
+    {0xD16D9250UL, 0x10C, 7},
+    {0xD16D9250UL, 0x1F3, 6},
+    {0xD16D9250UL, 0x0EB, 4},
+    {0xD16D9250UL, 0x1F2, 2},
+    {0xD171FCDAUL, 0x2F2, 7},
+    {0xD171FCDAUL, 0x2F3, 5},
+    {0xD171FCDAUL, 0x3B9, 5},
+    {0xD171FCDAUL, 0x2D2, 4},
+    {0xD171FCDAUL, 0x2D1, 3},
+    {0xD1DA59B7UL, 0x330, 7},
+    {0xD1DA59B7UL, 0x311, 5},
+    {0xD3599E00UL, 0x2F3, 7},
+    {0xD3599E00UL, 0x2B0, 4},
+    {0xD3599E00UL, 0x2B1, 2},
+    {0xD36F976CUL, 0x22D, 7},
+    {0xD36F976CUL, 0x2F2, 3},
+    {0xD36F976CUL, 0x22E, 3},
+    {0xD3B26A94UL, 0x12E, 7},
+    {0xD3B26A94UL, 0x14F, 7},
+    {0xD3B26A94UL, 0x0A8, 6},
+    {0xD3B26A94UL, 0x088, 4},
+    {0xD3B26A94UL, 0x1B0, 3},
+    {0xD3B26A94UL, 0x14E, 1},
+    {0xD3B356A1UL, 0x20C, 7},
+    {0xD3B356A1UL, 0x2F2, 7},
+    {0xD3B356A1UL, 0x2D2, 6},
+    {0xD3B356A1UL, 0x2F3, 5},
+    {0xD3B356A1UL, 0x2D1, 1},
+    {0xD3B356A1UL, 0x20D, 1},
+    {0xD427E9D5UL, 0x2D1, 7},
+    {0xD481D3DEUL, 0x351, 7},
+    {0xD481D3DEUL, 0x332, 4},
+    {0xD4FA8B81UL, 0x22E, 7},
+    {0xD4FA8B81UL, 0x2F3, 2},
+    {0xD4FFFEDEUL, 0x2F2, 7},
+    {0xD4FFFEDEUL, 0x2D2, 6},
+    {0xD4FFFEDEUL, 0x2B0, 5},
+    {0xD4FFFEDEUL, 0x2B1, 5},
+    {0xD5327E44UL, 0x10C, 7},
+    {0xD5327E44UL, 0x0EA, 5},
+    {0xD5327E44UL, 0x12D, 4},
+    {0xD5327E44UL, 0x10D, 4},
+    {0xD5327E44UL, 0x0CA, 2},
+    {0xD5B8266EUL, 0x2EE, 7},
+    {0xD5B8266EUL, 0x2CF, 3},
+    {0xD5BCEAE4UL, 0x356, 7},
+    {0xD5BCEAE4UL, 0x2B0, 6},
+    {0xD5BCEAE4UL, 0x377, 6},
+    {0xD5BCEAE4UL, 0x357, 4},
+    {0xD6652B2FUL, 0x2F2, 7},
+    {0xD6652B2FUL, 0x2B0, 6},
+    {0xD6652B2FUL, 0x2D2, 5},
+    {0xD69A356BUL, 0x2F3, 7},
+    {0xD69A356BUL, 0x2B0, 4},
+    {0xD69A356BUL, 0x2D1, 4},
+    {0xD69A356BUL, 0x2B1, 3},
+    {0xD6AD75BFUL, 0x14F, 7},
+    {0xD6C6EEE0UL, 0x1B4, 7},
+    {0xD7B165EFUL, 0x2CD, 7},
+    {0xD7C91A0DUL, 0x2B0, 7},
+    {0xD7C91A0DUL, 0x2F2, 4},
+    {0xD84F6F3FUL, 0x2CF, 7},
+    {0xD84F6F3FUL, 0x2EE, 4},
+    {0xD8F16261UL, 0x356, 7},
+    {0xD8F16261UL, 0x377, 5},
+    {0xD94B4041UL, 0x22E, 7},
+    {0xD94B4041UL, 0x2F2, 3},
+    {0xD94B4041UL, 0x2B0, 1},
+    {0xD94B4041UL, 0x290, 1},
+    {0xD94B4041UL, 0x2F3, 1},
+    {0xD9C46FFCUL, 0x357, 7},
+    {0xD9C46FFCUL, 0x335, 6},
+    {0xD9C46FFCUL, 0x315, 6},
+    {0xD9C46FFCUL, 0x377, 4},
+    {0xD9C46FFCUL, 0x22E, 4},
+    {0xD9C46FFCUL, 0x290, 4},
+    {0xD9DD1DECUL, 0x0EE, 7},
+    {0xD9DD1DECUL, 0x0CF, 6},
+    {0xD9EA4112UL, 0x10C, 7},
+    {0xD9EA4112UL, 0x10D, 5},
+    {0xD9EA4112UL, 0x1D2, 5},
+    {0xD9EA4112UL, 0x16F, 2},
+    {0xDA754AE9UL, 0x12E, 7},
+    {0xDA754AE9UL, 0x0A8, 3},
+    {0xDA754AE9UL, 0x088, 3},
+    {0xDA754AE9UL, 0x1B1, 1},
+    {0xDA849288UL, 0x2D2, 7},
+    {0xDA849288UL, 0x3B9, 7},
+    {0xDA849288UL, 0x2F2, 6},
+    {0xDA849288UL, 0x2F3, 4},
+    {0xDB55EED3UL, 0x290, 7},
+    {0xDB55EED3UL, 0x2D2, 6},
+    {0xDB55EED3UL, 0x2F3, 4},
+    {0xDB55EED3UL, 0x315, 4},
+    {0xDB55EED3UL, 0x2F2, 3},
+    {0xDB55EED3UL, 0x335, 3},
+    {0xDB55EED3UL, 0x2D1, 1},
+    {0xDB89EA3AUL, 0x2F2, 7},
+    {0xDBA9AD96UL, 0x315, 7},
+    {0xDBA9AD96UL, 0x2F2, 6},
+    {0xDBA9AD96UL, 0x2D2, 6},
+    {0xDBA9AD96UL, 0x335, 4},
+    {0xDBA9AD96UL, 0x2F3, 3},
+    {0xDBB1C87AUL, 0x2F3, 7},
+    {0xDBB1C87AUL, 0x2D1, 6},
+    {0xDBB1C87AUL, 0x2D2, 6},
+    {0xDBB1C87AUL, 0x20C, 5},
+    {0xDBB1C87AUL, 0x2F2, 4},
+    {0xDBB1C87AUL, 0x2B1, 3},
+    {0xDBEBF6A4UL, 0x2AE, 7},
+    {0xDBEBF6A4UL, 0x2CD, 5},
+    {0xDC8B3C3FUL, 0x1F3, 7},
+    {0xDC8B3C3FUL, 0x1F2, 6},
+    {0xDC8B3C3FUL, 0x0EA, 4},
+    {0xDC8B3C3FUL, 0x12D, 4},
+    {0xDC8B3C3FUL, 0x0CA, 4},
+    {0xDC8B3C3FUL, 0x12E, 2},
+    {0xDC8B3C3FUL, 0x10D, 1},
+    {0xDCDB70D7UL, 0x20C, 7},
+    {0xDCDB70D7UL, 0x377, 7},
+    {0xDCDB70D7UL, 0x315, 4},
+    {0xDCDB70D7UL, 0x335, 2},
+    {0xDCDB70D7UL, 0x2D1, 1},
+    {0xDCDB70D7UL, 0x357, 1},
+    {0xDD32C90AUL, 0x377, 7},
+    {0xDD32C90AUL, 0x356, 6},
+    {0xDD32C90AUL, 0x2B0, 1},
+    {0xDD32C90AUL, 0x336, 1},
+    {0xDD32C90AUL, 0x357, 1},
+    {0xDD4E9B90UL, 0x12D, 7},
+    {0xDD4E9B90UL, 0x16F, 7},
+    {0xDD4E9B90UL, 0x14F, 7},
+    {0xDD4E9B90UL, 0x10C, 1},
+    {0xDD4E9B90UL, 0x14E, 1},
+    {0xDD4E9B90UL, 0x10D, 1},
+    {0xDD4E9B90UL, 0x12E, 1},
+    {0xDDDC6A41UL, 0x2D1, 7},
+    {0xDDDC6A41UL, 0x314, 7},
+    {0xDDDC6A41UL, 0x2B1, 4},
+    {0xDDE9E197UL, 0x0AC, 7},
+    {0xDDE9E197UL, 0x08D, 4},
+    {0xDDF05306UL, 0x22D, 7},
+    {0xDDF05306UL, 0x22E, 7},
+    {0xDDF05306UL, 0x2F2, 5},
+    {0xDDF05306UL, 0x335, 5},
+    {0xDDF05306UL, 0x2D2, 5},
+    {0xDDF05306UL, 0x315, 5},
+    {0xDDF05306UL, 0x2F3, 2},
+    {0xDE726311UL, 0x2F3, 7},
+    {0xDE726311UL, 0x20C, 6},
+    {0xDE726311UL, 0x2D2, 3},
+    {0xDE726311UL, 0x2D1, 1},
+    {0xDE89FBB6UL, 0x0A8, 7},
+    {0xDE89FBB6UL, 0x12E, 7},
+    {0xDE89FBB6UL, 0x088, 6},
+    {0xDE89FBB6UL, 0x14F, 4},
+    {0xDE89FBB6UL, 0x14E, 1},
+    {0xDE9A1D89UL, 0x2F3, 7},
+    {0xDE9A1D89UL, 0x2B0, 6},
+    {0xDE9A1D89UL, 0x2B1, 1},
+    {0xDE9A1D89UL, 0x3DA, 1},
+    {0xDF1EC03AUL, 0x24B, 7},
+    {0xE05F9226UL, 0x2B0, 7},
+    {0xE05F9226UL, 0x377, 3},
+    {0xE05F9226UL, 0x2D1, 1},
+    {0xE05F9226UL, 0x2D2, 1},
+    {0xE05F9226UL, 0x357, 1},
+    {0xE069E5B3UL, 0x356, 7},
+    {0xE069E5B3UL, 0x2F3, 6},
+    {0xE069E5B3UL, 0x336, 6},
+    {0xE069E5B3UL, 0x24E, 5},
+    {0xE069E5B3UL, 0x2B0, 3},
+    {0xE069E5B3UL, 0x2B1, 3},
+    {0xE08FCE13UL, 0x377, 7},
+    {0xE08FCE13UL, 0x356, 6},
+    {0xE08FCE13UL, 0x22E, 6},
+    {0xE08FCE13UL, 0x2B0, 4},
+    {0xE08FCE13UL, 0x22D, 3},
+    {0xE08FCE13UL, 0x336, 3},
+    {0xE08FCE13UL, 0x357, 2},
+    {0xE0E258D8UL, 0x20C, 7},
+    {0xE0E258D8UL, 0x20D, 1},
+    {0xE1001125UL, 0x2B0, 7},
+    {0xE1001125UL, 0x377, 3},
+    {0xE1001125UL, 0x290, 1},
+    {0xE1001125UL, 0x2B1, 1},
+    {0xE1001125UL, 0x2D2, 1},
+    {0xE1001125UL, 0x357, 1},
+    {0xE19B2D16UL, 0x2F2, 7},
+    {0xE19B2D16UL, 0x2D2, 7},
+    {0xE19B2D16UL, 0x2B0, 6},
+    {0xE1B6D9B3UL, 0x2B0, 7},
+    {0xE1B6D9B3UL, 0x2F3, 6},
+    {0xE1B6D9B3UL, 0x2D2, 4},
+    {0xE209F50AUL, 0x2F2, 7},
+    {0xE209F50AUL, 0x2D2, 7},
+    {0xE209F50AUL, 0x2F3, 1},
+    {0xE21E4F3CUL, 0x356, 7},
+    {0xE21E4F3CUL, 0x2F2, 4},
+    {0xE21E4F3CUL, 0x2B1, 3},
+    {0xE21E4F3CUL, 0x2F3, 3},
+    {0xE21E4F3CUL, 0x336, 3},
+    {0xE21E4F3CUL, 0x2B0, 1},
+    {0xE2B334DEUL, 0x2B0, 7},
+    {0xE2B334DEUL, 0x2F2, 7},
+    {0xE2B334DEUL, 0x2D2, 7},
+    {0xE2B334DEUL, 0x2D1, 1},
+    {0xE2B334DEUL, 0x2B1, 1},
+    {0xE3D66759UL, 0x2D1, 7},
+    {0xE3D66759UL, 0x2B0, 2},
+    {0xE3E62C28UL, 0x209, 7},
+    {0xE44D5098UL, 0x2F2, 7},
+    {0xE47572D8UL, 0x2B0, 7},
+    {0xE47572D8UL, 0x2D2, 4},
+    {0xE47572D8UL, 0x2F2, 3},
+    {0xE47572D8UL, 0x2F3, 2},
+    {0xE48DFFDFUL, 0x10D, 7},
+    {0xE4B220A7UL, 0x357, 7},
+    {0xE4B220A7UL, 0x2B0, 5},
+    {0xE4B220A7UL, 0x2D1, 5},
+    {0xE4B220A7UL, 0x377, 5},
+    {0xE4B220A7UL, 0x2B1, 2},
+    {0xE4B220A7UL, 0x2D2, 2},
+    {0xE521F3B3UL, 0x20D, 7},
+    {0xE521F3B3UL, 0x20C, 4},
+    {0xE521F3B3UL, 0x314, 1},
+    {0xE68FFAE3UL, 0x2D2, 7},
+    {0xE68FFAE3UL, 0x2F2, 2},
+    {0xE692A85CUL, 0x249, 7},
+    {0xE692A85CUL, 0x228, 4},
+    {0xE6939469UL, 0x10C, 7},
+    {0xE6939469UL, 0x10D, 5},
+    {0xE6939469UL, 0x12D, 4},
+    {0xE6939469UL, 0x1F2, 4},
+    {0xE6939469UL, 0x0CA, 4},
+    {0xE6939469UL, 0x1F3, 4},
+    {0xE6939469UL, 0x0EA, 2},
+    {0xE6939469UL, 0x12E, 2},
+    {0xE6D89F4CUL, 0x2D1, 7},
+    {0xE70CE9B7UL, 0x111, 7},
+    {0xE70CE9B7UL, 0x130, 4},
+    {0xE77305E1UL, 0x2EE, 7},
+    {0xE79C2F0DUL, 0x314, 7},
+    {0xE79C2F0DUL, 0x20C, 1},
+    {0xE7A0EA30UL, 0x2AC, 7},
+    {0xE7A0EA30UL, 0x28D, 6},
+    {0xE7B8B87BUL, 0x22D, 7},
+    {0xE7B8B87BUL, 0x22E, 7},
+    {0xE7B8B87BUL, 0x2B0, 5},
+    {0xE7B8B87BUL, 0x2F2, 5},
+    {0xE7B8B87BUL, 0x336, 5},
+    {0xE7B8B87BUL, 0x356, 3},
+    {0xE7E521D1UL, 0x2B1, 7},
+    {0xE7E521D1UL, 0x2F2, 4},
+    {0xE7E521D1UL, 0x2D2, 4},
+    {0xE7E521D1UL, 0x2F3, 4},
+    {0xE7E521D1UL, 0x3B9, 4},
+    {0xE7E521D1UL, 0x2D1, 3},
+    {0xE7F3AA35UL, 0x2B1, 7},
+    {0xE7F3AA35UL, 0x2D1, 4},
+    {0xE804DAAEUL, 0x356, 7},
+    {0xE804DAAEUL, 0x2B0, 6},
+    {0xE804DAAEUL, 0x2F2, 6},
+    {0xE804DAAEUL, 0x290, 6},
+    {0xE804DAAEUL, 0x2B1, 5},
+    {0xE804DAAEUL, 0x2F3, 4},
+    {0xE804DAAEUL, 0x336, 4},
+    {0xE8423FF9UL, 0x20C, 7},
+    {0xE8423FF9UL, 0x335, 4},
+    {0xE8423FF9UL, 0x315, 4},
+    {0xE8423FF9UL, 0x336, 3},
+    {0xE850307CUL, 0x2CD, 7},
+    {0xE850307CUL, 0x2AE, 6},
+    {0xE86A1FF1UL, 0x24E, 7},
+    {0xE86A1FF1UL, 0x2B0, 5},
+    {0xE86A1FF1UL, 0x336, 5},
+    {0xE86A1FF1UL, 0x356, 2},
+    {0xE86A1FF1UL, 0x2B1, 2},
+    {0xE86A1FF1UL, 0x2F3, 2},
+    {0xE86E5958UL, 0x2F2, 7},
+    {0xE86E5958UL, 0x20C, 6},
+    {0xE86E5958UL, 0x335, 5},
+    {0xE86E5958UL, 0x2F3, 5},
+    {0xE86E5958UL, 0x2D1, 4},
+    {0xE86E5958UL, 0x315, 4},
+    {0xE86E5958UL, 0x20D, 3},
+    {0xE86E5958UL, 0x2D2, 1},
+    {0xE9ABFEF7UL, 0x2F2, 7},
+    {0xE9ABFEF7UL, 0x315, 7},
+    {0xE9ABFEF7UL, 0x2D1, 5},
+    {0xE9ABFEF7UL, 0x335, 5},
+    {0xE9ABFEF7UL, 0x290, 5},
+    {0xE9ABFEF7UL, 0x2D2, 5},
+    {0xEA3E02F2UL, 0x1F3, 7},
+    {0xEA3E02F2UL, 0x0EB, 6},
+    {0xEA3E02F2UL, 0x10D, 3},
+    {0xEA5187CAUL, 0x1D1, 7},
+    {0xEA582BD4UL, 0x2AC, 7},
+    {0xEA582BD4UL, 0x28D, 4},
+    {0xEBA9397EUL, 0x2D1, 7},
+    {0xEBA9397EUL, 0x2B1, 7},
+    {0xEBA9397EUL, 0x2D2, 7},
+    {0xEBA9397EUL, 0x2B0, 2},
+    {0xEC5B5654UL, 0x228, 7},
+    {0xEC5B5654UL, 0x26A, 7},
+    {0xEC7FC122UL, 0x20C, 7},
+    {0xEC7FC122UL, 0x314, 5},
+    {0xEC7FC122UL, 0x20D, 5},
+    {0xEC7FC122UL, 0x2F3, 2},
+    {0xECB1DAE5UL, 0x377, 7},
+    {0xECB1DAE5UL, 0x2B0, 6},
+    {0xECB1DAE5UL, 0x2D2, 6},
+    {0xECB1DAE5UL, 0x357, 6},
+    {0xECB1DAE5UL, 0x2D1, 3},
+    {0xECB1DAE5UL, 0x2B1, 3},
+    {0xED6548D3UL, 0x2AE, 7},
+    {0xEDC4048BUL, 0x22A, 7},
+    {0xEDC4048BUL, 0x24B, 6},
+    {0xEDC499EFUL, 0x356, 7},
+    {0xEDC499EFUL, 0x357, 7},
+    {0xEDC499EFUL, 0x336, 5},
+    {0xEDC499EFUL, 0x22D, 3},
+    {0xEDC499EFUL, 0x22E, 3},
+    {0xEDC499EFUL, 0x2B0, 1},
+    {0xEDD82E73UL, 0x356, 7},
+    {0xEDD82E73UL, 0x2B0, 5},
+    {0xEDD82E73UL, 0x2F3, 5},
+    {0xEDD82E73UL, 0x24E, 4},
+    {0xEDD82E73UL, 0x336, 3},
+    {0xEDD82E73UL, 0x2B1, 2},
+    {0xEDEE59E6UL, 0x377, 7},
+    {0xEDEE59E6UL, 0x357, 3},
+    {0xEDEE59E6UL, 0x2B0, 2},
+    {0xEDEE59E6UL, 0x2D1, 2},
+    {0xEE67AC99UL, 0x2B0, 7},
+    {0xEE67AC99UL, 0x2F3, 5},
+    {0xEE67AC99UL, 0x2D1, 2},
+    {0xEEA928F2UL, 0x1F3, 7},
+    {0xEEA928F2UL, 0x12D, 4},
+    {0xEEA928F2UL, 0x0EB, 3},
+    {0xEEA928F2UL, 0x10C, 1},
+    {0xEF1BFC4FUL, 0x2D1, 7},
+    {0xEF1BFC4FUL, 0x2F2, 4},
+    {0xEF1BFC4FUL, 0x2D2, 4},
+    {0xEF1BFC4FUL, 0x2F3, 4},
+    {0xEF447D8FUL, 0x2F2, 7},
+    {0xEF447D8FUL, 0x2D2, 6},
+    {0xEF447D8FUL, 0x2B0, 5},
+    {0xEF447D8FUL, 0x2F3, 2},
+    {0xEF558821UL, 0x209, 7},
+    {0xEF558821UL, 0x249, 7},
+    {0xEFB16906UL, 0x2CF, 7},
+    {0xEFB16906UL, 0x2EE, 6},
+    {0xEFFEBC5BUL, 0x2B0, 7},
+    {0xEFFEBC5BUL, 0x2D1, 3},
+    {0xEFFEBC5BUL, 0x2F2, 3},
+    {0xF098A86DUL, 0x314, 7},
+    {0xF098A86DUL, 0x2D1, 6},
+    {0xF098A86DUL, 0x2F2, 6},
+    {0xF098A86DUL, 0x2D2, 6},
+    {0xF098A86DUL, 0x2F3, 6},
+    {0xF0BFEBCCUL, 0x2F3, 7},
+    {0xF0BFEBCCUL, 0x2B0, 3},
+    {0xF0BFEBCCUL, 0x290, 1},
+    {0xF21C05E0UL, 0x228, 7},
+    {0xF21C05E0UL, 0x22A, 4},
+    {0xF2438420UL, 0x20C, 7},
+    {0xF2438420UL, 0x335, 6},
+    {0xF2438420UL, 0x377, 5},
+    {0xF2438420UL, 0x315, 5},
+    {0xF2438420UL, 0x357, 5},
+    {0xF2438420UL, 0x2D1, 2},
+    {0xF285B93DUL, 0x0EA, 7},
+    {0xF285B93DUL, 0x0CA, 4},
+    {0xF285B93DUL, 0x10D, 4},
+    {0xF285B93DUL, 0x12D, 3},
+    {0xF285B93DUL, 0x1D2, 3},
+    {0xF285B93DUL, 0x10C, 1},
+    {0xF37D0789UL, 0x2D1, 7},
+    {0xF37D0789UL, 0x2B1, 7},
+    {0xF37D0789UL, 0x2D2, 6},
+    {0xF37D0789UL, 0x2B0, 4},
+    {0xF3802271UL, 0x335, 7},
+    {0xF3802271UL, 0x2D2, 6},
+    {0xF3802271UL, 0x315, 6},
+    {0xF3802271UL, 0x2D1, 4},
+    {0xF3802271UL, 0x2F2, 4},
+    {0xF3802271UL, 0x290, 4},
+    {0xF3802271UL, 0x2F3, 4},
+    {0xF3D633F3UL, 0x356, 7},
+    {0xF3D633F3UL, 0x315, 5},
+    {0xF3D633F3UL, 0x336, 5},
+    {0xF3D633F3UL, 0x335, 4},
+    {0xF3D633F3UL, 0x20C, 1},
+    {0xF3D633F3UL, 0x2F3, 1},
+    {0xF57C40A7UL, 0x290, 7},
+    {0xF57C40A7UL, 0x2B0, 3},
+    {0xF57C40A7UL, 0x2F3, 1},
+    {0xF62B1286UL, 0x2F2, 7},
+    {0xF62B1286UL, 0x3B9, 6},
+    {0xF62B1286UL, 0x2D1, 2},
+    {0xF62B1286UL, 0x2B1, 2},
+    {0xF62B1286UL, 0x2D2, 2},
+    {0xF62B1286UL, 0x2F3, 2},
+    {0xF62B1286UL, 0x20D, 1},
+    {0xF6377C0CUL, 0x1D2, 7},
+    {0xF6377C0CUL, 0x10C, 4},
+    {0xF6790862UL, 0x12D, 7},
+    {0xF6790862UL, 0x0EA, 5},
+    {0xF6790862UL, 0x1D1, 5},
+    {0xF6790862UL, 0x10D, 4},
+    {0xF6790862UL, 0x10C, 2},
+    {0xF6790862UL, 0x0CA, 2},
+    {0xF6B3926EUL, 0x24E, 7},
+    {0xF6B3926EUL, 0x2B0, 7},
+    {0xF6B3926EUL, 0x2B1, 4},
+    {0xF6B3926EUL, 0x2F3, 4},
+    {0xF7031ACBUL, 0x335, 7},
+    {0xF7031ACBUL, 0x315, 7},
+    {0xF7031ACBUL, 0x20C, 6},
+    {0xF7031ACBUL, 0x357, 5},
+    {0xF7031ACBUL, 0x24F, 3},
+    {0xF7031ACBUL, 0x377, 1},
+    {0xF72A82ACUL, 0x2B0, 7},
+    {0xF72A82ACUL, 0x2F2, 7},
+    {0xF72A82ACUL, 0x2D1, 5},
+    {0xF72A82ACUL, 0x2D2, 4},
+    {0xF72A82ACUL, 0x3DA, 2},
+    {0xF7503C1AUL, 0x22D, 7},
+    {0xF7503C1AUL, 0x290, 7},
+    {0xF7503C1AUL, 0x315, 5},
+    {0xF7503C1AUL, 0x356, 2},
+    {0xF7503C1AUL, 0x22E, 2},
+    {0xF7503C1AUL, 0x2F3, 2},
+    {0xF75C9B0BUL, 0x315, 7},
+    {0xF75C9B0BUL, 0x377, 6},
+    {0xF75C9B0BUL, 0x22E, 5},
+    {0xF75C9B0BUL, 0x335, 3},
+    {0xF7CAA5F8UL, 0x351, 7},
+    {0xF8DC6BAAUL, 0x2D2, 7},
+    {0xF8DC6BAAUL, 0x2B1, 4},
+    {0xF8DC6BAAUL, 0x377, 3},
+    {0xF8DC6BAAUL, 0x2B0, 1},
+    {0xF8DC6BAAUL, 0x2D1, 1},
+    {0xF8E2DBB0UL, 0x314, 7},
+    {0xF8E2DBB0UL, 0x2D1, 6},
+    {0xF8E2DBB0UL, 0x2F2, 6},
+    {0xF8E2DBB0UL, 0x2D2, 6},
+    {0xF8E2DBB0UL, 0x2F3, 6},
+    {0xF8E2DBB0UL, 0x2B1, 3},
+    {0xF9226351UL, 0x2CD, 7},
+    {0xF94AA937UL, 0x377, 7},
+    {0xF94AA937UL, 0x357, 5},
+    {0xF94AA937UL, 0x335, 2},
+    {0xFA0A8CA3UL, 0x372, 7},
+    {0xFA0A8CA3UL, 0x353, 4},
+    {0xFA11138EUL, 0x315, 7},
+    {0xFA11138EUL, 0x357, 7},
+    {0xFA11138EUL, 0x24E, 6},
+    {0xFA11138EUL, 0x22E, 5},
+    {0xFA11138EUL, 0x335, 4},
+    {0xFA11138EUL, 0x377, 4},
+    {0xFA670A29UL, 0x2B0, 7},
+    {0xFA670A29UL, 0x2D2, 7},
+    {0xFA670A29UL, 0x2F2, 4},
+    {0xFAA13734UL, 0x10D, 7},
+    {0xFAA13734UL, 0x0EA, 5},
+    {0xFAA13734UL, 0x12D, 4},
+    {0xFAA13734UL, 0x16F, 2},
+    {0xFAA13734UL, 0x0CA, 2},
+    {0xFAA13734UL, 0x1D1, 1},
+    {0xFACAAC6BUL, 0x10D, 7},
+    {0xFB0259AEUL, 0x24E, 7},
+    {0xFB0259AEUL, 0x2B0, 5},
+    {0xFB0259AEUL, 0x2B1, 3},
+    {0xFB0259AEUL, 0x2F3, 3},
+    {0xFB995DF0UL, 0x377, 7},
+    {0xFB995DF0UL, 0x2B1, 7},
+    {0xFB995DF0UL, 0x2B0, 6},
+    {0xFB995DF0UL, 0x290, 5},
+    {0xFB995DF0UL, 0x2D1, 4},
+    {0xFB995DF0UL, 0x2D2, 4},
+    {0xFB995DF0UL, 0x357, 4},
+    {0xFC55B61CUL, 0x24B, 7},
+    {0xFDC55D62UL, 0x2AE, 7},
+    {0xFDC55D62UL, 0x2CD, 7},
+    {0xFE05EDB6UL, 0x10C, 7},
+    {0xFE05EDB6UL, 0x12D, 5},
+    {0xFE05EDB6UL, 0x16F, 5},
+    {0xFE05EDB6UL, 0x14F, 5},
+    {0xFE05EDB6UL, 0x10D, 2},
+    {0xFE20DB91UL, 0x2EE, 7},
+    {0xFE971C67UL, 0x2D1, 7},
+    {0xFE971C67UL, 0x377, 7},
+    {0xFE971C67UL, 0x357, 5},
+    {0xFE971C67UL, 0x315, 2},
+    {0xFE971C67UL, 0x20D, 1},
+    {0xFE9BBB76UL, 0x356, 7},
+    {0xFE9BBB76UL, 0x315, 7},
+    {0xFE9BBB76UL, 0x335, 5},
+    {0xFE9BBB76UL, 0x336, 4},
+    {0xFE9BBB76UL, 0x2F3, 2},
+    {0xFE9BBB76UL, 0x20C, 1},
+    {0xFF0E0CA5UL, 0x377, 7},
+    {0xFF0E0CA5UL, 0x357, 5},
+    {0xFF0E0CA5UL, 0x20C, 3},
+    {0xFF0E0CA5UL, 0x315, 3},
+    {0xFF0E0CA5UL, 0x335, 1},
+    {0xFF2794C2UL, 0x2B1, 7},
+    {0xFF2794C2UL, 0x2F3, 7},
+    {0xFF2794C2UL, 0x2B0, 3},
+    {0xFF2F5882UL, 0x172, 7},
+    {0xFF2F5882UL, 0x153, 6},
+    {0xFF74D4C7UL, 0x28D, 7},
+    {0xFF74D4C7UL, 0x2AC, 5},
+    {0xFFBE281FUL, 0x1D5, 7},
+    {0xFFBE281FUL, 0x1D7, 4},
+    {0xFFC04A19UL, 0x1F3, 7},
+    {0xFFC04A19UL, 0x1F2, 6},
+    {0xFFC04A19UL, 0x12E, 2},
+    {0xFFC04A19UL, 0x10D, 1},
+};
+
+const uint16_t opening_book_size =
+    sizeof(opening_book) / sizeof(opening_book[0]);
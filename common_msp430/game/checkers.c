@@ -15,32 +15,297 @@ static int digit_to_row(char digit) {
   return -1;
 }
 
-void CHECKERS_init(GameState* state, Player player) {
-  // Clear board
-  int i, j, row, col;
-  for (i = 0; i < 8; i++) {
-    for (j = 0; j < 8; j++) {
-      state->board[i][j] = EMPTY;
-    }
+// Bitboard masks
+#define ROW_MASK(row) (0xFUL << ((row) * 4))
+#define EVEN_ROWS 0x0F0F0F0FUL
+#define ODD_ROWS 0xF0F0F0F0UL
+#define LEFT_EDGE 0x10101010UL   // Column 0 (odd rows only)
+#define RIGHT_EDGE 0x08080808UL  // Column 7 (even rows only)
+
+// Zobrist keys per piece kind and square, from a fixed-seed splitmix64
+static const uint32_t zobrist_keys[4][CHECKERS_NUM_SQUARES] = {
+    // Red men
+    {
+        0xE9D8E2EBUL, 0xB45591A3UL, 0x08DAEF81UL, 0x5324628BUL,
+        0x92E70947UL, 0x22CC933EUL, 0x4646E4D9UL, 0xD6D9F564UL,
+        0x1CC4C7CEUL, 0xBB756BB3UL, 0xBFFB0AB0UL, 0x14A4D0FEUL,
+        0x91FD7996UL, 0x8931DA38UL, 0x7533BC21UL, 0xB448DC75UL,
+        0x8B36A30BUL, 0x27CEBE41UL, 0x08366C6EUL, 0xA1D16E0FUL,
+        0x0503A73CUL, 0x2648D11AUL, 0xFF70F94BUL, 0x5A4FC47CUL,
+        0x6C299F8CUL, 0x069BA3D1UL, 0xFF153864UL, 0xE7C10693UL,
+        0xB5E04D1FUL, 0xAEC77D68UL, 0xE222F999UL, 0x611BE921UL,
+    },
+    // Red kings
+    {
+        0x09D5F58BUL, 0xA3E15198UL, 0x789880A8UL, 0xB782C57EUL,
+        0xBA925CF8UL, 0x1D7DD0D7UL, 0x878F2350UL, 0x39E9E204UL,
+        0xF025D170UL, 0x5D4015FDUL, 0x71B1309BUL, 0x675CF23CUL,
+        0xC18E35A4UL, 0x5FE21B47UL, 0x0283C2ECUL, 0x53D1D703UL,
+        0x8BB7B48DUL, 0x2717F99DUL, 0xED365533UL, 0x81516F46UL,
+        0xD1F862AEUL, 0x929C4F6DUL, 0xF720A9ABUL, 0xD2667C0AUL,
+        0xC7745C9CUL, 0xF2BA023DUL, 0x269B19CBUL, 0x4448D24EUL,
+        0xB43B0294UL, 0xA14BDF8DUL, 0x206FEACBUL, 0xA3263DFDUL,
+    },
+    // Black men
+    {
+        0xEDEFC4EEUL, 0x9EA48B75UL, 0xF98F6593UL, 0x778D124EUL,
+        0xC91B7068UL, 0xE783849FUL, 0xEACE0C1AUL, 0xEF0DA771UL,
+        0x97551EC2UL, 0x540FA84BUL, 0xE9660796UL, 0xB42A3DF2UL,
+        0xA9C327D7UL, 0x67285A9EUL, 0x35170141UL, 0xF2687AA4UL,
+        0xBB0A1C4CUL, 0x50951BEDUL, 0x038AF143UL, 0x0DA0B553UL,
+        0x6A2807E0UL, 0x6885A56AUL, 0xF688728CUL, 0x08FC25DDUL,
+        0xC9A6FDDCUL, 0xE62F23E3UL, 0x1C837344UL, 0x1042C114UL,
+        0x9EC8C87EUL, 0x76775C06UL, 0xF81A3E09UL, 0x8051D3D5UL,
+    },
+    // Black kings
+    {
+        0x9D5E60DEUL, 0x9188930FUL, 0xCD421E7CUL, 0x6248810BUL,
+        0xB78DA435UL, 0x5FBED007UL, 0xE4E0C0B8UL, 0xDDFA5ABAUL,
+        0xF0072F4CUL, 0x82F77548UL, 0xA2589D83UL, 0x2FFACA0CUL,
+        0x4492E36CUL, 0x0184C11BUL, 0x92F2F1DFUL, 0x01E3B768UL,
+        0x9FD7C0F4UL, 0x489A8120UL, 0xD1ADD43AUL, 0xF76B8C7CUL,
+        0x2B4F0F08UL, 0x4A6F5D56UL, 0x84DDE550UL, 0xB4FA4C99UL,
+        0xB160A539UL, 0x09352FA7UL, 0xFFE61181UL, 0x689FEE94UL,
+        0xE9675F8DUL, 0x6EA76D0CUL, 0x4FDAD018UL, 0x78F2D84CUL,
+    },
+};
+static const uint32_t zobrist_black_to_move = 0x54386BC2UL;
+
+// Zobrist key rows, a king is always its man's row + 1
+enum { RED_MAN_KEYS = 0, BLACK_MAN_KEYS = 2 };
+
+// Diagonal directions, the opposite of d is (d ^ 3)
+enum { UP_LEFT = 0, UP_RIGHT = 1, DOWN_LEFT = 2, DOWN_RIGHT = 3 };
+
+// Shift every square in bb one step in the given diagonal direction. Squares
+// that would leave the board are dropped.
+static uint32_t step(uint32_t bb, int dir) {
+  switch (dir) {
+    case UP_LEFT:
+      return ((bb & EVEN_ROWS) >> 4) | ((bb & ODD_ROWS & ~LEFT_EDGE) >> 5);
+    case UP_RIGHT:
+      return ((bb & EVEN_ROWS & ~RIGHT_EDGE) >> 3) | ((bb & ODD_ROWS) >> 4);
+    case DOWN_LEFT:
+      return ((bb & EVEN_ROWS) << 4) | ((bb & ODD_ROWS & ~LEFT_EDGE) << 3);
+    default:
+      return ((bb & EVEN_ROWS & ~RIGHT_EDGE) << 5) | ((bb & ODD_ROWS) << 4);
   }
-  // Setup initial piece positions
-  // Black pieces (top, rows 0-2)
-  for (row = 0; row < 3; row++) {
-    for (col = 0; col < 8; col++) {
-      if ((row + col) % 2 == 1) {
-        state->board[row][col] = BLACK_PIECE;
-      }
-    }
+}
+
+// Bit for a board coordinate, 0 for light squares
+static uint32_t square_bit(int row, int col) {
+  if (((row + col) & 1) == 0) return 0;
+  return 1UL << CHECKERS_SQUARE(row, col);
+}
+
+static int lowest_square(uint32_t bb) {
+  int sq = 0;
+  while (!(bb & 1)) {
+    bb >>= 1;
+    sq++;
+  }
+  return sq;
+}
+
+static uint32_t own_pieces(const GameState* state) {
+  return (state->current_player == PLAYER_RED) ? state->red : state->black;
+}
+
+static uint32_t opponent_pieces(const GameState* state) {
+  return (state->current_player == PLAYER_RED) ? state->black : state->red;
+}
+
+// Pieces of the side to move that may travel in the given direction: men
+// only move forward (red up, black down), kings move both ways
+static uint32_t movers(const GameState* state, int dir) {
+  bool forward = (state->current_player == PLAYER_RED) ? (dir <= UP_RIGHT)
+                                                       : (dir >= DOWN_LEFT);
+  return forward ? own_pieces(state) : (own_pieces(state) & state->kings);
+}
+
+// Xor of the keys of every square in bb for one kind of piece
+static uint32_t hash_squares(uint32_t bb, int kind) {
+  uint32_t hash = 0;
+  while (bb) {
+    hash ^= zobrist_keys[kind][lowest_square(bb)];
+    bb &= bb - 1;
+  }
+  return hash;
+}
+
+static void fill_move(Move* move, int from_sq, int to_sq) {
+  move->from_row = CHECKERS_SQUARE_ROW(from_sq);
+  move->from_col = CHECKERS_SQUARE_COL(from_sq);
+  move->to_row = CHECKERS_SQUARE_ROW(to_sq);
+  move->to_col = CHECKERS_SQUARE_COL(to_sq);
+  move->captured = 0;
+  move->path = 0;
+  move->jumps = 0;
+}
+
+// Pieces of the side to move that can start a capture
+static uint32_t jumpers(const GameState* state) {
+  uint32_t empty = ~(state->red | state->black);
+  uint32_t opp = opponent_pieces(state);
+  uint32_t pieces = 0;
+  int dir;
+  for (dir = 0; dir < 4; dir++) {
+    pieces |= step(step(empty, dir ^ 3) & opp, dir ^ 3) & movers(state, dir);
+  }
+  return pieces;
+}
+
+// Depth-first search over the capture chains of one piece, shared by move
+// generation (collect every chain) and validation (look for one chain)
+typedef struct {
+  uint32_t opp;            // Opponent pieces not captured yet
+  uint32_t empty;          // Squares a jump may land on
+  uint32_t promotion_row;  // A man landing here is crowned, ending the chain
+  int first_dir;           // Directions this piece may jump in
+  int last_dir;
+  bool king;
+  Move chain;         // Chain built so far
+  MoveList* list;     // Receives every complete chain, or NULL
+  const Move* want;   // Chain to look for when list is NULL (NULL: any)
+  Move* out;          // Where the matching chain is copied
+  bool found;
+} ChainSearch;
+
+static void init_chain_search(ChainSearch* cs, const GameState* state,
+                              int from_sq) {
+  uint32_t from = 1UL << from_sq;
+  bool red = (state->current_player == PLAYER_RED);
+
+  cs->opp = opponent_pieces(state);
+  cs->empty = ~(state->red | state->black) | from;
+  cs->promotion_row = red ? ROW_MASK(0) : ROW_MASK(7);
+  cs->king = (state->kings & from) != 0;
+  cs->first_dir = (cs->king || red) ? UP_LEFT : DOWN_LEFT;
+  cs->last_dir = (cs->king || !red) ? DOWN_RIGHT : UP_RIGHT;
+  fill_move(&cs->chain, from_sq, from_sq);
+  cs->list = NULL;
+  cs->want = NULL;
+  cs->out = NULL;
+  cs->found = false;
+}
+
+static void add_chain(MoveList* list, const Move* chain) {
+  int i;
+  // Chains visiting the same squares in another order give the same position
+  for (i = 0; i < list->count; i++) {
+    const Move* move = &list->moves[i];
+    if (move->captured == chain->captured &&
+        move->to_row == chain->to_row && move->to_col == chain->to_col)
+      return;
   }
-  // Red pieces (bottom, rows 5-7)
-  for (row = 5; row < 8; row++) {
-    for (col = 0; col < 8; col++) {
-      if ((row + col) % 2 == 1) {
-        state->board[row][col] = RED_PIECE;
-      }
+  if (list->count < CHECKERS_MAX_MOVES)
+    list->moves[list->count++] = *chain;
+  else
+    list->overflow = true;
+}
+
+static void record_chain(ChainSearch* cs, uint32_t to) {
+  int to_sq = lowest_square(to);
+  const Move* want = cs->want;
+
+  cs->chain.to_row = CHECKERS_SQUARE_ROW(to_sq);
+  cs->chain.to_col = CHECKERS_SQUARE_COL(to_sq);
+  if (cs->list) {
+    add_chain(cs->list, &cs->chain);
+  } else if (want == NULL ||
+             (want->jumps ? (want->jumps == cs->chain.jumps &&
+                             want->path == cs->chain.path)
+                          : (want->to_row == cs->chain.to_row &&
+                             want->to_col == cs->chain.to_col))) {
+    *cs->out = cs->chain;
+    cs->found = true;
+  }
+}
+
+static void extend_chain(ChainSearch* cs, uint32_t square) {
+  bool extended = false;
+  int dir;
+
+  for (dir = cs->first_dir; dir <= cs->last_dir && !cs->found; dir++) {
+    uint32_t over = step(square, dir) & cs->opp;
+    uint32_t land = step(over, dir) & cs->empty;
+    if (!land || cs->chain.jumps == CHECKERS_MAX_JUMPS) continue;
+
+    extended = true;
+    cs->chain.captured |= over;
+    cs->chain.path |= (uint32_t)dir << (2 * cs->chain.jumps);
+    cs->chain.jumps++;
+    cs->opp &= ~over;
+    cs->empty |= over;
+
+    if (!cs->king && (land & cs->promotion_row)) {
+      record_chain(cs, land);  // Being crowned ends the move
+    } else {
+      extend_chain(cs, land);
     }
+
+    cs->empty &= ~over;
+    cs->opp |= over;
+    cs->chain.jumps--;
+    cs->chain.path &= ~((uint32_t)3 << (2 * cs->chain.jumps));
+    cs->chain.captured &= ~over;
   }
 
+  // A chain is only complete once no further jump is possible
+  if (!extended && cs->chain.jumps > 0) record_chain(cs, square);
+}
+
+void CHECKERS_make_move(GameState* state, const Move* move) {
+  uint32_t from = square_bit(move->from_row, move->from_col);
+  uint32_t to = square_bit(move->to_row, move->to_col);
+  bool red = (state->current_player == PLAYER_RED);
+  uint32_t* own = red ? &state->red : &state->black;
+  uint32_t* opp = red ? &state->black : &state->red;
+  int own_keys = red ? RED_MAN_KEYS : BLACK_MAN_KEYS;
+  int opp_keys = red ? BLACK_MAN_KEYS : RED_MAN_KEYS;
+
+  // Take the moving piece and the captured pieces out of the hash
+  state->hash ^= zobrist_keys[own_keys + ((state->kings & from) ? 1 : 0)]
+                             [CHECKERS_SQUARE(move->from_row, move->from_col)];
+  state->hash ^= hash_squares(move->captured & ~state->kings, opp_keys) ^
+                 hash_squares(move->captured & state->kings, opp_keys + 1);
+
+  *own = (*own & ~from) | to;
+  *opp &= ~move->captured;
+  if (state->kings & from) state->kings = (state->kings & ~from) | to;
+  state->kings &= ~move->captured;
+
+  // Promote to king if reached opposite end
+  state->kings |= to & (red ? ROW_MASK(0) : ROW_MASK(7));
+
+  // Put the piece back in on its destination, possibly as a new king
+  state->hash ^= zobrist_keys[own_keys + ((state->kings & to) ? 1 : 0)]
+                             [CHECKERS_SQUARE(move->to_row, move->to_col)];
+
+  // Switch turns
+  state->current_player = red ? PLAYER_BLACK : PLAYER_RED;
+  state->hash ^= zobrist_black_to_move;
+}
+
+// Squares to repaint. Only the squares whose piece or highlight changes are
+// marked, so the board view can skip the rest.
+static void mark_dirty(GameState* state, int row, int col) {
+  state->dirty_squares |= CHECKERS_DIRTY_BIT(row, col);
+}
+
+static void mark_last_move_dirty(GameState* state) {
+  if (!state->last_move_valid) return;
+  mark_dirty(state, state->last_move.from_row, state->last_move.from_col);
+  mark_dirty(state, state->last_move.to_row, state->last_move.to_col);
+}
+
+void CHECKERS_init(GameState* state, Player player) {
+  // Setup initial piece positions
+  // Black pieces (top, rows 0-2), red pieces (bottom, rows 5-7)
+  state->black = ROW_MASK(0) | ROW_MASK(1) | ROW_MASK(2);
+  state->red = ROW_MASK(5) | ROW_MASK(6) | ROW_MASK(7);
+  state->kings = 0;
+
   state->selection_state = IDLE;
   state->hovered_row =
       (player == PLAYER_RED) ? 7 : 0;  // Red starts at bottom, Black at top
@@ -49,92 +314,91 @@ void CHECKERS_init(GameState* state, Player player) {
   state->selected_col = -1;
   state->last_move_valid = false;
   state->current_player = PLAYER_RED;  // Red always starts first
+  state->hash = CHECKERS_compute_hash(state);
+  state->dirty_squares = CHECKERS_ALL_DIRTY;
 }
 
-void CHECKERS_draw_board(Graphics_Context* pContext, const GameState* state) {
-  Graphics_Rectangle rect;
-  int row, col;
-  for (row = 0; row < BOARD_SIZE; row++) {
-    for (col = 0; col < BOARD_SIZE; col++) {
-      int x = BOARD_OFFSET_X + col * SQUARE_SIZE;
-      int y = BOARD_OFFSET_Y + row * SQUARE_SIZE;
-      rect.xMin = x;
-      rect.yMin = y;
-      rect.xMax = x + SQUARE_SIZE - 1;
-      rect.yMax = y + SQUARE_SIZE - 1;
-
-      // Draw square background
-      if (state->last_move_valid && ((row == state->last_move.from_row &&
-                                      col == state->last_move.from_col) ||
-                                     (row == state->last_move.to_row &&
-                                      col == state->last_move.to_col))) {
-        Graphics_setForegroundColor(pContext, GRAPHICS_COLOR_YELLOW);
-      } else if ((row + col) % 2 == 0) {
-        Graphics_setForegroundColor(pContext, GRAPHICS_COLOR_WHITE);
-      } else {
-        Graphics_setForegroundColor(pContext, GRAPHICS_COLOR_LIGHT_GRAY);
-      }
-      Graphics_fillRectangle(pContext, &rect);
-
-      // Draw piece
-      PieceType piece = state->board[row][col];
-      if (piece != EMPTY) {
-        int center_x = x + SQUARE_SIZE / 2;
-        int center_y = y + SQUARE_SIZE / 2;
-        int radius = 5;
-        // Set piece color
-        if (piece == RED_PIECE || piece == RED_KING) {
-          Graphics_setForegroundColor(pContext, GRAPHICS_COLOR_RED);
-        } else {
-          Graphics_setForegroundColor(pContext, GRAPHICS_COLOR_BLACK);
-        }
-        // Draw piece (filled circle)
-        Graphics_fillCircle(pContext, center_x, center_y, radius);
-        // Draw king indicator (smaller circle inside)
-        if (piece == RED_KING || piece == BLACK_KING) {
-          Graphics_setForegroundColor(pContext, GRAPHICS_COLOR_YELLOW);
-          Graphics_fillCircle(pContext, center_x, center_y, 2);
-        }
-      }
-
-      // Draw highlights
-      if (state->selection_state == PIECE_SELECTED &&
-          row == state->selected_row && col == state->selected_col) {
-        Graphics_setForegroundColor(pContext, GRAPHICS_COLOR_BLUE);
-        Graphics_drawRectangle(pContext, &rect);
-      }
-      if (row == state->hovered_row && col == state->hovered_col) {
-        Graphics_setForegroundColor(pContext, GRAPHICS_COLOR_GREEN);
-        Graphics_drawRectangle(pContext, &rect);
-      }
-    }
+uint32_t CHECKERS_compute_hash(const GameState* state) {
+  uint32_t hash =
+      hash_squares(state->red & ~state->kings, RED_MAN_KEYS) ^
+      hash_squares(state->red & state->kings, RED_MAN_KEYS + 1) ^
+      hash_squares(state->black & ~state->kings, BLACK_MAN_KEYS) ^
+      hash_squares(state->black & state->kings, BLACK_MAN_KEYS + 1);
+  if (state->current_player == PLAYER_BLACK) hash ^= zobrist_black_to_move;
+  return hash;
+}
+
+PieceType CHECKERS_piece_at(const GameState* state, int row, int col) {
+  uint32_t bit = square_bit(row, col);
+  if (state->red & bit) {
+    return (state->kings & bit) ? RED_KING : RED_PIECE;
+  } else if (state->black & bit) {
+    return (state->kings & bit) ? BLACK_KING : BLACK_PIECE;
   }
+  return EMPTY;
 }
 
 void CHECKERS_encode_move(const Move* move, char* move_buffer) {
-  move_buffer[0] = col_to_letter(move->from_col);
-  move_buffer[1] = row_to_digit(move->from_row);
-  move_buffer[2] = col_to_letter(move->to_col);
-  move_buffer[3] = row_to_digit(move->to_row);
-  move_buffer[4] = '\0';
+  int row = move->from_row;
+  int col = move->from_col;
+  int i;
+
+  *move_buffer++ = col_to_letter(col);
+  *move_buffer++ = row_to_digit(row);
+  if (move->jumps == 0) {
+    *move_buffer++ = col_to_letter(move->to_col);
+    *move_buffer++ = row_to_digit(move->to_row);
+  }
+  // Capture chains list every landing square, e.g. "C3E5C7"
+  for (i = 0; i < move->jumps; i++) {
+    int dir = (move->path >> (2 * i)) & 3;
+    row += (dir & 2) ? 2 : -2;
+    col += (dir & 1) ? 2 : -2;
+    *move_buffer++ = col_to_letter(col);
+    *move_buffer++ = row_to_digit(row);
+  }
+  *move_buffer = '\0';
 }
 
 static bool decode_move(const char* move_str, Move* move) {
-  if (strlen(move_str) < 4) return false;
+  size_t len = strlen(move_str);
+  size_t i;
+  int row, col;
+
+  if (len < 4 || (len & 1) || len >= CHECKERS_MOVE_STR_LEN) return false;
   move->from_col = letter_to_col(move_str[0]);
   move->from_row = digit_to_row(move_str[1]);
-  move->to_col = letter_to_col(move_str[2]);
-  move->to_row = digit_to_row(move_str[3]);
-  if (move->from_col == -1 || move->from_row == -1 || move->to_col == -1 ||
-      move->to_row == -1)
-    return false;
+  if (move->from_col == -1 || move->from_row == -1) return false;
+  move->captured = 0;
+  move->path = 0;
+  move->jumps = 0;
+
+  row = move->from_row;
+  col = move->from_col;
+  for (i = 2; i < len; i += 2) {
+    int next_col = letter_to_col(move_str[i]);
+    int next_row = digit_to_row(move_str[i + 1]);
+    if (next_col == -1 || next_row == -1) return false;
+
+    if (abs(next_row - row) == 2 && abs(next_col - col) == 2) {
+      int dir = ((next_row > row) ? 2 : 0) | ((next_col > col) ? 1 : 0);
+      move->path |= (uint32_t)dir << (2 * move->jumps);
+      move->jumps++;
+    } else if (len != 4) {
+      return false;  // Only a single hop may be a simple step
+    }
+    row = next_row;
+    col = next_col;
+  }
+  move->to_row = row;
+  move->to_col = col;
   return true;
 }
 
 bool CHECKERS_apply_move(GameState* state, const Move* move) {
-  int captured_row, captured_col;
-  PieceType moving_piece;
-  int row_diff, col_diff;
+  Move legal;
+  uint32_t from, to;
+  int dir;
 
   // Bounds checking
   if (move->from_row < 0 || move->from_row >= 8 || move->from_col < 0 ||
@@ -142,84 +406,50 @@ bool CHECKERS_apply_move(GameState* state, const Move* move) {
       move->to_col < 0 || move->to_col >= 8)
     return false;
 
-  // Check source square has a piece
-  if (state->board[move->from_row][move->from_col] == EMPTY) return false;
-
-  // Check destination square is empty
-  if (state->board[move->to_row][move->to_col] != EMPTY) return false;
-
-  moving_piece = state->board[move->from_row][move->from_col];
+  from = square_bit(move->from_row, move->from_col);
+  to = square_bit(move->to_row, move->to_col);
 
   // Validate turn: player can only move their own pieces
-  if (state->current_player == PLAYER_RED) {
-    if (moving_piece != RED_PIECE && moving_piece != RED_KING) return false;
+  if (!(own_pieces(state) & from)) return false;
+
+  // Check destination square is an empty dark square (a king's capture
+  // chain may end where it started)
+  if (!to || (to != from && ((state->red | state->black) & to))) return false;
+
+  if (jumpers(state)) {
+    // Captures are mandatory: the move must be a complete capture chain,
+    // either the exact chain given or any chain ending on the destination
+    ChainSearch cs;
+    init_chain_search(&cs, state, CHECKERS_SQUARE(move->from_row,
+                                                  move->from_col));
+    cs.want = move;
+    cs.out = &legal;
+    extend_chain(&cs, from);
+    if (!cs.found) return false;
   } else {
-    if (moving_piece != BLACK_PIECE && moving_piece != BLACK_KING) return false;
-  }
-
-  row_diff = abs(move->to_row - move->from_row);
-  col_diff = abs(move->to_col - move->from_col);
-
-  // Must move diagonally (row and column change by same amount)
-  if (row_diff != col_diff) return false;
-
-  // Can only move 1 or 2 squares diagonally
-  if (row_diff != 1 && row_diff != 2) return false;
-
-  // If moving 2 squares, must be capturing an opponent piece
-  if (row_diff == 2) {
-    captured_row = (move->from_row + move->to_row) / 2;
-    captured_col = (move->from_col + move->to_col) / 2;
-    PieceType captured_piece = state->board[captured_row][captured_col];
-
-    // Must have a piece in the middle
-    if (captured_piece == EMPTY) return false;
-
-    // Can't capture your own piece
-    if ((moving_piece == RED_PIECE || moving_piece == RED_KING) &&
-        (captured_piece == RED_PIECE || captured_piece == RED_KING))
-      return false;
-    if ((moving_piece == BLACK_PIECE || moving_piece == BLACK_KING) &&
-        (captured_piece == BLACK_PIECE || captured_piece == BLACK_KING))
-      return false;
-  }
-
-  // Direction validation (only for non-king pieces)
-  if (moving_piece == RED_PIECE) {
-    // Red pieces can only move up (decreasing row)
-    if (move->to_row > move->from_row) return false;
-  } else if (moving_piece == BLACK_PIECE) {
-    // Black pieces can only move down (increasing row)
-    if (move->to_row < move->from_row) return false;
+    if (move->jumps) return false;
+    for (dir = 0; dir < 4; dir++) {
+      if ((movers(state, dir) & from) && step(from, dir) == to) break;
+    }
+    if (dir == 4) return false;
+    legal = *move;
+    legal.captured = 0;
+    legal.path = 0;
   }
-  // Kings can move in any direction (no restriction)
 
   // Move is valid - apply it
-  state->board[move->to_row][move->to_col] =
-      state->board[move->from_row][move->from_col];
-  state->board[move->from_row][move->from_col] = EMPTY;
-
-  // Promote to king if reached opposite end
-  if (state->board[move->to_row][move->to_col] == RED_PIECE &&
-      move->to_row == 0)
-    state->board[move->to_row][move->to_col] = RED_KING;
-  else if (state->board[move->to_row][move->to_col] == BLACK_PIECE &&
-           move->to_row == 7)
-    state->board[move->to_row][move->to_col] = BLACK_KING;
-
-  // Remove captured piece if this was a capture
-  if (row_diff == 2) {
-    captured_row = (move->from_row + move->to_row) / 2;
-    captured_col = (move->from_col + move->to_col) / 2;
-    state->board[captured_row][captured_col] = EMPTY;
-  }
-
-  // Switch turns
-  state->current_player =
-      (state->current_player == PLAYER_RED) ? PLAYER_BLACK : PLAYER_RED;
+  CHECKERS_make_move(state, &legal);
 
-  state->last_move = *move;
+  // Repaint the old and new highlights and every square that was jumped
+  mark_last_move_dirty(state);
+  state->last_move = legal;
   state->last_move_valid = true;
+  mark_last_move_dirty(state);
+  while (legal.captured) {
+    int sq = lowest_square(legal.captured);
+    mark_dirty(state, CHECKERS_SQUARE_ROW(sq), CHECKERS_SQUARE_COL(sq));
+    legal.captured &= legal.captured - 1;
+  }
   return true;
 }
 
@@ -232,6 +462,7 @@ bool CHECKERS_apply_move_from_string(const char* move_str, GameState* state) {
 }
 
 void CHECKERS_move_cursor(int dir_x, int dir_y, GameState* state) {
+  mark_dirty(state, state->hovered_row, state->hovered_col);
   state->hovered_row += dir_y;
   state->hovered_col += dir_x;
 
@@ -244,6 +475,7 @@ void CHECKERS_move_cursor(int dir_x, int dir_y, GameState* state) {
     state->hovered_col = BOARD_SIZE - 1;
   else if (state->hovered_col >= BOARD_SIZE)
     state->hovered_col = 0;
+  mark_dirty(state, state->hovered_row, state->hovered_col);
 }
 
 void CHECKERS_select_piece(GameState* state) {
@@ -252,13 +484,19 @@ void CHECKERS_select_piece(GameState* state) {
   state->selection_state = PIECE_SELECTED;
   state->selected_row = state->hovered_row;
   state->selected_col = state->hovered_col;
+  mark_dirty(state, state->selected_row, state->selected_col);
+  mark_last_move_dirty(state);
   state->last_move_valid = false;
 }
 
-void CHECKERS_confirm_move(GameState* state) { state->selection_state = IDLE; }
+void CHECKERS_confirm_move(GameState* state) {
+  state->selection_state = IDLE;
+  mark_dirty(state, state->selected_row, state->selected_col);
+}
 
 Move CHECKERS_get_move(const GameState* state) {
-  Move move;
+  // A plain move: no captures or path for CHECKERS_apply_move to check
+  Move move = {0};
   move.from_row = state->selected_row;
   move.from_col = state->selected_col;
   move.to_row = state->hovered_row;
@@ -267,32 +505,15 @@ Move CHECKERS_get_move(const GameState* state) {
 }
 
 Player CHECKERS_game_ended(GameState* state) {
-  bool red_has_pieces = false;
-  bool black_has_pieces = false;
-  int row, col;
-
-  // Check if either player still has pieces
-  for (row = 0; row < 8; row++) {
-    for (col = 0; col < 8; col++) {
-      PieceType piece = state->board[row][col];
-      if (piece == RED_PIECE || piece == RED_KING) {
-        red_has_pieces = true;
-      } else if (piece == BLACK_PIECE || piece == BLACK_KING) {
-        black_has_pieces = true;
-      }
-    }
-  }
-
   // Determine winner based on who lost all their pieces
-  if (!red_has_pieces) {
+  if (!state->red) {
     return PLAYER_BLACK;
-  } else if (!black_has_pieces) {
+  } else if (!state->black) {
     return PLAYER_RED;
   }
 
   // Check for stalemate (loss)
-  Move dummy_move;
-  if (!CHECKERS_find_valid_move(state, &dummy_move)) {
+  if (!CHECKERS_has_any_move(state)) {
     if (state->current_player == PLAYER_RED) {
       return PLAYER_BLACK;
     } else {
@@ -305,40 +526,82 @@ Player CHECKERS_game_ended(GameState* state) {
 }
 
 bool CHECKERS_find_valid_move(GameState* state, Move* move_to_fill) {
-  int r, c, i;
-
-  // 8 diagonal directions (4 simple, 4 jump)
-  int dr[] = {-1, -1, 1, 1, -2, -2, 2, 2};
-  int dc[] = {-1, 1, -1, 1, -2, 2, -2, 2};
-
-  Player current = state->current_player;
-  PieceType my_piece = (current == PLAYER_RED) ? RED_PIECE : BLACK_PIECE;
-  PieceType my_king = (current == PLAYER_RED) ? RED_KING : BLACK_KING;
-
-  // Iterate over the whole board
-  for (r = 0; r < 8; r++) {
-    for (c = 0; c < 8; c++) {
-      PieceType piece = state->board[r][c];
-
-      if (piece == my_piece || piece == my_king) {
-        for (i = 0; i < 8; i++) {
-          Move potential_move;
-          potential_move.from_row = r;
-          potential_move.from_col = c;
-          potential_move.to_row = r + dr[i];
-          potential_move.to_col = c + dc[i];
-
-          // Test the move on temp game state
-          GameState temp_state = *state;
-
-          if (CHECKERS_apply_move(&temp_state, &potential_move)) {
-            *move_to_fill = potential_move;
-            return true;
-          }
-        }
-      }
+  uint32_t empty = ~(state->red | state->black);
+  uint32_t pieces = jumpers(state);
+  int dir;
+
+  // A capture is mandatory whenever one exists
+  if (pieces) {
+    ChainSearch cs;
+    int sq = lowest_square(pieces);
+    init_chain_search(&cs, state, sq);
+    cs.out = move_to_fill;
+    extend_chain(&cs, 1UL << sq);
+    return true;
+  }
+
+  // Otherwise each direction is checked for all pieces at once
+  for (dir = 0; dir < 4; dir++) {
+    uint32_t steps = step(movers(state, dir), dir) & empty;
+    if (steps) {
+      int to_sq = lowest_square(steps);
+      fill_move(move_to_fill,
+                lowest_square(step(1UL << to_sq, dir ^ 3)), to_sq);
+      return true;
     }
   }
   return false;  // No valid moves found for current player
 }
 
+// Append a simple step for every set bit of to_squares, each coming from the
+// neighbouring square opposite dir
+static void add_steps(MoveList* list, uint32_t to_squares, int dir) {
+  while (to_squares && list->count < CHECKERS_MAX_MOVES) {
+    int to_sq = lowest_square(to_squares);
+    fill_move(&list->moves[list->count++],
+              lowest_square(step(1UL << to_sq, dir ^ 3)), to_sq);
+    to_squares &= to_squares - 1;
+  }
+}
+
+void CHECKERS_generate_moves(const GameState* state, MoveList* list) {
+  uint32_t empty = ~(state->red | state->black);
+  uint32_t pieces = jumpers(state);
+  int dir;
+
+  list->count = 0;
+  list->overflow = false;
+
+  // Captures are mandatory: when any exists only capture chains are legal
+  if (pieces) {
+    while (pieces) {
+      ChainSearch cs;
+      int sq = lowest_square(pieces);
+      init_chain_search(&cs, state, sq);
+      cs.list = list;
+      extend_chain(&cs, 1UL << sq);
+      pieces &= pieces - 1;
+    }
+    return;
+  }
+
+  for (dir = 0; dir < 4; dir++) {
+    add_steps(list, step(movers(state, dir), dir) & empty, dir);
+  }
+}
+
+bool CHECKERS_has_capture(const GameState* state) {
+  return jumpers(state) != 0;
+}
+
+bool CHECKERS_has_any_move(const GameState* state) {
+  uint32_t empty = ~(state->red | state->black);
+  uint32_t opp = opponent_pieces(state);
+  int dir;
+
+  for (dir = 0; dir < 4; dir++) {
+    uint32_t targets = step(movers(state, dir), dir);
+    if ((targets & empty) || (step(targets & opp, dir) & empty)) return true;
+  }
+  return false;
+}
@@ -1,15 +1,22 @@
 #ifndef GAME_CHECKERS_H_
 #define GAME_CHECKERS_H_
 
-#include <drivers/crystalfontz.h>
-#include <hal/hal_lcd.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // Checkers board constants
 #define BOARD_SIZE 8
-#define SQUARE_SIZE 14
-#define BOARD_OFFSET_X 8
-#define BOARD_OFFSET_Y 8
+
+// Bit of a square in GameState.dirty_squares, light squares included
+#define CHECKERS_DIRTY_BIT(row, col) (1ULL << ((row) * BOARD_SIZE + (col)))
+#define CHECKERS_ALL_DIRTY 0xFFFFFFFFFFFFFFFFULL
+
+// Bitboard layout: one bit per dark square, numbered row by row from the top
+// left (row 0 holds squares 0-3, row 7 holds squares 28-31)
+#define CHECKERS_NUM_SQUARES 32
+#define CHECKERS_SQUARE(row, col) ((row) * 4 + ((col) >> 1))
+#define CHECKERS_SQUARE_ROW(sq) ((sq) >> 2)
+#define CHECKERS_SQUARE_COL(sq) ((((sq) & 3) << 1) + (((sq) >> 2) & 1 ? 0 : 1))
 
 // Piece types
 typedef enum {
@@ -24,15 +31,42 @@ typedef enum { IDLE, PIECE_SELECTED } SelectionState;
 
 typedef enum { PLAYER_NONE = 0, PLAYER_RED = 1, PLAYER_BLACK = 2 } Player;
 
+// A side has 12 pieces, so no capture chain can be longer than this
+#define CHECKERS_MAX_JUMPS 12
+
+// Longest encoded move string: origin plus one square per jump, plus '\0'
+#define CHECKERS_MOVE_STR_LEN (2 * (CHECKERS_MAX_JUMPS + 1) + 1)
+
+// A simple step (jumps == 0) or a whole capture chain. The chain is stored as
+// the direction of each jump, 2 bits per jump starting at bit 0 (0 = up-left,
+// 1 = up-right, 2 = down-left, 3 = down-right), plus the captured squares.
 typedef struct {
-  int from_row;
-  int from_col;
-  int to_row;
-  int to_col;
+  int8_t from_row;
+  int8_t from_col;
+  int8_t to_row;
+  int8_t to_col;
+  uint32_t captured;  // Bitboard of the pieces jumped over
+  uint32_t path;      // Jump directions, 2 bits each
+  uint8_t jumps;      // Number of jumps, 0 for a simple step
 } Move;
 
+// Capacity of a move list. Simple steps always fit: a side has at most 12
+// pieces and each steps in at most 4 directions, 12 x 4 = 48. Capture chains
+// have no bound that small, so when they do not fit the list says so in
+// overflow rather than dropping moves unnoticed.
+#define CHECKERS_MAX_MOVES 48
+
+typedef struct {
+  Move moves[CHECKERS_MAX_MOVES];
+  int count;
+  bool overflow;  // Some moves did not fit, the list is incomplete
+} MoveList;
+
 typedef struct {
-  PieceType board[8][8];
+  uint32_t red;    // Red pieces (men and kings)
+  uint32_t black;  // Black pieces (men and kings)
+  uint32_t kings;  // Kings of either color
+  uint32_t hash;   // Zobrist key of the pieces and the side to move
   SelectionState selection_state;
   int hovered_row;
   int hovered_col;
@@ -41,10 +75,12 @@ typedef struct {
   Move last_move;
   bool last_move_valid;
   Player current_player;
+  uint64_t dirty_squares;  // Squares that look different since the last draw
 } GameState;
 
 void CHECKERS_init(GameState* state, Player player);
-void CHECKERS_draw_board(Graphics_Context* pContext, const GameState* state);
+uint32_t CHECKERS_compute_hash(const GameState* state);
+PieceType CHECKERS_piece_at(const GameState* state, int row, int col);
 void CHECKERS_encode_move(const Move* move, char* move_buffer);
 bool CHECKERS_apply_move(GameState* state, const Move* move);
 bool CHECKERS_apply_move_from_string(const char* move_str, GameState* state);
@@ -54,5 +90,12 @@ void CHECKERS_confirm_move(GameState* state);
 Move CHECKERS_get_move(const GameState* state);
 Player CHECKERS_game_ended(GameState* state);
 bool CHECKERS_find_valid_move(GameState* state, Move* move_to_fill);
+void CHECKERS_generate_moves(const GameState* state, MoveList* list);
+bool CHECKERS_has_any_move(const GameState* state);
+bool CHECKERS_has_capture(const GameState* state);
+
+// Plays a move taken from CHECKERS_generate_moves without validating it. Meant
+// for search, which restores the bitboards, hash and current_player itself.
+void CHECKERS_make_move(GameState* state, const Move* move);
 
 #endif /* GAME_CHECKERS_H_ */
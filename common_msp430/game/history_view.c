@@ -0,0 +1,56 @@
+#include <game/history_view.h>
+#include <string.h>
+
+#define HISTORY_HEIGHT (HISTORY_LINES * HISTORY_LINE_HEIGHT)
+
+// Lines start one pixel in so they are centred on the screen
+#define HISTORY_X ((LCD_HORIZONTAL_MAX - HISTORY_COLUMNS * 6) / 2)
+
+static Graphics_Context context;
+static int lines_added;
+
+void HISTORY_VIEW_init(void) {
+  Graphics_Rectangle panel = {0, HISTORY_Y, LCD_HORIZONTAL_MAX - 1,
+                              HISTORY_Y + HISTORY_HEIGHT - 1};
+
+  Graphics_initContext(&context, &g_sCRYSTALFONTZ);
+  Graphics_setForegroundColor(&context, GRAPHICS_COLOR_BLACK);
+  Graphics_setBackgroundColor(&context, GRAPHICS_COLOR_WHITE);
+  GrContextFontSet(&context, &g_sFontFixed6x8);
+
+  Graphics_fillRectangleOnDisplay(&g_sCRYSTALFONTZ, &panel,
+                                  context.background);
+  CRYSTALFONTZ_set_scroll_area(HISTORY_Y, HISTORY_HEIGHT);
+  CRYSTALFONTZ_scroll(0);
+  lines_added = 0;
+}
+
+void HISTORY_VIEW_add_move(int number, Player player, const Move* move) {
+  char line[HISTORY_COLUMNS + 1];
+  char move_str[CHECKERS_MOVE_STR_LEN];
+  int slot = lines_added % HISTORY_LINES;
+  int length;
+
+  // Padded to the full width, so the line overwrites all of the old one in
+  // one transfer. Long capture chains are cut off.
+  memset(line, ' ', HISTORY_COLUMNS);
+  line[HISTORY_COLUMNS] = '\0';
+  line[0] = number >= 100 ? '0' + number / 100 % 10 : ' ';
+  line[1] = number >= 10 ? '0' + number / 10 % 10 : ' ';
+  line[2] = '0' + number % 10;
+  line[4] = player == PLAYER_RED ? 'R' : 'B';
+  CHECKERS_encode_move(move, move_str);
+  length = strlen(move_str);
+  if (length > HISTORY_COLUMNS - 6) length = HISTORY_COLUMNS - 6;
+  memcpy(line + 6, move_str, length);
+
+  // Drawing addresses the panel unscrolled, slot by slot
+  CRYSTALFONTZ_draw_string(&context, (int8_t*)line, HISTORY_COLUMNS, HISTORY_X,
+                           HISTORY_Y + slot * HISTORY_LINE_HEIGHT);
+  lines_added++;
+
+  // Once every slot is used, start the panel at the oldest line left
+  if (lines_added > HISTORY_LINES) {
+    CRYSTALFONTZ_scroll((lines_added % HISTORY_LINES) * HISTORY_LINE_HEIGHT);
+  }
+}
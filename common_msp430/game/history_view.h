@@ -0,0 +1,23 @@
+#ifndef GAME_HISTORY_VIEW_H_
+#define GAME_HISTORY_VIEW_H_
+
+#include <drivers/crystalfontz.h>
+#include <game/board_view.h>
+#include <game/checkers.h>
+
+// The move history is a panel of 6x8 text lines across the screen below the
+// board, scrolled by the LCD itself
+#define HISTORY_LINE_HEIGHT 8
+#define HISTORY_COLUMNS (LCD_HORIZONTAL_MAX / 6)
+#define HISTORY_Y (BOARD_OFFSET_Y + BOARD_SIZE * SQUARE_SIZE)
+#define HISTORY_LINES ((LCD_VERTICAL_MAX - HISTORY_Y) / HISTORY_LINE_HEIGHT)
+
+// Blanks the panel and makes it the LCD's scroll area, call after the screen
+// is cleared
+void HISTORY_VIEW_init(void);
+// Adds a line such as " 12 R C3E5" at the bottom of the panel. Once the
+// panel is full the line replaces the oldest one and a single scroll command
+// brings it to the bottom, so nothing else is redrawn.
+void HISTORY_VIEW_add_move(int number, Player player, const Move* move);
+
+#endif /* GAME_HISTORY_VIEW_H_ */
@@ -0,0 +1,93 @@
+#include <game/status_view.h>
+#include <string.h>
+
+// Printable ASCII, the characters of g_sFontFixed6x8
+#define FIRST_CHAR ' '
+#define GLYPHS 96
+
+// Cells start one pixel in so the row of cells is centred on the screen
+#define CELLS_X ((LCD_HORIZONTAL_MAX - STATUS_CELLS * STATUS_CELL_WIDTH) / 2)
+
+// One byte per glyph column, bit n set for an on pixel in row n. Built from
+// the font at startup; FRAM like the board tiles.
+#pragma PERSISTENT(glyph_columns)
+static uint8_t glyph_columns[GLYPHS][STATUS_CELL_WIDTH] = {{0}};
+
+static uint8_t cell_pixels[2 * STATUS_CELL_WIDTH * STATUS_CELL_HEIGHT];
+static char shown[STATUS_CELLS];
+static int shown_line = -1;
+static uint16_t foreground, background;
+
+void STATUS_VIEW_init(void) {
+  const Graphics_Font* font = &g_sFontFixed6x8;
+  int c, row, column;
+
+  for (c = 0; c < GLYPHS; c++) {
+    // Characters the font does not have are drawn as '.', like grlib does
+    int ch = FIRST_CHAR + c <= 126 ? FIRST_CHAR + c : '.';
+    const uint8_t* data = font->data + font->offset[ch - FIRST_CHAR];
+    int bit = 0;
+
+    memset(glyph_columns[c], 0, STATUS_CELL_WIDTH);
+    for (row = 0; row < STATUS_CELL_HEIGHT; row++) {
+      for (column = 0; column < data[1]; column++, bit++) {
+        if (column < STATUS_CELL_WIDTH && 2 + bit / 8 < data[0] &&
+            (data[2 + bit / 8] & (0x80 >> (bit % 8))))
+          glyph_columns[c][column] |= 1 << row;
+      }
+    }
+  }
+
+  foreground = g_sCRYSTALFONTZ.callColorTranslate(NULL, GRAPHICS_COLOR_RED);
+  background = g_sCRYSTALFONTZ.callColorTranslate(NULL, GRAPHICS_COLOR_WHITE);
+  STATUS_VIEW_invalidate();
+}
+
+void STATUS_VIEW_invalidate(void) { shown_line = -1; }
+
+static void draw_cell(int cell, char ch, int y) {
+  const uint8_t* columns;
+  uint8_t* pixel = cell_pixels;
+  uint8_t c = ch;
+  int row, column;
+
+  if (c < FIRST_CHAR || c >= FIRST_CHAR + GLYPHS) c = '.';
+  columns = glyph_columns[c - FIRST_CHAR];
+  for (row = 0; row < STATUS_CELL_HEIGHT; row++) {
+    for (column = 0; column < STATUS_CELL_WIDTH; column++) {
+      uint16_t color = (columns[column] >> row) & 1 ? foreground : background;
+      *pixel++ = color >> 8;
+      *pixel++ = color;
+    }
+  }
+  CRYSTALFONTZ_draw_tile(CELLS_X + cell * STATUS_CELL_WIDTH, y,
+                         STATUS_CELL_WIDTH, STATUS_CELL_HEIGHT, cell_pixels);
+}
+
+void STATUS_VIEW_print(const char* text, int line) {
+  char cells[STATUS_CELLS];
+  int length = strlen(text);
+  int first, cell;
+  // Same rows as Graphics_drawStringCentered with this font
+  int y = line - g_sFontFixed6x8.baseline / 2;
+
+  if (length > STATUS_CELLS) length = STATUS_CELLS;
+  first = (STATUS_CELLS - length) / 2;
+  memset(cells, ' ', sizeof(cells));
+  memcpy(cells + first, text, length);
+
+  if (line != shown_line) {
+    // Blank the whole bar, then every cell holding text differs from it
+    Graphics_Rectangle bar = {0, line - 4, LCD_HORIZONTAL_MAX - 1, line + 8};
+    Graphics_fillRectangleOnDisplay(&g_sCRYSTALFONTZ, &bar, background);
+    memset(shown, ' ', sizeof(shown));
+    shown_line = line;
+  }
+
+  for (cell = 0; cell < STATUS_CELLS; cell++) {
+    if (cells[cell] != shown[cell]) {
+      draw_cell(cell, cells[cell], y);
+      shown[cell] = cells[cell];
+    }
+  }
+}
@@ -0,0 +1,20 @@
+#ifndef GAME_STATUS_VIEW_H_
+#define GAME_STATUS_VIEW_H_
+
+#include <drivers/crystalfontz.h>
+
+// The status bar is a row of 6x8 character cells across the screen
+#define STATUS_CELL_WIDTH 6
+#define STATUS_CELL_HEIGHT 8
+#define STATUS_CELLS (LCD_HORIZONTAL_MAX / STATUS_CELL_WIDTH)
+
+// Expands the 6x8 font into the glyph cache, call once after
+// CRYSTALFONTZ_init
+void STATUS_VIEW_init(void);
+// Shows text centred on a status bar around line y. Only the character cells
+// that differ from the text already shown are redrawn.
+void STATUS_VIEW_print(const char* text, int line);
+// Marks the bar as drawn over, so the next print repaints all of it
+void STATUS_VIEW_invalidate(void);
+
+#endif /* GAME_STATUS_VIEW_H_ */
@@ -0,0 +1,251 @@
+#include <game/tablebase.h>
+#include <stddef.h>
+
+// A capture or a lookup in a class that is not stored each go one level
+// deeper, so there are at most two levels per piece
+#define MAX_LEVELS (2 * TB_MAX_PIECES)
+
+// binomial[n][k] = n choose k, for up to TB_MAX_PIECES - 1 pieces of a color
+static const uint16_t binomial[CHECKERS_NUM_SQUARES + 1][TB_MAX_PIECES] = {
+    {1, 0, 0, 0},
+    {1, 1, 0, 0},
+    {1, 2, 1, 0},
+    {1, 3, 3, 1},
+    {1, 4, 6, 4},
+    {1, 5, 10, 10},
+    {1, 6, 15, 20},
+    {1, 7, 21, 35},
+    {1, 8, 28, 56},
+    {1, 9, 36, 84},
+    {1, 10, 45, 120},
+    {1, 11, 55, 165},
+    {1, 12, 66, 220},
+    {1, 13, 78, 286},
+    {1, 14, 91, 364},
+    {1, 15, 105, 455},
+    {1, 16, 120, 560},
+    {1, 17, 136, 680},
+    {1, 18, 153, 816},
+    {1, 19, 171, 969},
+    {1, 20, 190, 1140},
+    {1, 21, 210, 1330},
+    {1, 22, 231, 1540},
+    {1, 23, 253, 1771},
+    {1, 24, 276, 2024},
+    {1, 25, 300, 2300},
+    {1, 26, 325, 2600},
+    {1, 27, 351, 2925},
+    {1, 28, 378, 3276},
+    {1, 29, 406, 3654},
+    {1, 30, 435, 4060},
+    {1, 31, 465, 4495},
+    {1, 32, 496, 4960},
+};
+
+static int count_bits(uint32_t bb) {
+  int count = 0;
+  while (bb) {
+    bb &= bb - 1;
+    count++;
+  }
+  return count;
+}
+
+// Combinatorial rank of a set of squares, ignoring the squares in skip
+static uint32_t rank_set(uint32_t set, uint32_t skip) {
+  uint32_t rank = 0;
+  int position = 0;
+  int k = 1;
+  int sq;
+
+  for (sq = 0; sq < CHECKERS_NUM_SQUARES; sq++) {
+    uint32_t bit = 1UL << sq;
+    if (skip & bit) continue;
+    if (set & bit) rank += binomial[position][k++];
+    position++;
+  }
+  return rank;
+}
+
+uint32_t TB_index(uint32_t red, uint32_t black) {
+  // Black's pieces are ranked among the squares red leaves free
+  uint16_t black_sets =
+      binomial[CHECKERS_NUM_SQUARES - count_bits(red)][count_bits(black)];
+
+  return rank_set(red, 0) * black_sets + rank_set(black, red);
+}
+
+// The board looks the same to kings after turning it around and after
+// mirroring it on either long diagonal. mirrors[m][s] is where square s goes
+// under each of the three.
+static const uint8_t mirrors[3][CHECKERS_NUM_SQUARES] = {
+    {31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+     15, 14, 13, 12, 11, 10, 9,  8,  7,  6,  5,  4,  3,  2,  1,  0},
+    {4 , 12, 20, 28, 0 , 8 , 16, 24, 5 , 13, 21, 29, 1 , 9 , 17, 25,
+     6 , 14, 22, 30, 2 , 10, 18, 26, 7 , 15, 23, 31, 3 , 11, 19, 27},
+    {27, 19, 11, 3 , 31, 23, 15, 7 , 26, 18, 10, 2 , 30, 22, 14, 6 ,
+     25, 17, 9 , 1 , 29, 21, 13, 5 , 24, 16, 8 , 0 , 28, 20, 12, 4},
+};
+
+// Positions being resolved by trying moves, one per level. They are too
+// large for the stack and live in FRAM.
+#pragma PERSISTENT(level_states)
+static GameState level_states[MAX_LEVELS] = {0};
+#pragma PERSISTENT(level_moves)
+static MoveList level_moves = {0};
+
+// Turning the board around maps square s to 31 - s
+static uint32_t reverse_bits(uint32_t bb) {
+  uint32_t reversed = 0;
+  int i;
+
+  for (i = 0; i < CHECKERS_NUM_SQUARES; i++) {
+    reversed = (reversed << 1) | (bb & 1);
+    bb >>= 1;
+  }
+  return reversed;
+}
+
+void TB_flip(uint32_t* red, uint32_t* black) {
+  uint32_t new_red = reverse_bits(*black);
+
+  *black = reverse_bits(*red);
+  *red = new_red;
+}
+
+static uint32_t mirror(uint32_t bb, const uint8_t* map) {
+  uint32_t mirrored = 0;
+  int sq;
+
+  for (sq = 0; sq < CHECKERS_NUM_SQUARES; sq++)
+    if (bb & (1UL << sq)) mirrored |= 1UL << map[sq];
+  return mirrored;
+}
+
+void TB_canonical(uint32_t* red, uint32_t* black) {
+  uint32_t best_red = *red;
+  uint32_t best_black = *black;
+  uint32_t best_index = TB_index(*red, *black);
+  int m;
+
+  for (m = 0; m < 3; m++) {
+    uint32_t mirrored_red = mirror(*red, mirrors[m]);
+    uint32_t mirrored_black = mirror(*black, mirrors[m]);
+    uint32_t index = TB_index(mirrored_red, mirrored_black);
+
+    if (index < best_index) {
+      best_red = mirrored_red;
+      best_black = mirrored_black;
+      best_index = index;
+    }
+  }
+  *red = best_red;
+  *black = best_black;
+}
+
+static const TbClass* find_class(int red_count, int black_count) {
+  int i;
+
+  for (i = 0; i < tb_num_classes; i++)
+    if (tb_classes[i].red == red_count && tb_classes[i].black == black_count)
+      return &tb_classes[i];
+  return NULL;
+}
+
+// Stored value of a quiet position with red to move
+static uint8_t lookup(const TbClass* tb_class, uint32_t red, uint32_t black) {
+  const uint8_t* run;
+  uint32_t index;
+  uint16_t offset;
+
+  TB_canonical(&red, &black);
+  index = TB_index(red, black);
+  run = tb_class->data + tb_class->index[index / TB_BLOCK_SIZE];
+  offset = index % TB_BLOCK_SIZE;
+
+  // Skip whole runs until the one holding the position
+  while (1) {
+    uint16_t length = (*run >> TB_RUN_SHIFT) + 1;
+
+    if (length == TB_LONG_RUN) length += run[1];
+    if (offset < length) return *run & TB_VALUE_MASK;
+    offset -= length;
+    run += (length >= TB_LONG_RUN) ? 2 : 1;
+  }
+}
+
+// Orders values for the side to move: quicker wins first, then draws, then
+// slower losses. A value is even for a win.
+static int preference(uint8_t value) {
+  if (value == 0) return 0;
+  return (value & 1) ? value - 256 : 256 - value;
+}
+
+// Value of the position in level_states[level] as stored (0 for a draw,
+// otherwise plies plus one), or 0xFF if it is not covered
+static uint8_t probe_level(int level) {
+  const GameState* state = &level_states[level];
+  uint32_t red = state->red;
+  uint32_t black = state->black;
+  const TbClass* tb_class;
+  int red_count, black_count;
+  uint8_t best = 0xFF;
+  int i, count;
+
+  if (state->current_player == PLAYER_BLACK) TB_flip(&red, &black);
+  red_count = count_bits(red);
+  black_count = count_bits(black);
+
+  // Positions with a capture are not stored, and neither are those where the
+  // side to move is behind; both follow from the positions after each move
+  tb_class = find_class(red_count, black_count);
+  if (tb_class != NULL && !CHECKERS_has_capture(state))
+    return lookup(tb_class, red, black);
+  if (level == MAX_LEVELS - 1) return 0xFF;
+
+  CHECKERS_generate_moves(state, &level_moves);
+  count = level_moves.count;
+  if (count == 0) return 1;  // Lost on the spot
+
+  for (i = 0; i < count; i++) {
+    GameState* child = &level_states[level + 1];
+    uint8_t value;
+
+    // Deeper levels reuse the move list, so generate it again for each move
+    CHECKERS_generate_moves(state, &level_moves);
+    *child = *state;
+    CHECKERS_make_move(child, &level_moves.moves[i]);
+
+    if (!child->red || !child->black) {
+      value = 1;  // The opponent has no pieces left
+    } else {
+      value = probe_level(level + 1);
+      if (value == 0xFF) return 0xFF;
+    }
+
+    // The position after the move is one ply further from the end
+    if (value != 0) value++;
+    if (best == 0xFF || preference(value) > preference(best)) best = value;
+  }
+  return best;
+}
+
+TbValue TB_probe(const GameState* state, uint8_t* plies) {
+  int pieces = count_bits(state->red) + count_bits(state->black);
+  uint8_t value;
+
+  // Men are not covered, and neither are finished games
+  if ((state->kings & (state->red | state->black)) !=
+          (state->red | state->black) ||
+      !state->red || !state->black || pieces > TB_MAX_PIECES)
+    return TB_UNKNOWN;
+
+  level_states[0] = *state;
+  value = probe_level(0);
+  if (value == 0xFF) return TB_UNKNOWN;
+  if (value == 0) return TB_DRAW;
+
+  // The side to move wins if the game ends after an odd number of plies
+  *plies = value - 1;
+  return (*plies & 1) ? TB_WIN : TB_LOSS;
+}
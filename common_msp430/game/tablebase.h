@@ -0,0 +1,53 @@
+#ifndef GAME_TABLEBASE_H_
+#define GAME_TABLEBASE_H_
+
+#include <game/checkers.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// The tablebase covers positions with kings only and at most this many pieces
+#define TB_MAX_PIECES 4
+
+// Positions per compressed block; each block starts a new run
+#define TB_BLOCK_SIZE 256
+
+// A run starts with a byte holding the run length minus one in its top bits
+// and the value in the rest: 0 for a draw, otherwise the distance in plies
+// plus one. Runs of TB_LONG_RUN or more positions are followed by a second
+// byte with the length minus TB_LONG_RUN.
+#define TB_RUN_SHIFT 6
+#define TB_VALUE_MASK 0x3F
+#define TB_LONG_RUN 4
+
+typedef enum { TB_UNKNOWN, TB_DRAW, TB_WIN, TB_LOSS } TbValue;
+
+// One material class, e.g. two red kings against one black king, with red to
+// move. Only classes where red has at least as many kings as black are
+// stored; the others are resolved by trying every move.
+typedef struct {
+  uint8_t red;            // Number of red kings
+  uint8_t black;          // Number of black kings
+  uint32_t size;          // Number of positions
+  const uint16_t* index;  // Offset of each block in data
+  const uint8_t* data;    // Run-length coded values
+} TbClass;
+
+// Generated by host/gen_tablebase into tablebase_data.c
+extern const TbClass tb_classes[];
+extern const uint8_t tb_num_classes;
+
+// Looks the position up in the tablebase. Returns TB_UNKNOWN if it is not
+// covered; otherwise the value for the side to move and, for a win or loss,
+// the number of plies to the end of the game with best play.
+TbValue TB_probe(const GameState* state, uint8_t* plies);
+
+// Position of the red and black pieces within their material class, with
+// red to move. Shared with the generator.
+uint32_t TB_index(uint32_t red, uint32_t black);
+// Swaps the colors and turns the board around
+void TB_flip(uint32_t* red, uint32_t* black);
+// Maps the pieces to the mirror image of the position with the lowest index.
+// Only these positions are stored.
+void TB_canonical(uint32_t* red, uint32_t* black);
+
+#endif /* GAME_TABLEBASE_H_ */
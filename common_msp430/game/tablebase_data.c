@@ -0,0 +1,2068 @@
+// Endgame tablebase generated by host/gen_tablebase, do not edit.
+// Kings only, up to 4 pieces, red to move.
+
+#include <game/tablebase.h>
+
+static const uint16_t index_1_1[] = {
+    0, 108, 144, 146,
+};
+
+static const uint8_t data_1_1[] = {
+    192, 1, 74, 192, 0, 12, 192, 3, 12, 192, 3, 12, 128, 11, 192, 1,
+    6, 11, 3, 64, 12, 192, 3, 12, 192, 3, 12, 128, 11, 7, 192, 1,
+    11, 7, 3, 192, 1, 11, 71, 0, 12, 192, 3, 12, 128, 11, 7, 3,
+    192, 0, 11, 7, 67, 192, 0, 11, 135, 192, 0, 203, 0, 204, 31, 0,
+    4, 72, 192, 1, 72, 192, 0, 10, 192, 3, 10, 192, 4, 132, 0, 9,
+    192, 0, 4, 0, 9, 5, 0, 10, 192, 3, 10, 192, 5, 68, 0, 9,
+    5, 192, 1, 9, 69, 192, 1, 137, 202, 0, 192, 8, 192, 26, 6, 128,
+    132, 6, 192, 0, 72, 192, 2, 72, 192, 7, 71, 192, 1, 135, 200, 0,
+    192, 0, 200, 93, 0, 132, 192, 7, 198, 0, 192, 0, 198, 0, 192, 47,
+    192, 252, 192, 220,
+};
+
+static const uint16_t index_2_1[] = {
+    0, 127, 267, 408, 511, 650, 781, 900, 984, 1069,
+    1143, 1236, 1360, 1453, 1533, 1590, 1641, 1687, 1716, 1792,
+    1828, 1896, 1919, 1943, 1978, 1984, 2005, 2007, 2009, 2011,
+    2027, 2066, 2068, 2072, 2079, 2081, 2083, 2085, 2087, 2089,
+    2091, 2093, 2115, 2117, 2119, 2125, 2127, 2129, 2131, 2133,
+    2135, 2137, 2139, 2141, 2143, 2145, 2147, 2149, 2151,
+};
+
+static const uint8_t data_2_1[] = {
+    72, 132, 6, 78, 30, 14, 12, 162, 222, 0, 12, 162, 222, 0, 12, 162,
+    8, 4, 204, 0, 14, 94, 14, 12, 162, 222, 0, 12, 162, 222, 0, 12,
+    162, 18, 4, 214, 0, 18, 26, 8, 6, 12, 162, 222, 0, 12, 162, 222,
+    0, 12, 162, 72, 76, 74, 222, 0, 12, 162, 222, 0, 12, 162, 222, 0,
+    12, 162, 22, 8, 218, 0, 222, 0, 12, 162, 222, 0, 12, 162, 222, 0,
+    12, 162, 90, 222, 2, 0, 6, 30, 162, 222, 0, 12, 162, 222, 0, 12,
+    162, 4, 140, 138, 224, 19, 14, 200, 0, 70, 78, 32, 4, 160, 10, 160,
+    12, 160, 10, 160, 12, 160, 14, 68, 198, 0, 142, 12, 160, 10, 32, 96,
+    12, 160, 10, 160, 12, 160, 14, 72, 204, 0, 32, 78, 12, 160, 10, 160,
+    12, 160, 10, 160, 12, 160, 4, 72, 12, 202, 0, 72, 4, 12, 4, 28,
+    10, 160, 12, 156, 10, 160, 12, 156, 20, 72, 80, 134, 72, 132, 28, 10,
+    160, 12, 156, 10, 160, 12, 156, 24, 68, 208, 1, 10, 8, 12, 4, 92,
+    10, 160, 12, 156, 10, 160, 12, 220, 0, 68, 24, 198, 0, 72, 12, 156,
+    10, 160, 12, 156, 10, 160, 12, 156, 68, 72, 202, 0, 72, 12, 14, 94,
+    10, 158, 12, 158, 10, 158, 12, 158, 132, 76, 6, 138, 4, 76, 4, 12,
+    10, 160, 12, 156, 10, 160, 12, 156, 20, 8, 4, 80, 6, 148, 4, 12,
+    132, 10, 160, 12, 156, 10, 160, 12, 156, 24, 10, 4, 20, 216, 1, 4,
+    20, 132, 10, 160, 12, 156, 10, 160, 12, 220, 0, 68, 152, 156, 8, 24,
+    28, 4, 28, 10, 160, 12, 156, 10, 160, 12, 156, 196, 0, 12, 198, 0,
+    4, 12, 158, 10, 158, 12, 158, 10, 158, 12, 158, 14, 0, 68, 12, 198,
+    0, 4, 76, 94, 10, 154, 12, 158, 10, 154, 12, 158, 132, 76, 6, 138,
+    4, 12, 28, 76, 10, 160, 12, 156, 10, 160, 12, 156, 24, 68, 148, 24,
+    74, 4, 12, 28, 8, 4, 10, 160, 12, 156, 10, 160, 12, 220, 1, 4,
+    152, 156, 4, 24, 28, 68, 28, 160, 12, 156, 10, 160, 12, 156, 96, 8,
+    92, 0, 224, 0, 92, 68, 224, 0, 220, 0, 202, 0, 204, 0, 72, 68,
+    12, 70, 74, 4, 12, 158, 10, 158, 12, 158, 10, 158, 12, 158, 22, 132,
+    12, 198, 0, 4, 76, 30, 12, 10, 154, 12, 158, 10, 154, 12, 158, 22,
+    4, 0, 2, 90, 150, 4, 26, 158, 10, 154, 12, 158, 10, 154, 12, 222,
+    29, 4, 72, 22, 80, 6, 34, 30, 14, 68, 94, 10, 158, 72, 94, 10,
+    158, 72, 94, 72, 4, 218, 0, 14, 30, 14, 68, 94, 10, 158, 72, 94,
+    10, 158, 72, 94, 14, 72, 90, 70, 14, 94, 68, 94, 10, 158, 72, 94,
+    10, 158, 72, 222, 28, 16, 4, 136, 138, 200, 0, 220, 14, 14, 132, 80,
+    134, 132, 76, 10, 156, 72, 92, 10, 156, 72, 92, 14, 132, 88, 6, 196,
+    1, 76, 10, 156, 72, 92, 10, 156, 72, 92, 4, 72, 4, 72, 6, 10,
+    72, 132, 6, 10, 154, 72, 94, 10, 154, 72, 94, 14, 72, 146, 6, 18,
+    72, 132, 6, 10, 154, 72, 94, 10, 154, 72, 94, 18, 68, 86, 72, 18,
+    30, 6, 132, 6, 10, 154, 72, 94, 10, 154, 72, 94, 22, 4, 8, 218,
+    0, 22, 94, 132, 6, 10, 26, 94, 72, 94, 10, 154, 72, 94, 10, 4,
+    200, 0, 70, 200, 1, 6, 10, 4, 92, 72, 92, 10, 156, 72, 92, 16,
+    4, 72, 76, 70, 72, 132, 6, 74, 92, 72, 88, 10, 156, 72, 88, 20,
+    132, 80, 6, 84, 196, 0, 6, 10, 156, 72, 88, 10, 156, 72, 152, 132,
+    148, 88, 196, 0, 28, 10, 156, 72, 88, 10, 156, 72, 88, 68, 72, 142,
+    6, 72, 132, 6, 10, 154, 72, 90, 10, 154, 72, 90, 8, 68, 200, 0,
+    74, 4, 200, 0, 10, 154, 72, 94, 10, 154, 72, 94, 18, 68, 86, 72,
+    18, 14, 4, 200, 0, 10, 154, 72, 94, 10, 154, 72, 94, 86, 2, 218,
+    0, 22, 26, 4, 218, 0, 22, 154, 72, 94, 10, 154, 72, 94, 90, 222,
+    0, 6, 154, 222, 0, 218, 0, 200, 0, 202, 0, 200, 0, 10, 132, 198,
+    0, 68, 200, 0, 10, 156, 72, 92, 10, 156, 72, 92, 24, 132, 204, 1,
+    4, 8, 140, 202, 0, 72, 88, 10, 156, 72, 152, 132, 84, 152, 4, 212,
+    0, 10, 28, 6, 28, 72, 88, 10, 156, 72, 88, 92, 68, 152, 156, 216,
+    0, 28, 160, 200, 0, 202, 0, 200, 2, 68, 214, 0, 8, 196, 1, 10,
+    154, 72, 90, 10, 154, 72, 90, 18, 132, 214, 0, 18, 196, 1, 74, 26,
+    22, 72, 90, 10, 150, 72, 90, 72, 4, 76, 70, 142, 204, 0, 14, 154,
+    76, 94, 14, 154, 76, 94, 22, 8, 4, 218, 0, 22, 78, 12, 26, 76,
+    14, 154, 76, 94, 14, 154, 76, 94, 90, 4, 158, 6, 90, 0, 222, 0,
+    218, 0, 12, 158, 206, 0, 204, 30, 14, 72, 4, 202, 0, 78, 204, 0,
+    10, 156, 76, 92, 10, 156, 76, 156, 132, 16, 198, 0, 4, 204, 0, 10,
+    28, 74, 76, 88, 10, 156, 76, 88, 28, 132, 152, 156, 88, 68, 10, 28,
+    6, 28, 76, 88, 10, 156, 76, 216, 28, 12, 72, 4, 90, 70, 72, 68,
+    76, 10, 154, 72, 90, 10, 154, 72, 90, 22, 4, 6, 4, 218, 0, 22,
+    8, 196, 0, 74, 26, 22, 72, 90, 10, 150, 72, 218, 58, 20, 200, 1,
+    70, 78, 224, 16, 24, 68, 212, 1, 206, 0, 224, 2, 8, 160, 6, 160,
+    8, 160, 24, 72, 88, 144, 32, 78, 224, 3, 8, 160, 6, 160, 8, 224,
+    59, 18, 132, 18, 22, 198, 0, 4, 222, 3, 8, 158, 6, 158, 8, 14,
+    94, 22, 8, 68, 86, 70, 78, 4, 222, 3, 8, 158, 6, 158, 8, 222,
+    29, 16, 4, 72, 148, 70, 200, 0, 70, 4, 92, 8, 6, 92, 6, 156,
+    72, 92, 20, 132, 212, 1, 196, 2, 156, 72, 92, 6, 28, 92, 72, 92,
+    24, 72, 4, 88, 138, 78, 204, 0, 156, 8, 12, 92, 6, 156, 8, 12,
+    220, 58, 24, 68, 20, 216, 1, 6, 8, 4, 220, 2, 72, 92, 70, 92,
+    72, 92, 24, 68, 88, 198, 0, 72, 4, 220, 2, 72, 92, 70, 92, 72,
+    220, 58, 18, 132, 18, 22, 70, 64, 68, 30, 218, 1, 72, 90, 70, 90,
+    72, 90, 22, 132, 86, 198, 0, 68, 204, 0, 90, 72, 90, 70, 90, 72,
+    218, 28, 16, 4, 200, 1, 134, 136, 134, 216, 10, 20, 132, 212, 2, 196,
+    2, 74, 72, 88, 70, 88, 72, 152, 132, 88, 198, 0, 196, 2, 74, 72,
+    88, 70, 88, 72, 216, 28, 132, 74, 198, 1, 4, 72, 198, 0, 4, 72,
+    88, 70, 92, 72, 88, 20, 8, 4, 144, 198, 0, 4, 8, 68, 134, 4,
+    72, 88, 70, 92, 72, 152, 10, 4, 212, 0, 152, 4, 20, 68, 134, 4,
+    72, 88, 70, 92, 72, 88, 28, 68, 88, 96, 220, 0, 152, 198, 0, 200,
+    0, 198, 0, 200, 0, 196, 0, 8, 198, 1, 4, 72, 198, 0, 4, 72,
+    90, 70, 90, 72, 90, 14, 132, 8, 134, 64, 4, 72, 198, 0, 4, 72,
+    90, 70, 86, 72, 90, 18, 132, 86, 6, 146, 4, 72, 198, 0, 4, 72,
+    90, 70, 86, 72, 90, 22, 68, 2, 90, 6, 86, 64, 154, 198, 0, 200,
+    0, 198, 0, 200, 0, 10, 132, 80, 198, 0, 132, 6, 138, 4, 72, 88,
+    70, 88, 72, 88, 20, 132, 144, 134, 132, 198, 0, 4, 136, 24, 70, 88,
+    72, 84, 24, 132, 212, 0, 152, 148, 198, 0, 200, 0, 198, 0, 200, 12,
+    210, 15, 132, 82, 198, 1, 4, 10, 198, 0, 4, 72, 90, 70, 90, 72,
+    90, 18, 132, 82, 198, 1, 68, 198, 0, 4, 72, 26, 22, 70, 86, 72,
+    86, 132, 76, 70, 138, 4, 140, 138, 4, 76, 88, 74, 92, 76, 152, 68,
+    148, 6, 24, 70, 4, 76, 8, 138, 4, 76, 88, 74, 92, 76, 216, 58,
+    72, 68, 12, 134, 72, 4, 140, 138, 4, 76, 90, 74, 90, 76, 90, 22,
+    132, 12, 198, 1, 4, 140, 138, 4, 76, 90, 74, 86, 76, 90, 22, 132,
+    90, 6, 86, 64, 90, 12, 202, 0, 204, 0, 202, 0, 204, 30, 14, 132,
+    88, 70, 196, 2, 138, 4, 72, 88, 74, 88, 72, 152, 132, 148, 6, 88,
+    196, 0, 138, 4, 136, 20, 74, 88, 72, 212, 58, 22, 8, 68, 86, 134,
+    72, 4, 10, 76, 74, 4, 72, 90, 6, 10, 90, 72, 90, 22, 132, 86,
+    198, 1, 68, 202, 0, 4, 72, 86, 70, 86, 72, 214, 12, 214, 74, 4,
+    214, 1, 26, 30, 14, 68, 222, 1, 68, 94, 6, 158, 68, 94, 90, 8,
+    90, 74, 90, 94, 68, 222, 1, 68, 94, 6, 158, 68, 222, 58, 20, 196,
+    0, 20, 198, 0, 132, 140, 220, 10, 88, 68, 88, 6, 152, 132, 140, 92,
+    68, 92, 6, 156, 68, 92, 214, 58, 68, 214, 2, 196, 1, 154, 68, 90,
+    6, 154, 68, 218, 0, 8, 4, 90, 70, 90, 8, 68, 76, 154, 68, 90,
+    6, 154, 68, 218, 58, 20, 132, 84, 70, 148, 132, 134, 132, 88, 70, 88,
+    68, 216, 0, 68, 88, 70, 152, 196, 31, 214, 42, 4, 214, 1, 26, 8,
+    6, 132, 70, 90, 132, 26, 70, 90, 132, 154, 8, 90, 70, 90, 94, 196,
+    0, 134, 196, 0, 198, 0, 196, 90, 88, 68, 88, 6, 216, 0, 196, 0,
+    134, 196, 0, 198, 0, 196, 32, 214, 26, 68, 214, 1, 90, 68, 64, 134,
+    196, 0, 198, 0, 196, 90, 20, 196, 0, 20, 198, 80, 200, 1, 70, 74,
+    200, 2, 74, 4, 200, 0, 74, 86, 72, 4, 26, 18, 72, 150, 6, 18,
+    10, 200, 2, 74, 4, 200, 0, 74, 86, 72, 4, 218, 57, 10, 136, 198,
+    0, 200, 3, 74, 4, 200, 0, 74, 88, 72, 4, 88, 4, 72, 12, 198,
+    0, 200, 2, 74, 4, 200, 0, 74, 88, 72, 4, 212, 57, 200, 0, 86,
+    70, 136, 196, 0, 74, 4, 200, 0, 74, 86, 72, 4, 22, 18, 4, 72,
+    150, 6, 18, 72, 68, 64, 138, 200, 0, 202, 0, 200, 60, 20, 136, 84,
+    134, 136, 196, 2, 200, 0, 70, 88, 72, 4, 24, 20, 4, 72, 84, 198,
+    0, 72, 196, 124, 200, 9, 76, 10, 6, 142, 8, 204, 0, 142, 204, 0,
+    78, 86, 140, 26, 22, 72, 154, 6, 22, 142, 204, 0, 142, 204, 0, 206,
+    0, 204, 60, 14, 136, 74, 70, 76, 8, 204, 0, 10, 78, 204, 0, 10,
+    14, 88, 140, 24, 28, 4, 72, 16, 198, 0, 72, 204, 0, 138, 204, 0,
+    74, 88, 140, 212, 57, 12, 136, 90, 70, 136, 68, 138, 12, 10, 72, 76,
+    74, 86, 72, 12, 214, 87, 24, 136, 88, 10, 70, 76, 8, 204, 126, 216,
+    126, 68, 216, 0, 206, 1, 224, 13, 92, 12, 220, 1, 32, 78, 28, 224,
+    3, 14, 224, 2, 4, 224, 67, 218, 20, 68, 218, 2, 4, 26, 222, 10,
+    4, 222, 59, 88, 68, 216, 1, 14, 4, 202, 1, 156, 8, 220, 2, 4,
+    8, 220, 0, 8, 4, 220, 2, 14, 220, 99, 220, 244, 8, 220, 2, 8,
+    220, 5, 196, 97, 90, 68, 90, 12, 218, 2, 222, 2, 196, 67, 24, 10,
+    132, 216, 0, 202, 43, 192, 252, 192, 252, 192, 252, 200, 165, 76, 202, 0,
+    72, 140, 202, 0, 4, 140, 138, 28, 140, 208, 57, 200, 30, 12, 202, 0,
+    72, 140, 202, 0, 4, 140, 138, 26, 140, 14, 22, 4, 72, 12, 202, 0,
+    72, 204, 0, 202, 0, 140, 202, 0, 204, 60, 14, 136, 88, 74, 136, 68,
+    202, 89, 192, 252, 222, 193, 196, 55, 220, 40, 132, 220, 4, 204, 197, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 204, 35, 74,
+    206, 0, 204, 0, 206, 0, 204, 0, 142, 204, 90, 14, 204, 1, 74, 204,
+    2, 202, 84, 192, 252, 192, 252, 224, 171, 206, 0, 224, 73, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 28,
+};
+
+static const uint16_t index_3_1[] = {
+    0, 126, 261, 392, 528, 669, 814, 954, 1072, 1188,
+    1320, 1460, 1595, 1734, 1878, 2006, 2151, 2293, 2429, 2565,
+    2701, 2845, 2969, 3104, 3238, 3342, 3446, 3560, 3710, 3785,
+    3923, 4043, 4194, 4313, 4384, 4498, 4605, 4703, 4813, 4933,
+    5039, 5106, 5240, 5376, 5525, 5656, 5791, 5926, 6040, 6139,
+    6273, 6408, 6542, 6663, 6809, 6915, 7049, 7163, 7264, 7329,
+    7472, 7597, 7717, 7798, 7884, 7964, 8071, 8181, 8243, 8343,
+    8484, 8612, 8664, 8730, 8805, 8923, 9037, 9157, 9247, 9304,
+    9407, 9468, 9526, 9642, 9760, 9836, 9890, 9939, 10037, 10096,
+    10183, 10240, 10303, 10384, 10512, 10625, 10717, 10856, 10966, 11061,
+    11126, 11257, 11387, 11516, 11572, 11662, 11713, 11813, 11901, 11971,
+    12021, 12148, 12247, 12332, 12471, 12543, 12601, 12663, 12771, 12902,
+    13024, 13096, 13139, 13190, 13299, 13403, 13464, 13481, 13533, 13552,
+    13632, 13682, 13776, 13837, 13886, 14005, 14139, 14227, 14284, 14321,
+    14391, 14443, 14585, 14646, 14697, 14713, 14746, 14811, 14899, 14962,
+    15073, 15075, 15134, 15165, 15265, 15301, 15369, 15458, 15558, 15589,
+    15614, 15632, 15655, 15687, 15754, 15771, 15788, 15805, 15807, 15862,
+    15875, 15931, 15937, 15956, 15970, 15989, 16021, 16047, 16087, 16116,
+    16118, 16137, 16191, 16228, 16243, 16257, 16259, 16309, 16330, 16363,
+    16365, 16367, 16384, 16402, 16418, 16466, 16468, 16499, 16501, 16503,
+    16505, 16541, 16645, 16731, 16799, 16900, 16961, 17017, 17049, 17167,
+    17208, 17249, 17295, 17314, 17336, 17432, 17449, 17491, 17496, 17518,
+    17520, 17551, 17553, 17677, 17686, 17715, 17722, 17737, 17752, 17754,
+    17796, 17833, 17902, 17965, 17983, 18011, 18073, 18117, 18135, 18153,
+    18162, 18176, 18249, 18251, 18269, 18271, 18286, 18288, 18290, 18319,
+    18356, 18358, 18374, 18376, 18390, 18392, 18394, 18396, 18403, 18440,
+    18442, 18457, 18476, 18478, 18480, 18498, 18500, 18518, 18537, 18555,
+    18557, 18559, 18561, 18580, 18582, 18597, 18599, 18601, 18603, 18605,
+    18616, 18637, 18639, 18656, 18658, 18660, 18662, 18664, 18666, 18668,
+    18698, 18700, 18702, 18704, 18706, 18723, 18742, 18744, 18746, 18760,
+    18762, 18780, 18798, 18816, 18818, 18820, 18822, 18824, 18826, 18828,
+    18830, 18832, 18834, 18836, 18851, 18872, 18874, 18893, 18895, 18897,
+    18899, 18901, 18903, 18905, 18919, 18921, 18923, 18925, 18927, 18929,
+    18931, 18933, 18977, 19061, 19110, 19140, 19179, 19205, 19207, 19244,
+    19295, 19322, 19335, 19349, 19366, 19374, 19382, 19395, 19397, 19399,
+    19401, 19403, 19405, 19423, 19473, 19475, 19485, 19487, 19489, 19491,
+    19493, 19495, 19497, 19508, 19510, 19512, 19514, 19516, 19518, 19520,
+    19522, 19524, 19572, 19590, 19616, 19618, 19636, 19647, 19693, 19695,
+    19697, 19699, 19710, 19712, 19714, 19716, 19718, 19720, 19722, 19724,
+    19726, 19756, 19758, 19760, 19762, 19764, 19766, 19768, 19770, 19772,
+    19774, 19776, 19778, 19780, 19782, 19784, 19786, 19788, 19790, 19792,
+    19794, 19805, 19807, 19809, 19811, 19813, 19815, 19817, 19819, 19821,
+    19823, 19825, 19827, 19829, 19831, 19833, 19835, 19837, 19839, 19841,
+    19843, 19845, 19847, 19849, 19851, 19853, 19855, 19857, 19859, 19861,
+    19863, 19865, 19867, 19869, 19871, 19873, 19875, 19877, 19879, 19881,
+    19883, 19885, 19887, 19889, 19891, 19893, 19895, 19897, 19899, 19901,
+    19903, 19905, 19907, 19909, 19911, 19913, 19915, 19917, 19919, 19921,
+    19923, 19925, 19927, 19929, 19931, 19933, 19935, 19937, 19939, 19941,
+    19943, 19945, 19947, 19949, 19951, 19953, 19955, 19957, 19959, 19961,
+    19963, 19965, 19967, 19969, 19971, 19973, 19975, 19977, 19979, 19981,
+    19983, 19985, 19987, 19989, 19991, 19993, 19995, 19997, 19999, 20001,
+    20003, 20005, 20007, 20009, 20011, 20013, 20015, 20017, 20019, 20021,
+    20023, 20025, 20027, 20029, 20031, 20033, 20035, 20037, 20039, 20041,
+    20043, 20045, 20047, 20049, 20051, 20053, 20055, 20057, 20059, 20061,
+    20063, 20065, 20067, 20069, 20071, 20073, 20075, 20077, 20079, 20081,
+    20083, 20085, 20087, 20089, 20091, 20093, 20095, 20097, 20099, 20101,
+    20103, 20105,
+};
+
+static const uint8_t data_3_1[] = {
+    196, 1, 10, 6, 8, 6, 12, 214, 3, 12, 214, 3, 12, 150, 196, 1,
+    202, 0, 12, 214, 3, 12, 214, 3, 12, 150, 4, 204, 0, 14, 10, 70,
+    12, 214, 3, 12, 214, 3, 12, 150, 206, 2, 10, 70, 12, 214, 3, 12,
+    214, 3, 12, 150, 200, 0, 70, 14, 6, 14, 4, 6, 92, 10, 152, 12,
+    156, 10, 152, 12, 156, 196, 2, 14, 6, 14, 4, 14, 88, 10, 152, 12,
+    152, 10, 152, 12, 152, 196, 2, 8, 70, 4, 152, 10, 152, 12, 152, 10,
+    152, 12, 152, 4, 72, 138, 16, 78, 4, 14, 88, 10, 152, 12, 152, 10,
+    152, 12, 152, 196, 2, 138, 4, 152, 10, 152, 12, 152, 10, 88, 24, 12,
+    152, 8, 4, 198, 0, 10, 70, 12, 152, 10, 152, 12, 152, 10, 152, 12,
+    152, 4, 8, 68, 134, 72, 132, 24, 10, 148, 12, 152, 10, 148, 12, 152,
+    196, 3, 72, 132, 24, 10, 148, 12, 152, 10, 148, 12, 152, 68, 200, 2,
+    6, 132, 20, 10, 148, 12, 148, 10, 148, 12, 148, 132, 198, 0, 72, 4,
+    12, 4, 24, 10, 148, 12, 152, 10, 148, 12, 152, 12, 4, 204, 1, 72,
+    132, 20, 10, 148, 12, 148, 10, 148, 12, 148, 12, 4, 204, 1, 70, 12,
+    4, 84, 10, 148, 12, 148, 10, 148, 12, 148, 136, 202, 0, 72, 4, 12,
+    4, 22, 10, 154, 12, 150, 10, 154, 12, 150, 4, 136, 134, 4, 8, 132,
+    22, 10, 154, 12, 22, 86, 10, 154, 12, 150, 196, 4, 72, 4, 8, 22,
+    10, 150, 12, 150, 10, 150, 12, 150, 132, 198, 0, 72, 12, 78, 22, 10,
+    150, 12, 150, 10, 150, 12, 150, 196, 0, 198, 0, 4, 12, 132, 10, 148,
+    12, 148, 10, 148, 12, 148, 68, 200, 2, 4, 12, 132, 10, 148, 12, 148,
+    10, 148, 12, 148, 68, 200, 2, 4, 12, 132, 10, 148, 12, 148, 10, 148,
+    12, 148, 68, 136, 138, 8, 76, 4, 12, 10, 148, 12, 148, 10, 148, 12,
+    148, 8, 4, 204, 2, 8, 12, 132, 10, 148, 12, 148, 10, 148, 12, 148,
+    12, 4, 144, 140, 4, 16, 132, 10, 148, 12, 148, 10, 148, 12, 148, 196,
+    0, 198, 0, 68, 12, 4, 12, 10, 154, 12, 150, 10, 154, 12, 150, 4,
+    8, 68, 198, 0, 196, 1, 10, 150, 12, 150, 10, 150, 12, 150, 4, 8,
+    4, 198, 1, 4, 12, 132, 10, 150, 12, 150, 10, 150, 12, 150, 132, 198,
+    1, 8, 12, 14, 4, 14, 10, 150, 12, 150, 10, 150, 12, 150, 10, 132,
+    198, 0, 68, 12, 4, 74, 150, 12, 146, 10, 150, 12, 146, 70, 4, 198,
+    1, 196, 1, 10, 146, 12, 146, 10, 146, 12, 146, 6, 20, 4, 198, 1,
+    4, 10, 132, 10, 146, 12, 146, 10, 146, 12, 146, 10, 24, 4, 198, 2,
+    12, 8, 4, 8, 10, 146, 12, 146, 10, 146, 12, 146, 2, 132, 198, 0,
+    4, 204, 0, 10, 148, 12, 152, 10, 148, 12, 152, 196, 1, 6, 74, 4,
+    12, 20, 8, 4, 10, 148, 12, 148, 10, 148, 12, 148, 68, 202, 2, 4,
+    12, 20, 68, 10, 148, 12, 148, 10, 148, 12, 148, 8, 4, 204, 0, 72,
+    4, 76, 68, 12, 148, 12, 148, 10, 148, 12, 148, 4, 8, 76, 202, 0,
+    6, 12, 24, 4, 12, 10, 148, 12, 152, 10, 148, 12, 152, 16, 4, 208,
+    0, 74, 6, 12, 20, 68, 10, 148, 12, 148, 10, 148, 12, 148, 16, 4,
+    148, 144, 4, 84, 68, 16, 148, 12, 148, 10, 148, 12, 148, 196, 0, 70,
+    74, 68, 14, 76, 10, 150, 12, 150, 10, 150, 12, 150, 196, 2, 74, 68,
+    18, 8, 4, 10, 150, 12, 150, 10, 150, 12, 150, 8, 68, 198, 1, 4,
+    12, 18, 68, 10, 150, 12, 150, 10, 150, 12, 150, 136, 10, 202, 0, 8,
+    12, 18, 4, 14, 10, 150, 12, 150, 10, 150, 12, 150, 196, 0, 198, 0,
+    68, 8, 4, 12, 10, 150, 12, 146, 10, 150, 12, 146, 10, 68, 198, 1,
+    196, 1, 10, 146, 12, 146, 10, 146, 12, 146, 14, 68, 198, 1, 4, 12,
+    132, 10, 146, 12, 146, 10, 146, 12, 210, 0, 4, 8, 12, 198, 0, 8,
+    76, 4, 8, 10, 150, 12, 146, 10, 150, 12, 146, 196, 0, 198, 0, 4,
+    12, 8, 76, 10, 148, 12, 148, 10, 148, 12, 148, 4, 6, 2, 70, 136,
+    4, 12, 8, 4, 8, 10, 146, 12, 146, 10, 146, 12, 146, 10, 6, 2,
+    70, 138, 4, 12, 132, 10, 146, 12, 146, 10, 146, 12, 146, 14, 6, 2,
+    10, 6, 142, 4, 12, 132, 10, 146, 12, 146, 10, 146, 12, 82, 82, 4,
+    28, 14, 6, 146, 6, 14, 18, 4, 12, 10, 146, 12, 146, 10, 146, 12,
+    146, 68, 6, 2, 198, 0, 4, 12, 136, 10, 148, 12, 148, 10, 148, 12,
+    148, 4, 26, 6, 2, 200, 0, 4, 12, 136, 10, 144, 12, 144, 10, 144,
+    12, 144, 72, 132, 70, 78, 68, 86, 10, 16, 90, 72, 86, 10, 154, 72,
+    86, 196, 2, 6, 78, 68, 86, 10, 16, 86, 72, 86, 10, 150, 72, 86,
+    68, 6, 138, 6, 10, 6, 68, 86, 10, 20, 86, 72, 86, 10, 150, 72,
+    86, 72, 68, 70, 142, 68, 86, 10, 150, 72, 86, 10, 150, 72, 86, 68,
+    204, 0, 138, 68, 86, 10, 150, 72, 86, 10, 150, 72, 86, 8, 4, 206,
+    0, 134, 68, 86, 10, 150, 72, 86, 10, 22, 86, 72, 214, 27, 4, 200,
+    0, 6, 12, 6, 14, 68, 90, 10, 4, 86, 72, 90, 10, 150, 72, 90,
+    196, 2, 12, 6, 14, 68, 88, 10, 4, 86, 72, 88, 10, 150, 72, 88,
+    68, 72, 70, 12, 78, 68, 88, 10, 4, 86, 72, 88, 10, 150, 72, 88,
+    4, 72, 4, 138, 72, 68, 14, 24, 4, 148, 72, 88, 10, 148, 72, 88,
+    6, 72, 68, 134, 8, 68, 14, 24, 8, 4, 84, 72, 88, 10, 148, 72,
+    88, 6, 196, 2, 6, 8, 68, 84, 10, 148, 72, 84, 10, 148, 72, 84,
+    6, 68, 12, 134, 72, 68, 84, 10, 148, 72, 84, 10, 148, 72, 212, 16,
+    196, 12, 134, 132, 76, 10, 12, 84, 72, 88, 10, 148, 72, 88, 4, 8,
+    68, 198, 0, 132, 8, 4, 10, 148, 72, 84, 10, 148, 72, 84, 196, 10,
+    148, 72, 84, 10, 148, 72, 84, 8, 68, 204, 1, 8, 132, 8, 10, 148,
+    72, 84, 10, 148, 72, 84, 196, 1, 134, 132, 76, 10, 4, 88, 72, 84,
+    10, 152, 72, 84, 6, 196, 0, 134, 132, 76, 10, 150, 72, 82, 10, 150,
+    72, 82, 196, 1, 6, 196, 1, 76, 10, 12, 84, 72, 84, 10, 148, 72,
+    84, 132, 202, 1, 132, 8, 4, 10, 148, 72, 84, 10, 148, 72, 84, 8,
+    68, 140, 196, 3, 10, 148, 72, 84, 10, 148, 72, 84, 12, 4, 8, 80,
+    8, 68, 6, 132, 8, 10, 148, 72, 84, 10, 148, 72, 84, 196, 1, 6,
+    196, 1, 76, 10, 4, 86, 72, 84, 10, 150, 72, 84, 6, 132, 198, 0,
+    132, 76, 10, 146, 72, 82, 10, 146, 72, 82, 6, 4, 6, 2, 198, 0,
+    132, 72, 10, 146, 72, 82, 10, 146, 72, 82, 70, 132, 134, 8, 132, 6,
+    10, 80, 22, 72, 82, 10, 150, 72, 82, 132, 198, 2, 132, 6, 10, 16,
+    86, 72, 82, 10, 150, 72, 82, 6, 4, 198, 3, 132, 6, 74, 82, 72,
+    82, 10, 146, 72, 82, 132, 136, 6, 72, 132, 6, 10, 150, 72, 82, 10,
+    150, 72, 82, 10, 4, 202, 0, 70, 6, 132, 6, 10, 146, 72, 82, 10,
+    146, 72, 82, 14, 4, 74, 72, 14, 70, 132, 6, 10, 146, 72, 82, 10,
+    146, 72, 82, 4, 72, 198, 1, 200, 0, 6, 10, 4, 84, 72, 88, 10,
+    148, 72, 88, 2, 200, 0, 134, 200, 0, 6, 10, 4, 16, 20, 72, 88,
+    10, 148, 72, 88, 196, 0, 198, 1, 136, 6, 10, 4, 16, 20, 72, 84,
+    10, 148, 72, 84, 196, 3, 200, 1, 6, 10, 4, 84, 72, 84, 10, 148,
+    72, 84, 68, 8, 68, 70, 72, 132, 6, 4, 10, 4, 136, 84, 10, 144,
+    72, 84, 134, 68, 70, 72, 132, 6, 10, 4, 16, 136, 84, 10, 144, 72,
+    84, 4, 8, 68, 138, 8, 6, 132, 6, 10, 12, 80, 72, 84, 10, 144,
+    72, 84, 8, 68, 200, 2, 132, 6, 74, 80, 72, 84, 10, 144, 72, 84,
+    68, 136, 70, 4, 8, 132, 6, 74, 86, 72, 82, 10, 150, 72, 82, 8,
+    132, 8, 4, 70, 196, 0, 6, 10, 12, 16, 136, 84, 10, 144, 72, 84,
+    6, 68, 72, 4, 72, 196, 0, 6, 10, 4, 16, 136, 80, 10, 144, 72,
+    80, 132, 200, 1, 196, 0, 6, 4, 16, 4, 136, 80, 10, 144, 72, 80,
+    8, 68, 140, 72, 6, 132, 6, 10, 80, 136, 80, 10, 144, 72, 80, 196,
+    1, 134, 4, 136, 6, 10, 4, 14, 22, 72, 82, 10, 150, 72, 82, 6,
+    10, 196, 6, 6, 10, 146, 72, 78, 10, 146, 72, 78, 196, 0, 198, 0,
+    196, 0, 12, 10, 76, 16, 72, 84, 10, 144, 72, 84, 8, 68, 136, 70,
+    196, 0, 12, 10, 16, 76, 72, 80, 10, 144, 72, 80, 8, 68, 76, 6,
+    72, 196, 0, 8, 10, 80, 136, 80, 10, 144, 72, 80, 12, 68, 144, 76,
+    6, 132, 12, 10, 4, 16, 136, 84, 10, 144, 72, 84, 196, 5, 136, 12,
+    10, 4, 12, 18, 72, 82, 10, 146, 72, 82, 6, 132, 198, 0, 196, 0,
+    12, 74, 82, 72, 78, 10, 146, 72, 78, 10, 68, 2, 70, 74, 196, 0,
+    6, 10, 142, 72, 78, 10, 142, 72, 78, 4, 72, 130, 6, 72, 132, 6,
+    10, 12, 16, 22, 72, 82, 10, 150, 72, 82, 4, 72, 132, 70, 8, 132,
+    70, 20, 86, 72, 82, 10, 150, 72, 82, 196, 1, 198, 0, 132, 6, 8,
+    18, 16, 18, 72, 82, 10, 146, 72, 82, 132, 202, 0, 72, 132, 6, 10,
+    18, 16, 18, 72, 82, 10, 146, 72, 82, 2, 4, 200, 0, 70, 200, 0,
+    6, 10, 4, 14, 18, 72, 86, 74, 82, 72, 86, 2, 4, 72, 68, 70,
+    8, 132, 6, 74, 80, 72, 84, 10, 144, 72, 84, 196, 2, 70, 196, 0,
+    6, 8, 144, 72, 84, 10, 144, 72, 84, 196, 8, 12, 6, 16, 6, 16,
+    72, 80, 10, 144, 72, 80, 196, 0, 72, 10, 6, 4, 200, 0, 10, 18,
+    16, 18, 72, 82, 10, 146, 72, 82, 4, 2, 198, 0, 10, 6, 4, 200,
+    0, 10, 18, 16, 18, 72, 82, 10, 146, 72, 82, 10, 2, 198, 0, 10,
+    6, 4, 202, 2, 8, 10, 72, 82, 10, 146, 72, 82, 4, 6, 136, 6,
+    74, 6, 200, 0, 10, 150, 72, 82, 10, 150, 72, 82, 14, 4, 78, 70,
+    14, 10, 6, 200, 0, 10, 146, 72, 82, 10, 146, 72, 146, 6, 206, 0,
+    82, 4, 206, 0, 82, 8, 18, 72, 82, 10, 146, 72, 82, 196, 6, 136,
+    10, 148, 72, 88, 10, 148, 72, 88, 196, 0, 136, 6, 68, 136, 10, 144,
+    72, 84, 10, 148, 72, 84, 8, 4, 2, 198, 0, 68, 200, 0, 10, 144,
+    72, 84, 10, 148, 72, 84, 8, 4, 198, 1, 4, 6, 200, 0, 10, 144,
+    72, 84, 10, 148, 72, 84, 196, 6, 202, 1, 4, 136, 84, 10, 144, 72,
+    84, 8, 68, 8, 198, 0, 68, 140, 138, 136, 80, 10, 144, 72, 80, 68,
+    2, 200, 1, 4, 8, 76, 74, 12, 10, 12, 72, 80, 10, 144, 72, 80,
+    12, 4, 6, 76, 198, 0, 8, 140, 202, 0, 72, 84, 10, 144, 72, 84,
+    196, 5, 200, 0, 202, 0, 72, 82, 10, 150, 72, 82, 132, 136, 70, 4,
+    200, 0, 10, 16, 6, 136, 80, 10, 144, 72, 80, 8, 68, 136, 70, 4,
+    204, 0, 10, 4, 6, 4, 72, 80, 10, 144, 72, 80, 8, 4, 2, 12,
+    68, 72, 4, 204, 0, 10, 14, 4, 136, 80, 10, 144, 72, 80, 12, 4,
+    8, 16, 4, 6, 76, 4, 208, 0, 10, 16, 10, 136, 80, 10, 144, 72,
+    80, 196, 0, 198, 0, 4, 200, 0, 10, 14, 6, 14, 72, 82, 10, 146,
+    72, 82, 6, 132, 198, 0, 4, 200, 0, 10, 14, 6, 14, 72, 78, 10,
+    142, 72, 78, 68, 2, 136, 10, 10, 4, 200, 0, 10, 16, 12, 16, 72,
+    84, 10, 144, 72, 84, 8, 6, 2, 76, 4, 12, 10, 4, 200, 0, 10,
+    14, 76, 72, 80, 10, 144, 72, 80, 12, 6, 2, 144, 12, 8, 4, 208,
+    0, 12, 16, 6, 136, 80, 10, 144, 72, 144, 68, 148, 144, 212, 0, 16,
+    132, 200, 0, 202, 0, 200, 1, 68, 2, 134, 68, 200, 0, 10, 14, 12,
+    14, 72, 82, 10, 146, 72, 82, 14, 68, 2, 198, 0, 4, 8, 140, 202,
+    0, 72, 78, 10, 146, 72, 142, 4, 6, 2, 10, 4, 78, 4, 202, 1,
+    142, 72, 78, 10, 142, 72, 78, 196, 9, 10, 12, 16, 22, 72, 82, 10,
+    150, 72, 82, 132, 6, 136, 6, 196, 1, 10, 18, 16, 18, 72, 82, 10,
+    146, 72, 82, 6, 4, 2, 198, 0, 196, 2, 10, 18, 16, 18, 72, 82,
+    10, 146, 72, 82, 8, 4, 6, 142, 6, 4, 6, 196, 0, 10, 18, 16,
+    18, 72, 82, 10, 146, 72, 82, 196, 9, 6, 4, 14, 18, 72, 86, 74,
+    82, 72, 86, 6, 132, 202, 0, 196, 1, 202, 0, 72, 84, 10, 144, 72,
+    84, 6, 132, 200, 0, 196, 1, 10, 16, 6, 16, 72, 80, 10, 144, 72,
+    80, 8, 68, 2, 140, 196, 2, 10, 16, 6, 16, 72, 80, 10, 144, 72,
+    80, 196, 0, 198, 0, 196, 1, 138, 136, 78, 10, 146, 72, 78, 10, 68,
+    200, 0, 6, 196, 1, 74, 200, 0, 78, 10, 142, 72, 78, 10, 4, 2,
+    198, 0, 10, 196, 1, 74, 8, 6, 72, 78, 10, 142, 8, 8, 142, 68,
+    138, 6, 14, 6, 196, 0, 74, 18, 6, 72, 78, 10, 146, 72, 78, 196,
+    5, 200, 0, 6, 4, 6, 10, 72, 84, 74, 80, 72, 84, 6, 132, 200,
+    0, 196, 1, 138, 136, 80, 10, 140, 72, 80, 8, 132, 136, 6, 196, 1,
+    74, 6, 12, 72, 76, 10, 140, 72, 76, 8, 68, 2, 140, 8, 196, 1,
+    10, 76, 6, 72, 80, 10, 140, 72, 80, 196, 9, 202, 0, 72, 78, 10,
+    146, 72, 78, 196, 2, 74, 6, 204, 0, 14, 18, 16, 18, 76, 82, 14,
+    146, 76, 82, 68, 138, 6, 14, 10, 6, 204, 0, 14, 18, 16, 18, 76,
+    82, 14, 146, 76, 82, 10, 4, 138, 6, 14, 10, 6, 12, 206, 0, 18,
+    8, 10, 12, 14, 82, 14, 146, 76, 82, 70, 76, 70, 78, 6, 204, 0,
+    14, 150, 76, 82, 14, 150, 76, 82, 14, 4, 206, 1, 8, 6, 12, 16,
+    76, 14, 146, 76, 82, 14, 146, 76, 210, 5, 8, 6, 210, 4, 12, 146,
+    206, 0, 204, 0, 4, 8, 68, 134, 78, 4, 140, 10, 148, 76, 84, 10,
+    148, 76, 84, 196, 3, 74, 4, 140, 10, 84, 16, 76, 84, 10, 148, 76,
+    84, 8, 68, 198, 0, 10, 6, 204, 0, 10, 20, 80, 76, 84, 10, 148,
+    76, 84, 12, 8, 6, 10, 136, 14, 6, 204, 0, 10, 20, 80, 76, 84,
+    10, 148, 76, 84, 196, 0, 198, 0, 68, 8, 68, 10, 16, 74, 76, 84,
+    10, 144, 76, 84, 8, 68, 200, 1, 196, 1, 10, 16, 10, 10, 76, 80,
+    10, 144, 76, 80, 8, 68, 72, 198, 0, 12, 4, 76, 10, 16, 10, 140,
+    80, 10, 144, 76, 144, 68, 16, 198, 0, 4, 204, 0, 10, 16, 74, 76,
+    84, 10, 144, 76, 84, 196, 0, 198, 0, 4, 204, 0, 10, 18, 74, 76,
+    82, 10, 146, 76, 82, 132, 136, 138, 12, 8, 68, 10, 16, 6, 16, 76,
+    80, 10, 144, 76, 80, 8, 68, 136, 204, 0, 132, 10, 14, 6, 4, 76,
+    80, 10, 144, 76, 80, 12, 10, 4, 76, 8, 204, 0, 4, 72, 10, 14,
+    6, 16, 76, 80, 10, 144, 76, 144, 68, 208, 4, 68, 10, 16, 10, 16,
+    76, 80, 10, 144, 76, 80, 196, 0, 198, 1, 76, 68, 10, 18, 6, 14,
+    76, 82, 10, 146, 76, 82, 6, 10, 68, 198, 1, 12, 8, 68, 10, 14,
+    6, 14, 76, 78, 10, 142, 76, 78, 132, 76, 4, 138, 76, 68, 10, 144,
+    76, 84, 10, 144, 76, 84, 12, 68, 204, 0, 70, 76, 68, 10, 14, 80,
+    76, 80, 10, 144, 76, 208, 0, 4, 208, 0, 70, 80, 72, 208, 0, 12,
+    144, 202, 0, 204, 29, 8, 6, 68, 10, 68, 70, 76, 68, 10, 18, 78,
+    76, 82, 10, 146, 76, 82, 14, 132, 10, 196, 0, 12, 6, 68, 10, 16,
+    74, 76, 78, 10, 146, 76, 142, 68, 2, 14, 6, 206, 0, 6, 68, 10,
+    142, 76, 78, 10, 142, 76, 78, 72, 132, 70, 72, 68, 76, 10, 16, 82,
+    72, 82, 10, 146, 72, 82, 132, 10, 76, 74, 6, 68, 76, 10, 18, 16,
+    18, 72, 82, 10, 146, 72, 82, 8, 68, 138, 134, 68, 76, 10, 18, 16,
+    18, 72, 82, 10, 146, 72, 82, 12, 70, 82, 198, 0, 68, 76, 10, 146,
+    72, 82, 10, 146, 72, 82, 68, 8, 68, 70, 72, 68, 70, 10, 4, 82,
+    72, 84, 10, 146, 72, 84, 6, 132, 12, 134, 132, 76, 10, 16, 74, 72,
+    80, 10, 144, 72, 80, 8, 132, 200, 1, 196, 0, 10, 16, 6, 16, 72,
+    80, 10, 144, 72, 80, 12, 132, 80, 196, 3, 10, 144, 72, 80, 10, 144,
+    72, 80, 196, 0, 136, 6, 196, 1, 202, 0, 72, 78, 10, 146, 72, 78,
+    10, 68, 202, 0, 6, 196, 1, 202, 0, 72, 78, 10, 142, 72, 78, 10,
+    68, 74, 8, 6, 10, 6, 196, 0, 74, 8, 14, 72, 78, 10, 142, 72,
+    142, 68, 206, 1, 6, 196, 0, 74, 82, 72, 78, 10, 146, 72, 78, 196,
+    5, 200, 0, 10, 4, 74, 72, 80, 10, 14, 80, 72, 80, 8, 132, 200,
+    0, 196, 1, 10, 6, 74, 72, 80, 10, 140, 72, 80, 8, 132, 200, 1,
+    196, 0, 74, 6, 136, 76, 10, 140, 72, 140, 132, 204, 1, 196, 0, 10,
+    76, 136, 80, 10, 140, 72, 80, 196, 0, 202, 0, 196, 1, 202, 0, 72,
+    78, 10, 142, 72, 78, 68, 2, 200, 0, 74, 200, 0, 10, 14, 6, 14,
+    72, 78, 10, 146, 72, 78, 10, 4, 2, 74, 68, 10, 6, 200, 0, 74,
+    6, 10, 72, 78, 10, 142, 72, 142, 6, 2, 206, 1, 6, 206, 4, 200,
+    0, 202, 0, 200, 30, 68, 2, 198, 0, 4, 200, 0, 10, 14, 6, 16,
+    72, 80, 10, 144, 72, 80, 8, 68, 2, 200, 2, 132, 10, 134, 72, 80,
+    10, 140, 72, 80, 12, 68, 2, 12, 68, 140, 132, 74, 6, 136, 76, 10,
+    140, 72, 204, 27, 8, 68, 2, 202, 0, 196, 1, 74, 6, 10, 72, 78,
+    10, 142, 72, 78, 10, 68, 2, 202, 1, 196, 0, 74, 70, 72, 138, 142,
+    72, 74, 72, 132, 70, 14, 6, 14, 6, 156, 152, 8, 14, 28, 28, 6,
+    152, 8, 156, 196, 3, 14, 6, 78, 216, 2, 8, 14, 88, 6, 152, 8,
+    152, 8, 4, 200, 1, 10, 70, 14, 216, 2, 8, 14, 88, 6, 152, 8,
+    152, 4, 8, 68, 136, 16, 142, 216, 2, 8, 14, 88, 6, 152, 8, 152,
+    10, 4, 204, 1, 138, 14, 216, 2, 8, 14, 88, 6, 152, 8, 152, 12,
+    4, 204, 1, 10, 70, 14, 216, 2, 8, 152, 6, 152, 8, 216, 57, 132,
+    198, 0, 206, 0, 152, 154, 8, 14, 88, 6, 154, 8, 14, 88, 4, 72,
+    202, 0, 26, 142, 152, 26, 90, 8, 14, 88, 6, 154, 8, 14, 216, 27,
+    6, 72, 68, 134, 4, 8, 68, 86, 154, 70, 86, 6, 154, 8, 14, 86,
+    6, 196, 1, 70, 4, 8, 4, 214, 2, 6, 14, 86, 6, 150, 8, 14,
+    86, 10, 132, 70, 74, 72, 14, 214, 2, 8, 14, 86, 6, 150, 8, 14,
+    214, 27, 196, 1, 198, 0, 4, 12, 4, 76, 154, 8, 14, 86, 6, 154,
+    8, 14, 86, 6, 8, 4, 198, 2, 196, 1, 150, 6, 14, 86, 6, 150,
+    8, 14, 86, 6, 8, 4, 6, 202, 1, 196, 1, 150, 6, 150, 6, 150,
+    8, 14, 86, 10, 68, 202, 2, 8, 14, 4, 82, 150, 8, 150, 6, 150,
+    8, 14, 86, 196, 0, 198, 1, 4, 12, 16, 90, 150, 8, 14, 90, 6,
+    150, 8, 14, 90, 6, 196, 0, 198, 0, 4, 6, 140, 148, 8, 14, 88,
+    6, 148, 8, 14, 88, 196, 1, 198, 0, 4, 14, 140, 150, 8, 14, 86,
+    6, 150, 8, 14, 86, 10, 68, 200, 0, 74, 4, 14, 8, 68, 150, 8,
+    14, 86, 6, 150, 8, 14, 86, 10, 68, 202, 0, 70, 4, 14, 132, 150,
+    8, 150, 6, 150, 8, 150, 14, 10, 8, 78, 202, 0, 8, 18, 4, 82,
+    150, 8, 150, 6, 150, 8, 150, 4, 8, 68, 134, 72, 4, 12, 152, 150,
+    8, 14, 88, 6, 150, 8, 14, 88, 6, 196, 0, 198, 0, 4, 8, 140,
+    148, 8, 14, 84, 6, 148, 8, 14, 84, 8, 4, 6, 2, 8, 202, 0,
+    4, 200, 0, 148, 8, 148, 6, 148, 8, 14, 212, 56, 8, 68, 200, 0,
+    4, 6, 78, 152, 4, 86, 72, 88, 6, 150, 72, 88, 8, 4, 8, 76,
+    70, 4, 142, 152, 4, 86, 72, 88, 6, 150, 72, 216, 56, 8, 132, 198,
+    1, 132, 76, 4, 88, 72, 84, 6, 152, 72, 84, 8, 132, 134, 196, 0,
+    140, 4, 86, 72, 84, 6, 150, 72, 84, 4, 72, 4, 198, 1, 136, 70,
+    4, 84, 8, 6, 88, 6, 148, 72, 88, 6, 72, 132, 134, 136, 70, 4,
+    16, 20, 4, 6, 88, 6, 148, 72, 88, 6, 196, 0, 198, 5, 4, 16,
+    20, 4, 6, 84, 6, 148, 72, 84, 10, 68, 200, 5, 70, 4, 84, 8,
+    6, 84, 6, 148, 72, 84, 68, 200, 0, 70, 200, 0, 70, 4, 88, 72,
+    84, 6, 152, 72, 84, 68, 72, 68, 70, 4, 136, 70, 10, 86, 8, 6,
+    82, 6, 150, 72, 82, 6, 196, 1, 134, 132, 70, 4, 14, 22, 4, 6,
+    82, 6, 150, 72, 82, 6, 132, 200, 1, 132, 76, 4, 16, 18, 8, 6,
+    82, 6, 146, 72, 82, 68, 6, 8, 198, 1, 136, 70, 4, 6, 18, 72,
+    86, 6, 82, 18, 72, 86, 196, 10, 148, 72, 88, 6, 148, 72, 88, 6,
+    68, 200, 1, 6, 196, 1, 144, 72, 84, 6, 148, 72, 84, 8, 4, 2,
+    200, 1, 196, 2, 144, 72, 84, 6, 148, 72, 84, 12, 4, 6, 140, 70,
+    4, 6, 196, 0, 144, 72, 84, 6, 148, 72, 84, 196, 0, 198, 0, 196,
+    2, 152, 72, 84, 6, 152, 72, 84, 10, 196, 2, 70, 4, 202, 3, 72,
+    82, 6, 150, 72, 82, 10, 132, 200, 1, 196, 1, 14, 6, 14, 72, 82,
+    6, 146, 72, 82, 10, 68, 2, 202, 0, 196, 2, 142, 72, 82, 6, 146,
+    72, 82, 6, 132, 202, 0, 196, 3, 6, 18, 72, 86, 6, 146, 72, 86,
+    6, 132, 200, 1, 196, 2, 6, 10, 8, 6, 84, 6, 10, 80, 72, 84,
+    4, 8, 132, 134, 72, 204, 0, 148, 8, 12, 84, 6, 148, 8, 12, 84,
+    10, 68, 204, 1, 72, 204, 0, 84, 16, 8, 12, 84, 6, 148, 8, 12,
+    84, 12, 68, 140, 70, 10, 6, 204, 0, 20, 80, 8, 12, 84, 6, 148,
+    8, 12, 84, 16, 8, 6, 80, 136, 14, 6, 204, 0, 20, 80, 8, 12,
+    84, 6, 148, 8, 12, 84, 4, 72, 4, 202, 0, 72, 204, 0, 150, 8,
+    12, 84, 6, 150, 8, 12, 84, 10, 196, 0, 70, 74, 4, 204, 0, 18,
+    74, 8, 12, 82, 6, 146, 8, 12, 82, 10, 132, 202, 2, 12, 132, 18,
+    6, 14, 8, 12, 82, 6, 146, 8, 12, 82, 14, 6, 68, 78, 68, 70,
+    12, 132, 18, 78, 8, 12, 82, 6, 146, 8, 12, 82, 8, 4, 8, 4,
+    76, 70, 4, 72, 134, 4, 82, 72, 84, 6, 146, 72, 84, 10, 132, 200,
+    1, 196, 2, 74, 8, 6, 80, 6, 10, 80, 72, 80, 12, 68, 2, 204,
+    1, 196, 1, 12, 6, 16, 72, 80, 6, 144, 72, 208, 27, 196, 4, 72,
+    68, 212, 1, 72, 84, 70, 84, 72, 84, 8, 4, 200, 2, 70, 68, 212,
+    1, 72, 84, 70, 84, 72, 84, 8, 132, 198, 0, 72, 68, 212, 1, 72,
+    84, 70, 84, 72, 84, 10, 4, 204, 2, 6, 8, 68, 212, 1, 72, 84,
+    70, 84, 72, 84, 12, 4, 204, 2, 6, 6, 4, 212, 2, 72, 84, 70,
+    84, 72, 212, 56, 132, 134, 72, 6, 8, 4, 8, 148, 86, 72, 84, 70,
+    86, 72, 84, 132, 134, 200, 0, 4, 14, 148, 86, 72, 84, 70, 86, 72,
+    212, 56, 6, 196, 3, 72, 4, 210, 2, 6, 8, 6, 18, 70, 82, 72,
+    82, 10, 132, 198, 0, 72, 4, 210, 2, 72, 82, 70, 82, 72, 210, 2,
+    196, 26, 70, 74, 132, 140, 86, 8, 6, 14, 18, 70, 86, 72, 82, 70,
+    4, 198, 0, 74, 196, 2, 82, 134, 18, 70, 82, 72, 82, 70, 4, 198,
+    2, 196, 2, 82, 134, 18, 70, 82, 72, 82, 10, 68, 10, 134, 74, 8,
+    68, 136, 82, 8, 6, 82, 70, 82, 72, 82, 196, 0, 134, 74, 68, 204,
+    0, 82, 72, 86, 70, 82, 72, 86, 6, 8, 132, 198, 0, 68, 204, 0,
+    80, 72, 14, 20, 70, 80, 72, 84, 196, 1, 198, 0, 132, 140, 82, 72,
+    82, 70, 82, 72, 82, 10, 68, 200, 2, 196, 2, 82, 72, 82, 70, 82,
+    72, 18, 18, 10, 68, 10, 198, 1, 196, 2, 82, 8, 6, 82, 70, 82,
+    72, 82, 14, 4, 8, 14, 198, 1, 8, 68, 136, 82, 8, 6, 82, 70,
+    82, 72, 82, 196, 0, 70, 136, 68, 204, 0, 82, 72, 84, 70, 82, 72,
+    84, 6, 196, 0, 198, 0, 68, 204, 0, 80, 72, 14, 16, 70, 80, 72,
+    80, 8, 4, 6, 2, 136, 76, 68, 200, 0, 80, 72, 80, 70, 80, 72,
+    208, 56, 6, 196, 3, 6, 8, 4, 10, 148, 82, 72, 84, 70, 82, 72,
+    84, 8, 68, 72, 134, 72, 4, 10, 148, 82, 72, 84, 70, 82, 72, 212,
+    56, 6, 196, 1, 6, 74, 68, 10, 140, 84, 72, 80, 70, 84, 72, 80,
+    6, 132, 72, 134, 68, 10, 140, 82, 72, 80, 70, 82, 72, 80, 4, 72,
+    4, 198, 0, 72, 68, 134, 16, 72, 4, 12, 20, 70, 80, 72, 84, 6,
+    72, 132, 134, 8, 68, 134, 16, 8, 132, 20, 70, 80, 72, 84, 6, 196,
+    0, 198, 1, 68, 134, 80, 4, 6, 4, 16, 70, 80, 72, 80, 10, 68,
+    200, 1, 6, 8, 68, 134, 80, 8, 6, 80, 70, 80, 72, 208, 16, 198,
+    8, 4, 72, 68, 70, 72, 68, 134, 82, 8, 4, 78, 70, 82, 72, 78,
+    6, 196, 1, 134, 196, 2, 12, 18, 4, 6, 4, 14, 70, 82, 72, 78,
+    6, 132, 200, 1, 196, 2, 78, 8, 6, 78, 70, 78, 72, 206, 27, 196,
+    11, 10, 136, 10, 20, 70, 80, 72, 84, 8, 68, 72, 198, 0, 196, 2,
+    10, 136, 10, 16, 70, 80, 72, 80, 8, 4, 2, 8, 196, 7, 10, 72,
+    4, 80, 70, 80, 72, 80, 12, 4, 6, 12, 68, 198, 0, 196, 1, 74,
+    8, 4, 80, 70, 80, 72, 80, 196, 0, 134, 72, 196, 0, 202, 0, 72,
+    10, 16, 70, 84, 72, 80, 10, 196, 10, 74, 72, 78, 70, 82, 72, 78,
+    10, 132, 200, 0, 6, 196, 2, 70, 72, 78, 70, 78, 72, 78, 10, 68,
+    2, 10, 196, 6, 74, 8, 4, 78, 70, 78, 72, 78, 6, 132, 200, 1,
+    196, 2, 74, 72, 82, 70, 78, 72, 82, 6, 132, 200, 1, 196, 2, 10,
+    72, 6, 80, 70, 76, 72, 14, 16, 8, 196, 0, 198, 0, 196, 2, 74,
+    72, 14, 16, 70, 80, 72, 80, 10, 68, 204, 2, 196, 2, 10, 136, 80,
+    70, 80, 72, 80, 12, 68, 140, 198, 0, 196, 1, 10, 136, 80, 70, 80,
+    72, 144, 68, 80, 134, 196, 3, 74, 72, 80, 70, 80, 72, 80, 196, 0,
+    134, 72, 196, 2, 74, 72, 14, 16, 70, 82, 72, 80, 10, 196, 0, 198,
+    0, 196, 2, 74, 72, 78, 70, 78, 72, 78, 10, 132, 10, 134, 72, 196,
+    1, 70, 8, 6, 78, 70, 78, 72, 142, 132, 14, 6, 196, 5, 74, 8,
+    6, 78, 70, 78, 72, 78, 8, 132, 72, 134, 196, 2, 74, 72, 80, 70,
+    78, 72, 80, 10, 132, 200, 1, 196, 2, 10, 72, 6, 76, 70, 76, 72,
+    140, 68, 2, 12, 196, 6, 70, 8, 4, 76, 70, 76, 72, 204, 30, 198,
+    23, 68, 8, 198, 2, 8, 212, 0, 86, 8, 6, 16, 20, 70, 86, 72,
+    84, 10, 68, 10, 198, 1, 72, 212, 0, 86, 8, 6, 84, 70, 86, 72,
+    212, 56, 6, 132, 198, 0, 132, 204, 0, 82, 8, 6, 86, 70, 82, 72,
+    86, 8, 132, 8, 198, 1, 4, 204, 0, 82, 8, 6, 84, 70, 82, 72,
+    212, 54, 136, 132, 198, 2, 196, 2, 10, 134, 16, 70, 84, 72, 80, 10,
+    132, 10, 198, 1, 196, 1, 74, 8, 6, 14, 16, 70, 82, 72, 80, 8,
+    196, 0, 198, 0, 4, 8, 68, 134, 4, 72, 84, 70, 80, 72, 84, 68,
+    200, 0, 134, 4, 8, 68, 134, 4, 72, 84, 70, 80, 72, 84, 8, 4,
+    200, 3, 4, 8, 68, 134, 4, 72, 80, 70, 80, 72, 80, 68, 72, 198,
+    1, 4, 72, 198, 0, 4, 72, 84, 70, 80, 72, 84, 12, 4, 204, 0,
+    134, 4, 8, 68, 134, 4, 72, 80, 70, 80, 72, 80, 12, 8, 208, 0,
+    140, 4, 16, 68, 134, 4, 72, 80, 70, 80, 72, 80, 196, 0, 198, 1,
+    68, 12, 198, 0, 4, 72, 82, 6, 6, 86, 72, 82, 4, 8, 132, 198,
+    0, 196, 0, 134, 4, 72, 82, 70, 86, 72, 82, 132, 198, 2, 4, 8,
+    68, 134, 4, 72, 82, 70, 82, 72, 82, 132, 198, 2, 4, 72, 198, 0,
+    4, 72, 82, 70, 82, 72, 82, 196, 0, 134, 74, 68, 8, 198, 0, 4,
+    8, 6, 14, 134, 82, 72, 78, 70, 4, 198, 0, 84, 196, 0, 134, 4,
+    8, 198, 1, 82, 72, 78, 6, 68, 198, 0, 88, 4, 8, 68, 134, 4,
+    72, 6, 14, 70, 82, 72, 78, 10, 68, 8, 134, 92, 4, 72, 198, 0,
+    4, 72, 78, 70, 82, 72, 78, 2, 132, 134, 76, 4, 72, 198, 0, 4,
+    72, 16, 20, 70, 80, 72, 84, 132, 72, 198, 0, 4, 72, 198, 0, 4,
+    8, 6, 14, 134, 82, 72, 78, 10, 6, 4, 72, 6, 138, 4, 8, 68,
+    134, 4, 8, 198, 1, 78, 72, 78, 10, 6, 4, 10, 70, 138, 4, 10,
+    68, 134, 4, 8, 198, 1, 78, 72, 142, 68, 10, 70, 142, 4, 72, 198,
+    0, 4, 8, 6, 14, 134, 78, 72, 78, 196, 0, 198, 1, 4, 72, 198,
+    0, 4, 72, 84, 70, 80, 72, 84, 6, 8, 68, 8, 198, 0, 4, 72,
+    198, 0, 4, 72, 14, 16, 70, 76, 72, 80, 68, 2, 72, 134, 10, 4,
+    72, 198, 0, 4, 72, 78, 70, 82, 72, 78, 10, 4, 2, 138, 70, 10,
+    4, 8, 68, 134, 4, 72, 6, 10, 70, 78, 72, 142, 6, 2, 10, 70,
+    78, 6, 4, 10, 68, 134, 4, 8, 198, 1, 78, 72, 78, 18, 4, 6,
+    14, 70, 82, 74, 78, 198, 1, 8, 198, 3, 200, 0, 132, 2, 198, 0,
+    10, 4, 72, 198, 0, 4, 72, 80, 70, 80, 72, 80, 8, 68, 2, 8,
+    70, 26, 10, 4, 72, 198, 0, 4, 72, 14, 16, 70, 76, 72, 80, 8,
+    4, 6, 2, 76, 136, 4, 72, 198, 0, 4, 72, 76, 70, 76, 72, 76,
+    196, 1, 198, 0, 132, 6, 138, 4, 72, 84, 70, 80, 72, 84, 4, 8,
+    68, 198, 1, 196, 0, 138, 4, 72, 84, 70, 80, 72, 84, 6, 196, 8,
+    138, 4, 72, 80, 70, 80, 72, 80, 8, 68, 76, 198, 0, 132, 6, 138,
+    4, 72, 80, 70, 80, 72, 80, 196, 2, 134, 132, 6, 138, 4, 72, 4,
+    16, 70, 84, 136, 16, 6, 132, 134, 74, 132, 6, 138, 4, 72, 78, 70,
+    82, 72, 78, 6, 196, 1, 134, 132, 6, 138, 4, 72, 78, 70, 82, 72,
+    78, 6, 68, 2, 198, 0, 10, 132, 6, 138, 4, 72, 78, 70, 78, 72,
+    78, 196, 0, 70, 4, 70, 132, 198, 0, 4, 8, 4, 8, 4, 70, 76,
+    72, 80, 8, 68, 136, 4, 70, 132, 198, 0, 4, 8, 132, 70, 76, 72,
+    80, 8, 68, 72, 70, 72, 132, 198, 0, 4, 72, 4, 16, 70, 76, 72,
+    80, 12, 68, 204, 0, 70, 132, 198, 0, 4, 136, 16, 70, 76, 72, 80,
+    196, 2, 134, 132, 198, 0, 4, 136, 14, 70, 82, 136, 14, 10, 132, 70,
+    196, 2, 198, 0, 4, 8, 4, 8, 4, 70, 82, 72, 12, 74, 4, 68,
+    72, 6, 74, 132, 198, 0, 4, 72, 4, 10, 70, 78, 72, 138, 68, 2,
+    138, 6, 10, 132, 198, 0, 4, 72, 74, 70, 78, 72, 74, 196, 0, 136,
+    70, 132, 198, 0, 4, 136, 16, 70, 76, 72, 80, 132, 200, 0, 70, 4,
+    136, 134, 4, 72, 10, 12, 70, 76, 72, 80, 8, 68, 76, 198, 0, 4,
+    136, 134, 4, 72, 4, 8, 70, 76, 72, 76, 8, 4, 2, 12, 132, 72,
+    4, 140, 134, 4, 8, 132, 70, 76, 72, 140, 4, 6, 16, 68, 6, 140,
+    144, 198, 0, 8, 132, 198, 0, 200, 0, 196, 0, 198, 1, 4, 136, 134,
+    4, 72, 10, 14, 70, 82, 72, 78, 10, 132, 198, 0, 24, 4, 136, 134,
+    4, 72, 74, 70, 78, 8, 8, 138, 132, 202, 1, 4, 136, 134, 4, 72,
+    4, 10, 70, 74, 72, 74, 14, 68, 2, 10, 68, 142, 138, 198, 0, 8,
+    132, 198, 0, 200, 0, 6, 132, 202, 1, 196, 0, 138, 4, 72, 76, 70,
+    76, 72, 80, 8, 132, 204, 0, 196, 1, 134, 4, 72, 76, 70, 200, 0,
+    76, 132, 72, 68, 134, 136, 134, 10, 72, 4, 14, 70, 76, 72, 80, 8,
+    68, 204, 0, 134, 8, 68, 134, 136, 4, 12, 70, 76, 72, 140, 8, 4,
+    140, 6, 204, 0, 68, 198, 0, 200, 0, 198, 0, 200, 29, 196, 0, 6,
+    196, 1, 136, 134, 10, 72, 4, 14, 70, 78, 72, 78, 10, 132, 6, 132,
+    88, 8, 198, 1, 136, 4, 10, 70, 78, 72, 138, 132, 10, 70, 138, 8,
+    198, 2, 8, 6, 4, 134, 74, 72, 202, 27, 8, 132, 76, 196, 3, 138,
+    136, 4, 12, 70, 76, 72, 76, 8, 132, 204, 0, 70, 132, 134, 136, 4,
+    12, 70, 74, 72, 204, 27, 196, 1, 198, 1, 68, 198, 0, 4, 72, 16,
+    18, 70, 86, 72, 82, 6, 8, 4, 198, 3, 196, 3, 6, 8, 16, 18,
+    70, 86, 72, 82, 6, 68, 6, 200, 2, 196, 2, 4, 6, 8, 16, 18,
+    70, 82, 72, 82, 10, 68, 74, 198, 1, 68, 198, 0, 4, 72, 82, 70,
+    82, 72, 82, 196, 0, 198, 2, 68, 198, 0, 4, 72, 16, 22, 70, 82,
+    72, 86, 6, 196, 0, 134, 82, 68, 198, 0, 4, 72, 84, 70, 80, 72,
+    84, 6, 132, 72, 198, 0, 68, 198, 0, 4, 72, 84, 70, 80, 72, 84,
+    8, 68, 2, 72, 134, 10, 68, 198, 0, 4, 72, 80, 70, 80, 72, 80,
+    8, 132, 198, 2, 68, 198, 0, 4, 72, 80, 70, 84, 136, 16, 8, 132,
+    136, 134, 68, 198, 0, 4, 8, 6, 8, 14, 70, 82, 136, 14, 10, 132,
+    200, 2, 196, 3, 72, 6, 14, 70, 82, 6, 8, 78, 10, 132, 74, 196,
+    1, 196, 1, 10, 72, 4, 14, 70, 78, 72, 78, 196, 1, 198, 1, 68,
+    198, 0, 4, 8, 6, 10, 134, 82, 72, 78, 70, 4, 198, 3, 196, 3,
+    198, 2, 82, 72, 78, 6, 68, 6, 200, 2, 196, 3, 6, 8, 6, 14,
+    70, 78, 72, 78, 10, 68, 74, 198, 1, 68, 198, 0, 4, 72, 78, 70,
+    78, 72, 78, 196, 0, 198, 2, 68, 198, 0, 4, 6, 8, 10, 18, 70,
+    78, 6, 72, 18, 6, 196, 0, 198, 1, 68, 198, 0, 4, 72, 10, 16,
+    70, 76, 72, 12, 16, 6, 132, 72, 198, 0, 68, 198, 0, 4, 72, 10,
+    16, 70, 76, 72, 80, 8, 68, 2, 72, 198, 0, 68, 198, 0, 4, 72,
+    76, 70, 76, 72, 76, 8, 132, 70, 198, 0, 68, 198, 0, 4, 6, 8,
+    10, 12, 70, 80, 6, 72, 12, 10, 132, 136, 134, 196, 3, 8, 6, 8,
+    10, 70, 78, 72, 138, 132, 200, 2, 196, 3, 72, 74, 70, 78, 6, 72,
+    74, 132, 10, 6, 196, 6, 72, 6, 4, 134, 74, 72, 74, 8, 132, 198,
+    3, 4, 198, 0, 4, 70, 8, 18, 70, 78, 6, 72, 18, 196, 1, 198,
+    0, 4, 76, 8, 138, 4, 76, 80, 74, 80, 76, 80, 68, 200, 0, 10,
+    70, 4, 76, 4, 138, 4, 76, 80, 74, 80, 76, 80, 8, 4, 200, 0,
+    12, 70, 4, 76, 4, 140, 4, 76, 80, 74, 80, 76, 80, 4, 8, 76,
+    70, 138, 4, 76, 4, 138, 4, 76, 84, 74, 80, 76, 84, 12, 4, 204,
+    0, 14, 74, 4, 76, 4, 138, 4, 76, 80, 74, 80, 76, 208, 27, 196,
+    0, 134, 72, 68, 76, 138, 4, 76, 82, 74, 86, 76, 82, 196, 1, 198,
+    0, 68, 12, 8, 138, 4, 76, 82, 74, 82, 76, 82, 8, 68, 198, 2,
+    4, 76, 4, 138, 4, 76, 82, 74, 82, 76, 82, 136, 202, 0, 72, 4,
+    76, 4, 138, 4, 76, 82, 74, 82, 76, 82, 196, 0, 198, 1, 68, 8,
+    4, 138, 4, 76, 14, 6, 74, 82, 76, 78, 6, 68, 72, 198, 0, 196,
+    0, 138, 4, 76, 14, 6, 74, 78, 76, 78, 6, 68, 198, 2, 4, 10,
+    68, 138, 4, 76, 78, 74, 78, 76, 142, 68, 10, 198, 1, 4, 76, 4,
+    138, 4, 76, 78, 74, 82, 76, 78, 196, 0, 198, 1, 4, 12, 8, 6,
+    138, 4, 76, 84, 74, 80, 76, 84, 132, 72, 6, 72, 10, 4, 12, 8,
+    4, 138, 4, 76, 14, 6, 74, 82, 76, 78, 70, 4, 74, 6, 74, 6,
+    4, 10, 68, 138, 4, 76, 70, 74, 78, 76, 78, 10, 6, 4, 10, 70,
+    74, 24, 4, 10, 68, 138, 4, 76, 70, 74, 78, 76, 142, 68, 14, 70,
+    78, 92, 78, 4, 202, 0, 204, 0, 202, 0, 204, 0, 196, 0, 198, 0,
+    10, 4, 12, 72, 138, 4, 76, 84, 74, 80, 76, 84, 8, 26, 68, 8,
+    134, 30, 4, 12, 72, 138, 4, 76, 80, 74, 204, 0, 80, 68, 2, 74,
+    6, 138, 6, 76, 8, 138, 4, 76, 14, 14, 74, 82, 76, 78, 10, 4,
+    2, 202, 2, 6, 76, 8, 138, 4, 76, 6, 138, 78, 76, 206, 56, 72,
+    4, 2, 10, 70, 72, 6, 76, 8, 138, 4, 76, 80, 74, 80, 76, 80,
+    8, 68, 2, 8, 198, 1, 76, 8, 138, 4, 76, 14, 16, 74, 204, 0,
+    80, 12, 4, 8, 2, 204, 4, 8, 202, 0, 204, 0, 202, 0, 204, 0,
+    196, 1, 70, 196, 2, 138, 4, 72, 84, 74, 80, 72, 84, 132, 136, 134,
+    196, 0, 8, 74, 4, 72, 80, 74, 80, 72, 80, 8, 68, 200, 0, 196,
+    2, 8, 10, 68, 72, 80, 74, 80, 72, 80, 12, 4, 8, 80, 70, 196,
+    2, 138, 4, 72, 80, 74, 80, 72, 80, 196, 1, 70, 196, 2, 10, 132,
+    72, 80, 74, 84, 72, 12, 16, 10, 132, 8, 198, 0, 196, 0, 138, 4,
+    72, 78, 74, 82, 72, 78, 6, 132, 74, 70, 10, 132, 8, 6, 74, 4,
+    72, 78, 74, 82, 72, 78, 10, 68, 2, 74, 6, 68, 6, 132, 138, 4,
+    72, 78, 74, 78, 72, 78, 196, 0, 70, 4, 70, 196, 0, 138, 4, 136,
+    4, 74, 76, 72, 80, 8, 68, 136, 4, 70, 196, 0, 8, 74, 4, 136,
+    4, 74, 76, 72, 76, 8, 68, 72, 70, 72, 196, 0, 8, 74, 4, 136,
+    12, 74, 76, 72, 140, 68, 204, 2, 4, 132, 138, 4, 136, 16, 74, 76,
+    72, 80, 196, 2, 134, 4, 136, 10, 132, 136, 14, 74, 82, 72, 12, 14,
+    6, 132, 70, 196, 3, 138, 4, 136, 4, 74, 78, 72, 74, 6, 132, 74,
+    6, 10, 6, 196, 0, 6, 74, 4, 136, 138, 78, 72, 138, 68, 2, 202,
+    1, 6, 132, 138, 4, 72, 202, 0, 78, 72, 74, 196, 0, 136, 70, 196,
+    0, 6, 74, 4, 136, 16, 74, 76, 72, 80, 132, 200, 0, 10, 6, 4,
+    136, 138, 4, 72, 76, 74, 76, 72, 80, 8, 68, 72, 68, 10, 6, 4,
+    136, 138, 4, 72, 4, 8, 74, 76, 72, 204, 32, 200, 21, 132, 198, 0,
+    68, 136, 138, 4, 72, 78, 74, 82, 72, 78, 6, 132, 198, 1, 4, 8,
+    68, 138, 4, 72, 202, 0, 78, 72, 138, 132, 202, 3, 68, 202, 0, 200,
+    0, 202, 0, 200, 30, 132, 200, 0, 196, 1, 8, 74, 4, 72, 76, 74,
+    76, 72, 80, 8, 132, 200, 1, 196, 0, 8, 74, 4, 72, 76, 74, 200,
+    0, 76, 132, 76, 68, 138, 76, 4, 138, 6, 76, 4, 14, 74, 80, 76,
+    80, 12, 68, 204, 1, 70, 76, 4, 138, 6, 76, 4, 12, 74, 204, 2,
+    200, 55, 6, 68, 10, 132, 70, 76, 4, 202, 0, 76, 4, 14, 74, 78,
+    76, 80, 14, 132, 10, 196, 1, 12, 6, 4, 138, 8, 76, 4, 14, 74,
+    78, 76, 206, 56, 12, 132, 80, 196, 3, 138, 6, 72, 4, 12, 74, 78,
+    72, 140, 132, 204, 2, 132, 10, 76, 6, 72, 4, 12, 74, 76, 72, 204,
+    22, 196, 6, 198, 1, 4, 10, 70, 74, 4, 72, 82, 6, 10, 86, 72,
+    82, 10, 68, 136, 198, 0, 4, 134, 74, 4, 72, 82, 6, 10, 82, 72,
+    82, 10, 68, 202, 1, 70, 4, 6, 68, 74, 4, 72, 82, 6, 10, 82,
+    72, 82, 14, 72, 78, 138, 72, 4, 10, 68, 74, 4, 72, 82, 6, 10,
+    82, 72, 82, 4, 8, 68, 198, 0, 72, 4, 10, 70, 74, 4, 72, 86,
+    6, 10, 82, 72, 86, 6, 196, 0, 198, 1, 4, 8, 70, 74, 4, 72,
+    84, 6, 10, 80, 72, 84, 10, 132, 76, 134, 10, 4, 6, 72, 74, 4,
+    72, 84, 6, 10, 80, 72, 84, 12, 8, 4, 2, 76, 70, 72, 6, 136,
+    74, 4, 72, 80, 6, 10, 80, 72, 80, 8, 132, 198, 0, 196, 5, 72,
+    80, 6, 10, 84, 136, 16, 10, 132, 136, 134, 196, 3, 8, 6, 8, 14,
+    6, 10, 82, 136, 14, 10, 132, 202, 1, 196, 1, 74, 4, 72, 78, 6,
+    10, 82, 72, 142, 6, 68, 78, 132, 70, 10, 68, 70, 10, 72, 4, 14,
+    6, 10, 78, 72, 80, 196, 1, 198, 1, 196, 3, 72, 14, 134, 82, 72,
+    78, 10, 68, 136, 198, 0, 196, 3, 72, 14, 134, 78, 72, 78, 10, 68,
+    10, 198, 2, 196, 3, 8, 6, 78, 70, 78, 72, 142, 68, 14, 198, 2,
+    196, 3, 8, 6, 78, 70, 78, 72, 78, 196, 0, 134, 136, 196, 3, 72,
+    14, 18, 70, 78, 136, 18, 6, 196, 0, 198, 1, 196, 0, 132, 72, 14,
+    16, 70, 76, 72, 14, 16, 10, 132, 76, 198, 0, 196, 3, 72, 80, 70,
+    76, 72, 14, 16, 12, 68, 2, 76, 198, 1, 196, 2, 72, 76, 70, 76,
+    72, 76, 8, 132, 72, 198, 0, 196, 3, 8, 6, 76, 70, 80, 136, 12,
+    10, 132, 136, 134, 196, 3, 8, 6, 8, 10, 70, 78, 72, 138, 132, 202,
+    2, 196, 3, 72, 74, 70, 78, 72, 74, 14, 132, 14, 6, 196, 6, 72,
+    6, 4, 134, 74, 72, 76, 8, 132, 10, 198, 2, 196, 2, 8, 6, 12,
+    18, 70, 78, 136, 18, 132, 198, 3, 4, 72, 134, 4, 136, 10, 70, 78,
+    136, 74, 68, 198, 2, 68, 8, 4, 134, 4, 72, 6, 10, 70, 74, 136,
+    202, 55, 196, 0, 198, 2, 4, 72, 134, 4, 136, 14, 70, 76, 136, 16,
+    196, 0, 8, 134, 90, 4, 72, 134, 4, 136, 12, 70, 200, 1, 12, 8,
+    132, 76, 6, 200, 2, 198, 0, 200, 0, 198, 0, 200, 30, 132, 198, 2,
+    132, 138, 4, 8, 6, 8, 134, 78, 136, 74, 132, 198, 2, 132, 134, 4,
+    200, 0, 70, 74, 200, 4, 200, 51, 132, 76, 198, 1, 196, 2, 136, 14,
+    70, 76, 136, 16, 8, 132, 76, 198, 1, 196, 2, 136, 12, 70, 200, 1,
+    204, 26, 196, 2, 6, 142, 68, 86, 16, 86, 68, 86, 6, 150, 68, 86,
+    10, 4, 202, 2, 8, 6, 68, 86, 20, 86, 68, 86, 6, 150, 68, 86,
+    72, 68, 134, 142, 68, 214, 1, 68, 86, 6, 150, 68, 86, 14, 4, 204,
+    0, 14, 138, 68, 214, 1, 68, 86, 6, 150, 68, 22, 22, 206, 3, 10,
+    70, 68, 214, 1, 68, 86, 6, 150, 68, 214, 56, 8, 68, 198, 0, 12,
+    78, 68, 88, 4, 86, 68, 88, 6, 12, 86, 68, 88, 136, 202, 0, 12,
+    78, 68, 88, 4, 86, 68, 88, 6, 12, 86, 68, 216, 56, 10, 68, 200,
+    1, 10, 8, 68, 84, 12, 84, 68, 84, 6, 12, 84, 68, 84, 12, 68,
+    8, 198, 0, 72, 68, 84, 12, 84, 68, 84, 6, 12, 84, 68, 212, 27,
+    196, 1, 198, 0, 196, 0, 76, 84, 68, 88, 6, 12, 84, 68, 88, 8,
+    6, 4, 72, 6, 136, 196, 1, 12, 84, 68, 84, 6, 12, 84, 68, 84,
+    72, 4, 136, 138, 196, 1, 12, 84, 68, 84, 6, 12, 84, 68, 84, 12,
+    68, 204, 2, 8, 132, 76, 84, 68, 84, 6, 12, 84, 68, 212, 27, 8,
+    10, 68, 198, 1, 132, 140, 86, 68, 82, 6, 12, 86, 68, 82, 196, 1,
+    70, 196, 1, 140, 84, 68, 84, 6, 12, 84, 68, 84, 10, 68, 140, 10,
+    72, 132, 8, 4, 12, 84, 4, 148, 6, 12, 84, 68, 84, 12, 8, 4,
+    204, 2, 196, 1, 12, 84, 68, 84, 6, 148, 68, 84, 16, 72, 80, 10,
+    144, 6, 132, 76, 84, 68, 84, 6, 148, 68, 84, 72, 68, 8, 70, 72,
+    132, 76, 4, 86, 68, 84, 6, 12, 86, 68, 84, 10, 132, 8, 198, 0,
+    132, 140, 82, 68, 82, 6, 12, 82, 68, 82, 10, 4, 6, 2, 202, 1,
+    132, 72, 12, 82, 68, 82, 6, 12, 82, 68, 210, 56, 6, 68, 200, 0,
+    12, 78, 74, 84, 12, 86, 68, 84, 6, 12, 86, 68, 84, 10, 72, 74,
+    70, 12, 78, 74, 20, 20, 12, 86, 68, 84, 6, 12, 86, 68, 212, 85,
+    8, 132, 72, 6, 132, 74, 140, 82, 68, 84, 6, 12, 82, 68, 212, 56,
+    6, 68, 200, 0, 134, 132, 6, 12, 82, 68, 82, 6, 12, 82, 68, 82,
+    10, 68, 204, 0, 10, 72, 4, 74, 6, 12, 82, 68, 82, 6, 12, 82,
+    68, 210, 6, 198, 47, 132, 72, 134, 68, 134, 12, 80, 68, 84, 6, 12,
+    80, 68, 84, 10, 132, 136, 74, 68, 72, 76, 80, 68, 80, 6, 12, 80,
+    68, 208, 27, 196, 3, 70, 196, 1, 12, 86, 68, 82, 6, 12, 86, 68,
+    82, 10, 68, 72, 70, 10, 6, 196, 1, 12, 16, 18, 68, 82, 6, 12,
+    82, 68, 82, 10, 6, 2, 202, 1, 6, 196, 1, 12, 16, 18, 68, 82,
+    6, 146, 68, 82, 14, 70, 142, 6, 14, 10, 6, 196, 0, 12, 82, 68,
+    82, 6, 146, 68, 82, 8, 68, 4, 198, 0, 196, 3, 14, 18, 68, 86,
+    6, 12, 82, 68, 86, 6, 132, 200, 1, 196, 1, 138, 68, 84, 6, 12,
+    80, 68, 84, 10, 132, 140, 74, 196, 1, 12, 6, 16, 68, 80, 6, 12,
+    80, 68, 80, 12, 6, 4, 2, 204, 1, 196, 1, 12, 80, 68, 80, 6,
+    144, 68, 80, 8, 132, 198, 0, 68, 202, 0, 12, 14, 20, 68, 80, 6,
+    12, 84, 68, 80, 10, 132, 200, 0, 10, 68, 202, 2, 68, 78, 6, 12,
+    82, 68, 78, 72, 132, 134, 72, 68, 70, 16, 82, 68, 82, 6, 16, 82,
+    68, 82, 14, 68, 204, 0, 14, 70, 68, 70, 80, 18, 68, 82, 6, 16,
+    82, 68, 82, 14, 10, 4, 142, 6, 14, 10, 6, 68, 72, 80, 18, 68,
+    82, 6, 146, 68, 210, 0, 6, 82, 70, 82, 6, 68, 76, 146, 68, 82,
+    6, 146, 68, 82, 136, 4, 10, 134, 72, 68, 74, 4, 82, 68, 84, 6,
+    12, 82, 68, 84, 12, 132, 8, 198, 0, 132, 70, 12, 74, 68, 80, 6,
+    12, 80, 68, 80, 12, 132, 204, 2, 196, 0, 12, 6, 16, 68, 80, 6,
+    12, 80, 68, 144, 8, 68, 80, 4, 144, 196, 0, 12, 80, 68, 80, 6,
+    144, 68, 80, 10, 72, 4, 74, 70, 72, 74, 70, 12, 82, 68, 80, 6,
+    12, 82, 68, 80, 10, 132, 204, 0, 10, 68, 202, 2, 68, 78, 6, 12,
+    78, 68, 142, 6, 4, 2, 206, 1, 10, 196, 0, 70, 10, 68, 78, 6,
+    142, 68, 206, 20, 202, 33, 68, 200, 1, 4, 142, 86, 4, 86, 72, 86,
+    6, 4, 86, 68, 86, 12, 72, 76, 138, 4, 142, 86, 4, 86, 72, 86,
+    6, 4, 86, 68, 214, 85, 10, 8, 68, 74, 70, 196, 0, 76, 4, 84,
+    70, 84, 6, 4, 84, 68, 212, 44, 200, 9, 132, 202, 1, 196, 2, 6,
+    18, 72, 82, 6, 4, 82, 68, 82, 12, 72, 4, 76, 134, 4, 72, 70,
+    4, 82, 72, 82, 6, 4, 82, 68, 210, 56, 8, 68, 200, 2, 6, 8,
+    4, 148, 82, 68, 14, 20, 70, 82, 68, 84, 12, 68, 76, 198, 0, 72,
+    4, 148, 82, 68, 84, 70, 82, 68, 212, 68, 202, 14, 132, 74, 198, 0,
+    68, 140, 82, 68, 80, 70, 82, 68, 208, 56, 8, 132, 202, 2, 196, 2,
+    10, 68, 10, 18, 70, 78, 68, 82, 12, 132, 76, 198, 0, 196, 1, 74,
+    68, 80, 70, 78, 68, 208, 27, 196, 1, 198, 1, 132, 134, 132, 14, 20,
+    70, 80, 68, 84, 72, 4, 136, 198, 0, 196, 5, 14, 20, 70, 80, 68,
+    84, 74, 4, 200, 0, 138, 196, 5, 14, 16, 70, 80, 68, 80, 12, 68,
+    76, 70, 140, 132, 134, 132, 80, 70, 80, 68, 80, 196, 0, 198, 2, 132,
+    134, 132, 80, 70, 84, 68, 8, 16, 8, 132, 198, 0, 88, 132, 134, 132,
+    78, 70, 82, 68, 78, 10, 132, 72, 6, 138, 132, 134, 132, 78, 70, 82,
+    68, 78, 10, 68, 2, 74, 6, 138, 132, 134, 132, 78, 70, 78, 68, 78,
+    8, 132, 74, 198, 0, 4, 74, 134, 132, 82, 70, 78, 68, 82, 8, 132,
+    138, 134, 68, 8, 134, 132, 8, 16, 70, 76, 68, 80, 10, 132, 204, 0,
+    196, 7, 10, 12, 4, 6, 76, 68, 80, 12, 4, 68, 76, 68, 140, 196,
+    1, 8, 132, 12, 70, 76, 68, 76, 8, 132, 8, 10, 198, 1, 68, 134,
+    4, 70, 80, 6, 4, 80, 68, 8, 16, 8, 132, 6, 10, 198, 1, 68,
+    134, 132, 76, 70, 80, 68, 76, 196, 1, 134, 196, 7, 84, 70, 80, 68,
+    84, 10, 68, 140, 6, 10, 196, 7, 80, 70, 80, 68, 80, 12, 8, 4,
+    204, 1, 70, 196, 5, 80, 70, 80, 68, 144, 72, 80, 70, 144, 196, 5,
+    80, 70, 80, 68, 80, 72, 68, 8, 134, 72, 196, 5, 80, 70, 84, 68,
+    8, 16, 10, 132, 8, 198, 1, 196, 5, 78, 70, 82, 4, 4, 142, 132,
+    12, 70, 76, 24, 132, 6, 196, 1, 78, 70, 82, 68, 206, 0, 4, 2,
+    78, 6, 142, 6, 196, 4, 78, 70, 78, 68, 78, 8, 132, 74, 70, 132,
+    74, 196, 2, 82, 70, 78, 68, 82, 10, 132, 140, 134, 68, 72, 74, 132,
+    8, 16, 70, 76, 68, 80, 12, 8, 68, 204, 1, 6, 196, 5, 76, 70,
+    76, 68, 144, 8, 68, 80, 68, 144, 196, 1, 6, 132, 12, 70, 78, 68,
+    140, 8, 68, 74, 134, 196, 4, 70, 80, 6, 4, 80, 68, 8, 16, 12,
+    132, 10, 198, 2, 196, 4, 76, 70, 80, 68, 8, 12, 14, 132, 10, 134,
+    142, 196, 4, 8, 6, 70, 78, 68, 8, 202, 26, 196, 2, 6, 72, 6,
+    132, 70, 82, 132, 18, 70, 82, 132, 18, 10, 4, 202, 1, 4, 8, 6,
+    132, 70, 82, 132, 18, 70, 82, 132, 18, 72, 68, 134, 136, 132, 70, 82,
+    132, 18, 70, 82, 132, 18, 14, 4, 204, 0, 14, 4, 8, 6, 132, 70,
+    82, 132, 18, 70, 82, 132, 18, 206, 3, 10, 70, 132, 70, 82, 132, 18,
+    70, 82, 132, 210, 55, 8, 68, 198, 0, 4, 8, 6, 132, 70, 16, 18,
+    132, 20, 70, 82, 132, 20, 136, 198, 0, 136, 132, 70, 82, 132, 20, 70,
+    82, 132, 212, 55, 8, 68, 200, 2, 6, 132, 70, 80, 132, 16, 70, 80,
+    132, 16, 12, 68, 8, 198, 0, 72, 132, 70, 80, 132, 16, 70, 80, 132,
+    208, 84, 8, 6, 4, 136, 138, 68, 196, 1, 8, 132, 16, 70, 80, 132,
+    16, 12, 68, 204, 2, 8, 132, 70, 16, 8, 132, 16, 70, 80, 132, 208,
+    55, 196, 1, 70, 196, 2, 70, 12, 16, 132, 16, 70, 80, 132, 16, 10,
+    68, 204, 0, 196, 3, 6, 76, 132, 16, 70, 80, 132, 16, 12, 8, 4,
+    204, 2, 196, 1, 6, 16, 8, 132, 16, 70, 80, 132, 80, 8, 6, 80,
+    8, 208, 0, 196, 0, 134, 196, 0, 198, 0, 196, 0, 72, 68, 134, 72,
+    196, 0, 70, 12, 18, 132, 16, 70, 82, 132, 16, 10, 132, 8, 6, 196,
+    3, 70, 78, 132, 14, 70, 78, 132, 14, 10, 4, 6, 2, 202, 1, 196,
+    0, 70, 78, 132, 14, 70, 78, 132, 206, 55, 6, 68, 198, 1, 8, 6,
+    4, 86, 70, 16, 18, 132, 16, 70, 82, 132, 16, 136, 74, 70, 136, 4,
+    90, 70, 16, 18, 132, 16, 70, 82, 132, 208, 84, 8, 132, 72, 6, 72,
+    68, 92, 134, 14, 132, 16, 70, 78, 132, 208, 55, 6, 68, 72, 70, 10,
+    70, 132, 70, 78, 132, 14, 70, 78, 132, 14, 10, 68, 204, 0, 10, 72,
+    132, 70, 78, 132, 14, 70, 78, 132, 206, 84, 10, 132, 136, 74, 196, 0,
+    70, 76, 132, 12, 70, 76, 132, 204, 26, 196, 3, 70, 132, 74, 6, 74,
+    132, 14, 70, 82, 132, 14, 10, 68, 74, 70, 10, 196, 0, 72, 6, 74,
+    132, 14, 70, 78, 132, 14, 10, 6, 2, 202, 1, 6, 196, 1, 6, 8,
+    6, 132, 14, 70, 78, 132, 78, 70, 142, 6, 14, 74, 196, 0, 134, 196,
+    0, 198, 0, 196, 0, 8, 132, 198, 0, 8, 132, 74, 70, 10, 132, 18,
+    70, 78, 132, 18, 10, 132, 200, 1, 132, 74, 6, 74, 132, 16, 70, 76,
+    132, 16, 10, 132, 12, 202, 0, 132, 72, 70, 12, 132, 12, 70, 76, 132,
+    76, 6, 4, 2, 204, 2, 68, 74, 134, 132, 198, 1, 196, 0, 8, 132,
+    200, 0, 132, 22, 74, 6, 74, 132, 12, 70, 80, 132, 12, 10, 132, 200,
+    0, 10, 196, 1, 6, 74, 132, 10, 70, 12, 14, 132, 10, 70, 132, 134,
+    72, 196, 0, 6, 74, 132, 14, 70, 78, 132, 78, 68, 202, 0, 14, 4,
+    6, 196, 0, 6, 74, 132, 14, 70, 78, 132, 78, 10, 4, 142, 6, 14,
+    8, 6, 196, 0, 134, 196, 0, 198, 0, 196, 29, 72, 6, 4, 198, 0,
+    72, 196, 0, 6, 74, 132, 16, 70, 78, 132, 16, 12, 132, 8, 198, 0,
+    196, 1, 6, 74, 132, 12, 70, 76, 132, 76, 132, 204, 2, 196, 0, 6,
+    6, 8, 132, 12, 70, 76, 132, 204, 26, 8, 70, 4, 74, 70, 72, 4,
+    154, 6, 74, 132, 12, 70, 78, 132, 12, 10, 132, 202, 1, 196, 1, 6,
+    74, 132, 10, 70, 74, 132, 202, 84, 8, 68, 8, 198, 0, 4, 8, 198,
+    1, 16, 18, 136, 20, 6, 4, 82, 132, 20, 12, 72, 12, 198, 0, 4,
+    200, 0, 70, 82, 136, 20, 6, 4, 82, 132, 212, 7, 202, 74, 8, 68,
+    10, 134, 196, 1, 70, 16, 18, 136, 16, 6, 4, 82, 132, 208, 55, 8,
+    132, 10, 198, 0, 132, 138, 6, 10, 136, 18, 6, 4, 78, 132, 18, 10,
+    8, 6, 4, 12, 198, 0, 4, 200, 1, 74, 136, 16, 6, 4, 78, 132,
+    208, 31, 200, 21, 68, 8, 198, 3, 68, 70, 8, 14, 132, 16, 70, 78,
+    132, 16, 12, 68, 12, 198, 1, 72, 68, 70, 8, 14, 132, 16, 70, 78,
+    132, 208, 84, 10, 132, 10, 198, 1, 132, 70, 8, 14, 132, 12, 70, 78,
+    132, 204, 55, 10, 132, 12, 198, 1, 68, 138, 8, 10, 132, 14, 70, 74,
+    132, 14, 10, 132, 12, 198, 1, 196, 1, 72, 132, 12, 70, 76, 132, 204,
+    26, 196, 1, 198, 1, 132, 134, 196, 0, 16, 70, 76, 132, 16, 72, 4,
+    136, 198, 0, 196, 0, 70, 196, 0, 16, 70, 76, 132, 16, 10, 68, 200,
+    0, 138, 196, 0, 70, 196, 0, 12, 70, 76, 132, 76, 68, 76, 70, 204,
+    0, 132, 134, 196, 0, 198, 0, 196, 29, 10, 132, 198, 0, 88, 132, 134,
+    196, 0, 10, 70, 10, 14, 132, 74, 132, 72, 6, 138, 132, 134, 196, 0,
+    10, 70, 78, 132, 74, 68, 2, 74, 6, 74, 70, 132, 134, 196, 0, 198,
+    0, 196, 29, 8, 132, 140, 134, 132, 134, 196, 0, 12, 6, 4, 72, 132,
+    12, 10, 132, 12, 138, 196, 2, 134, 196, 100, 134, 72, 196, 0, 70, 132,
+    80, 70, 76, 132, 16, 8, 68, 140, 6, 8, 196, 2, 70, 196, 0, 12,
+    70, 76, 132, 204, 55, 72, 68, 198, 0, 72, 196, 0, 70, 196, 0, 12,
+    70, 12, 16, 132, 76, 132, 198, 2, 196, 0, 70, 196, 0, 10, 70, 12,
+    14, 132, 10, 14, 132, 74, 6, 204, 0, 132, 134, 196, 0, 198, 0, 196,
+    29, 6, 132, 74, 70, 72, 68, 92, 70, 196, 0, 10, 70, 74, 132, 14,
+    8, 132, 140, 6, 72, 196, 0, 70, 196, 0, 12, 70, 72, 132, 204, 56,
+    8, 68, 8, 198, 0, 196, 4, 136, 12, 6, 4, 12, 16, 132, 76, 132,
+    8, 198, 2, 196, 5, 10, 70, 76, 132, 202, 85, 8, 4, 202, 1, 72,
+    6, 132, 6, 82, 132, 16, 70, 82, 132, 16, 14, 72, 78, 70, 14, 8,
+    72, 132, 6, 82, 132, 16, 70, 82, 132, 208, 84, 12, 8, 68, 76, 6,
+    12, 72, 196, 0, 6, 78, 132, 16, 70, 78, 132, 208, 55, 12, 8, 68,
+    202, 0, 12, 8, 132, 72, 74, 132, 12, 70, 80, 132, 12, 14, 8, 6,
+    4, 76, 70, 14, 72, 196, 0, 74, 132, 12, 70, 78, 132, 204, 1, 200,
+    110, 132, 6, 74, 200, 2, 74, 4, 200, 0, 74, 82, 72, 4, 14, 68,
+    200, 0, 74, 68, 200, 0, 74, 4, 200, 0, 74, 82, 72, 4, 14, 10,
+    4, 202, 2, 68, 202, 2, 4, 200, 0, 74, 78, 72, 4, 14, 200, 0,
+    70, 74, 8, 4, 200, 0, 74, 4, 200, 0, 74, 82, 72, 4, 78, 4,
+    204, 0, 14, 10, 8, 4, 200, 0, 74, 4, 200, 0, 74, 78, 72, 4,
+    206, 26, 4, 136, 134, 136, 4, 136, 74, 4, 200, 0, 74, 80, 72, 4,
+    20, 4, 200, 0, 70, 10, 72, 4, 136, 74, 4, 200, 0, 74, 80, 72,
+    4, 20, 8, 68, 198, 0, 132, 200, 0, 74, 4, 200, 0, 74, 80, 72,
+    4, 16, 136, 198, 0, 72, 4, 200, 0, 74, 4, 200, 0, 74, 80, 72,
+    4, 16, 4, 72, 4, 198, 0, 72, 4, 136, 74, 4, 200, 0, 74, 76,
+    72, 4, 16, 6, 200, 0, 134, 72, 196, 0, 74, 4, 200, 0, 74, 76,
+    72, 4, 16, 8, 68, 200, 1, 68, 8, 132, 74, 4, 200, 0, 74, 76,
+    72, 4, 16, 12, 68, 12, 198, 0, 68, 200, 0, 74, 4, 200, 0, 74,
+    76, 72, 4, 16, 68, 72, 198, 0, 200, 2, 74, 4, 200, 0, 74, 82,
+    72, 4, 14, 132, 72, 6, 138, 4, 200, 0, 74, 4, 200, 0, 74, 76,
+    72, 4, 16, 8, 6, 4, 72, 6, 136, 4, 12, 132, 10, 68, 200, 0,
+    74, 76, 72, 4, 204, 55, 196, 0, 198, 1, 4, 200, 0, 74, 4, 200,
+    0, 74, 82, 72, 4, 14, 6, 10, 68, 198, 1, 4, 200, 0, 74, 4,
+    200, 0, 74, 78, 72, 4, 10, 132, 72, 6, 138, 4, 200, 0, 74, 4,
+    200, 0, 74, 76, 72, 4, 16, 8, 68, 140, 138, 4, 200, 0, 74, 4,
+    8, 136, 74, 76, 72, 4, 204, 55, 72, 68, 134, 72, 4, 200, 0, 74,
+    4, 200, 0, 74, 78, 72, 4, 78, 132, 198, 1, 4, 200, 0, 74, 4,
+    200, 0, 74, 78, 72, 4, 202, 26, 136, 68, 70, 136, 196, 0, 74, 4,
+    200, 0, 74, 82, 72, 4, 14, 4, 72, 6, 74, 70, 72, 196, 0, 74,
+    4, 200, 0, 74, 82, 72, 4, 14, 6, 68, 198, 1, 196, 2, 74, 4,
+    200, 0, 74, 78, 72, 4, 14, 136, 78, 70, 72, 196, 0, 138, 4, 200,
+    0, 74, 78, 72, 4, 14, 68, 136, 70, 8, 6, 8, 196, 0, 10, 68,
+    200, 0, 74, 6, 14, 72, 4, 18, 6, 4, 136, 134, 72, 196, 0, 74,
+    4, 200, 0, 74, 76, 72, 4, 16, 6, 132, 72, 134, 196, 1, 74, 4,
+    200, 0, 74, 76, 72, 4, 16, 8, 132, 76, 6, 196, 3, 74, 4, 200,
+    0, 74, 76, 72, 4, 12, 4, 70, 4, 72, 70, 72, 196, 0, 74, 4,
+    200, 0, 74, 78, 72, 4, 74, 198, 4, 8, 196, 0, 74, 4, 200, 0,
+    74, 78, 72, 4, 74, 68, 74, 70, 10, 196, 0, 90, 74, 4, 200, 0,
+    74, 78, 72, 4, 10, 14, 68, 202, 0, 14, 72, 68, 90, 138, 200, 0,
+    202, 0, 200, 0, 68, 200, 0, 70, 6, 136, 76, 10, 68, 200, 0, 74,
+    6, 12, 72, 4, 16, 68, 70, 72, 70, 72, 68, 202, 0, 4, 200, 0,
+    74, 200, 0, 4, 16, 8, 132, 72, 6, 72, 132, 88, 74, 4, 200, 0,
+    74, 200, 0, 4, 12, 8, 132, 140, 136, 68, 92, 138, 200, 0, 202, 0,
+    200, 0, 68, 72, 198, 0, 72, 68, 90, 74, 4, 200, 0, 74, 78, 72,
+    4, 10, 132, 198, 0, 74, 4, 200, 0, 74, 4, 200, 0, 74, 78, 72,
+    4, 74, 68, 198, 0, 10, 6, 4, 200, 0, 74, 4, 200, 0, 202, 0,
+    72, 4, 202, 55, 8, 68, 4, 198, 0, 68, 200, 0, 74, 4, 200, 0,
+    74, 76, 72, 4, 16, 196, 0, 200, 1, 4, 200, 0, 74, 4, 200, 0,
+    74, 200, 0, 4, 204, 55, 8, 132, 198, 0, 196, 2, 74, 4, 200, 0,
+    74, 78, 72, 4, 74, 132, 198, 0, 74, 196, 0, 138, 200, 0, 202, 0,
+    200, 0, 70, 4, 72, 70, 74, 6, 200, 0, 74, 4, 200, 0, 74, 78,
+    72, 4, 78, 68, 202, 0, 14, 8, 6, 136, 6, 74, 4, 200, 0, 202,
+    0, 72, 4, 202, 24, 200, 29, 6, 4, 198, 0, 8, 6, 200, 0, 74,
+    4, 200, 0, 74, 78, 72, 4, 16, 12, 132, 12, 198, 1, 136, 6, 10,
+    6, 4, 200, 0, 74, 76, 72, 4, 204, 55, 8, 70, 4, 78, 198, 0,
+    132, 8, 74, 4, 200, 0, 74, 78, 72, 4, 204, 55, 4, 72, 68, 134,
+    136, 196, 2, 200, 0, 6, 6, 80, 72, 4, 20, 200, 2, 70, 4, 72,
+    196, 2, 200, 0, 70, 80, 72, 4, 20, 8, 68, 200, 1, 196, 5, 200,
+    0, 70, 80, 72, 4, 16, 12, 72, 76, 134, 72, 196, 3, 200, 0, 70,
+    80, 72, 4, 16, 4, 136, 198, 0, 136, 196, 2, 200, 0, 70, 84, 72,
+    4, 16, 10, 4, 72, 4, 198, 0, 72, 198, 0, 68, 200, 0, 70, 82,
+    72, 4, 14, 10, 132, 72, 198, 0, 196, 3, 200, 0, 70, 82, 72, 4,
+    14, 10, 8, 68, 74, 70, 72, 196, 3, 200, 0, 70, 78, 72, 4, 14,
+    8, 4, 72, 74, 70, 4, 6, 200, 1, 68, 200, 0, 134, 14, 72, 4,
+    18, 8, 4, 200, 1, 134, 72, 148, 68, 8, 198, 2, 12, 72, 4, 16,
+    8, 132, 204, 1, 196, 4, 200, 0, 70, 76, 72, 4, 16, 12, 8, 6,
+    4, 76, 134, 8, 6, 68, 72, 68, 200, 0, 70, 78, 72, 4, 12, 136,
+    68, 198, 0, 72, 196, 2, 200, 0, 70, 76, 72, 4, 16, 200, 2, 198,
+    0, 8, 196, 2, 200, 0, 70, 76, 72, 4, 16, 8, 68, 200, 2, 196,
+    4, 200, 0, 70, 76, 72, 4, 76, 68, 76, 198, 0, 8, 196, 3, 200,
+    0, 70, 76, 72, 4, 12, 68, 72, 134, 72, 4, 8, 196, 2, 200, 0,
+    70, 4, 16, 72, 4, 12, 8, 4, 72, 4, 198, 0, 72, 196, 2, 200,
+    0, 70, 78, 72, 4, 74, 132, 72, 70, 74, 68, 196, 1, 200, 0, 70,
+    78, 72, 4, 74, 132, 74, 198, 0, 196, 3, 200, 0, 70, 74, 72, 4,
+    10, 6, 4, 200, 0, 134, 4, 8, 196, 2, 200, 0, 70, 4, 10, 72,
+    4, 14, 8, 4, 200, 1, 134, 8, 4, 212, 0, 4, 8, 198, 1, 200,
+    0, 4, 14, 8, 132, 204, 2, 196, 3, 200, 0, 70, 200, 0, 4, 76,
+    132, 76, 198, 1, 68, 134, 4, 200, 0, 70, 74, 72, 4, 12, 8, 4,
+    72, 198, 2, 4, 200, 1, 4, 198, 2, 4, 16, 72, 4, 12, 132, 72,
+    198, 1, 4, 136, 70, 4, 200, 0, 134, 136, 4, 12, 132, 140, 198, 0,
+    4, 8, 68, 70, 4, 200, 0, 134, 136, 4, 204, 4, 196, 51, 198, 2,
+    4, 136, 70, 4, 200, 0, 134, 14, 72, 4, 74, 132, 198, 2, 4, 136,
+    70, 4, 200, 0, 134, 14, 72, 4, 198, 55, 196, 0, 72, 198, 0, 196,
+    3, 200, 0, 134, 136, 4, 12, 196, 0, 140, 198, 0, 196, 2, 200, 0,
+    198, 0, 200, 31, 202, 24, 132, 72, 198, 1, 196, 2, 200, 0, 134, 14,
+    72, 4, 74, 132, 72, 198, 1, 196, 2, 200, 0, 134, 12, 72, 4, 6,
+    132, 72, 70, 138, 4, 136, 74, 4, 200, 0, 74, 76, 72, 4, 12, 8,
+    68, 140, 6, 10, 70, 4, 136, 74, 4, 200, 0, 74, 76, 72, 4, 200,
+    57, 68, 198, 0, 72, 4, 136, 74, 4, 200, 0, 74, 12, 14, 72, 4,
+    12, 14, 132, 198, 2, 4, 136, 74, 4, 200, 0, 202, 0, 8, 8, 4,
+    202, 55, 8, 132, 80, 70, 196, 2, 74, 4, 200, 0, 202, 0, 72, 4,
+    204, 84, 14, 8, 68, 74, 134, 72, 196, 2, 200, 0, 70, 12, 14, 72,
+    4, 12, 14, 132, 74, 198, 1, 196, 2, 200, 0, 70, 74, 72, 4, 200,
+    18, 200, 7, 68, 134, 136, 196, 6, 70, 82, 132, 14, 10, 72, 138, 6,
+    10, 6, 72, 196, 6, 70, 82, 132, 14, 74, 4, 202, 2, 196, 8, 70,
+    78, 132, 142, 8, 78, 70, 78, 8, 196, 7, 70, 78, 132, 14, 200, 0,
+    198, 0, 8, 6, 8, 196, 6, 134, 14, 132, 18, 8, 4, 136, 198, 0,
+    72, 196, 6, 70, 76, 132, 16, 10, 132, 76, 6, 138, 196, 7, 70, 76,
+    132, 16, 76, 68, 76, 6, 140, 196, 7, 70, 76, 132, 12, 200, 0, 198,
+    0, 136, 202, 0, 4, 196, 1, 70, 80, 132, 12, 10, 4, 72, 138, 6,
+    10, 72, 4, 8, 90, 196, 2, 70, 78, 132, 10, 14, 10, 68, 202, 0,
+    12, 10, 196, 7, 70, 78, 132, 10, 78, 6, 4, 78, 70, 78, 6, 132,
+    8, 196, 2, 70, 74, 132, 12, 200, 0, 74, 134, 4, 6, 200, 0, 68,
+    200, 0, 6, 4, 6, 14, 132, 206, 84, 136, 68, 134, 136, 196, 0, 6,
+    196, 1, 70, 12, 14, 132, 74, 72, 198, 0, 10, 4, 72, 196, 0, 6,
+    196, 1, 70, 12, 14, 132, 202, 55, 6, 136, 198, 0, 136, 196, 0, 6,
+    196, 1, 70, 74, 132, 14, 68, 136, 198, 0, 72, 196, 0, 6, 196, 1,
+    70, 72, 132, 204, 55, 200, 0, 68, 70, 136, 4, 150, 6, 196, 1, 70,
+    76, 132, 8, 10, 4, 72, 198, 0, 12, 72, 196, 0, 70, 196, 0, 198,
+    0, 196, 6, 198, 49, 136, 10, 198, 0, 4, 6, 200, 1, 4, 200, 0,
+    6, 4, 6, 10, 132, 206, 113, 72, 132, 6, 74, 72, 204, 0, 142, 204,
+    0, 78, 82, 140, 14, 68, 202, 0, 14, 74, 4, 204, 0, 142, 204, 0,
+    78, 82, 140, 14, 10, 4, 202, 0, 14, 10, 8, 4, 204, 0, 78, 8,
+    76, 206, 2, 140, 14, 6, 8, 76, 70, 78, 10, 4, 204, 0, 142, 204,
+    0, 78, 82, 140, 78, 4, 206, 2, 74, 204, 0, 142, 204, 0, 206, 0,
+    204, 29, 4, 136, 10, 70, 76, 8, 4, 140, 10, 78, 204, 0, 10, 14,
+    80, 140, 20, 4, 200, 0, 70, 74, 8, 4, 140, 10, 78, 204, 0, 10,
+    14, 80, 140, 20, 8, 68, 198, 0, 72, 4, 204, 0, 10, 78, 204, 0,
+    10, 14, 80, 140, 20, 12, 72, 202, 0, 72, 4, 204, 0, 10, 78, 204,
+    0, 10, 14, 80, 140, 20, 4, 72, 4, 198, 0, 72, 4, 12, 68, 138,
+    204, 0, 74, 76, 140, 16, 200, 1, 134, 72, 196, 0, 138, 204, 0, 74,
+    204, 1, 16, 8, 68, 200, 2, 4, 12, 4, 76, 138, 204, 0, 74, 204,
+    1, 80, 68, 16, 198, 0, 68, 204, 0, 138, 204, 0, 74, 78, 140, 16,
+    68, 72, 198, 0, 72, 204, 0, 138, 204, 0, 74, 82, 140, 14, 132, 72,
+    6, 138, 4, 76, 68, 74, 6, 204, 0, 74, 204, 1, 16, 12, 6, 4,
+    72, 6, 140, 4, 12, 132, 74, 6, 204, 0, 74, 204, 60, 196, 0, 198,
+    1, 4, 76, 72, 74, 6, 140, 138, 82, 140, 14, 6, 10, 68, 10, 198,
+    0, 4, 12, 136, 74, 6, 204, 0, 74, 78, 204, 0, 132, 76, 4, 138,
+    4, 76, 72, 138, 204, 0, 74, 204, 1, 16, 12, 68, 204, 0, 138, 76,
+    72, 138, 204, 0, 202, 0, 204, 58, 8, 6, 68, 10, 68, 72, 4, 76,
+    72, 138, 204, 0, 74, 82, 140, 78, 132, 10, 196, 1, 12, 6, 72, 138,
+    204, 0, 74, 78, 204, 29, 136, 68, 70, 136, 68, 138, 12, 10, 72, 76,
+    74, 82, 72, 12, 14, 4, 72, 10, 76, 6, 10, 72, 68, 72, 138, 72,
+    76, 74, 82, 72, 12, 14, 8, 68, 202, 0, 70, 132, 70, 138, 72, 76,
+    74, 82, 72, 12, 14, 12, 6, 8, 82, 70, 72, 132, 70, 10, 12, 10,
+    72, 76, 74, 82, 72, 12, 14, 68, 136, 70, 136, 68, 70, 10, 4, 10,
+    72, 76, 74, 78, 72, 12, 18, 6, 4, 72, 12, 134, 72, 68, 202, 1,
+    72, 76, 74, 76, 72, 12, 16, 8, 132, 72, 134, 132, 72, 74, 6, 72,
+    76, 74, 76, 72, 12, 16, 12, 132, 80, 196, 2, 70, 138, 72, 76, 74,
+    76, 72, 12, 16, 4, 70, 4, 72, 70, 72, 196, 0, 138, 200, 0, 74,
+    78, 136, 74, 70, 138, 134, 8, 196, 0, 138, 200, 0, 74, 78, 136, 202,
+    55, 68, 200, 0, 70, 200, 2, 10, 4, 10, 200, 0, 74, 76, 136, 16,
+    8, 4, 70, 72, 70, 72, 196, 0, 138, 200, 0, 138, 200, 0, 208, 55,
+    68, 72, 138, 6, 72, 196, 0, 138, 200, 0, 74, 78, 136, 10, 132, 200,
+    0, 74, 4, 200, 0, 74, 6, 200, 0, 74, 78, 136, 74, 68, 74, 68,
+    10, 70, 200, 0, 138, 200, 0, 202, 0, 200, 59, 132, 198, 0, 68, 200,
+    0, 74, 6, 200, 0, 74, 76, 136, 16, 8, 132, 200, 1, 4, 8, 132,
+    74, 6, 200, 0, 138, 200, 0, 204, 55, 8, 132, 202, 0, 196, 1, 8,
+    74, 6, 200, 0, 74, 78, 136, 202, 26, 70, 4, 76, 70, 78, 8, 204,
+    0, 78, 10, 204, 0, 206, 0, 140, 206, 84, 12, 8, 6, 4, 10, 200,
+    1, 204, 0, 10, 14, 10, 204, 0, 10, 142, 140, 80, 132, 16, 198, 0,
+    4, 204, 0, 10, 12, 10, 204, 0, 10, 204, 62, 70, 4, 82, 134, 8,
+    68, 70, 138, 72, 76, 74, 14, 14, 72, 204, 56, 4, 72, 68, 8, 70,
+    136, 204, 0, 74, 8, 140, 6, 10, 80, 136, 20, 10, 72, 140, 70, 136,
+    202, 2, 8, 138, 6, 10, 80, 136, 20, 12, 68, 204, 1, 72, 4, 202,
+    2, 8, 138, 6, 10, 80, 136, 20, 16, 72, 80, 138, 72, 4, 204, 0,
+    74, 8, 140, 6, 10, 80, 136, 20, 4, 136, 74, 70, 136, 204, 0, 74,
+    8, 140, 6, 10, 84, 136, 16, 10, 4, 72, 4, 70, 74, 72, 204, 0,
+    74, 8, 140, 6, 10, 82, 136, 14, 10, 132, 76, 198, 0, 4, 200, 0,
+    10, 6, 72, 72, 6, 10, 82, 136, 78, 6, 68, 78, 68, 72, 4, 10,
+    136, 74, 200, 0, 6, 10, 82, 136, 14, 8, 4, 72, 76, 70, 4, 136,
+    134, 4, 10, 200, 0, 6, 10, 78, 136, 18, 10, 4, 72, 140, 70, 200,
+    2, 4, 10, 8, 6, 72, 6, 10, 76, 136, 16, 12, 132, 204, 1, 196,
+    0, 72, 10, 6, 200, 0, 6, 10, 76, 136, 80, 8, 6, 4, 80, 200,
+    5, 74, 8, 138, 6, 10, 78, 136, 16, 136, 68, 198, 0, 72, 196, 2,
+    200, 0, 70, 76, 136, 16, 10, 72, 140, 198, 0, 8, 196, 2, 200, 0,
+    70, 76, 136, 16, 12, 68, 204, 2, 196, 4, 200, 0, 70, 76, 136, 80,
+    68, 80, 198, 0, 196, 1, 132, 200, 0, 70, 78, 136, 16, 68, 72, 134,
+    200, 0, 196, 2, 200, 0, 70, 80, 136, 12, 10, 4, 72, 4, 198, 0,
+    72, 196, 2, 200, 0, 70, 78, 136, 74, 132, 12, 134, 74, 68, 198, 0,
+    4, 200, 0, 70, 78, 136, 10, 14, 132, 14, 10, 196, 7, 200, 0, 70,
+    78, 136, 12, 8, 4, 72, 74, 134, 72, 196, 2, 200, 0, 70, 74, 136,
+    14, 10, 4, 72, 140, 134, 8, 196, 2, 8, 6, 72, 70, 200, 1, 76,
+    132, 12, 200, 1, 132, 198, 0, 200, 0, 70, 10, 200, 0, 12, 16, 132,
+    80, 198, 0, 196, 3, 200, 0, 70, 74, 136, 76, 4, 72, 10, 198, 0,
+    136, 196, 1, 8, 6, 72, 70, 80, 136, 12, 132, 72, 4, 198, 0, 200,
+    0, 134, 72, 68, 134, 200, 0, 12, 8, 6, 4, 140, 198, 1, 8, 68,
+    134, 200, 0, 198, 0, 200, 58, 196, 0, 6, 4, 198, 0, 200, 0, 134,
+    72, 68, 134, 14, 136, 74, 132, 6, 4, 70, 76, 6, 8, 198, 1, 72,
+    68, 134, 14, 136, 198, 55, 8, 132, 76, 4, 134, 8, 132, 138, 72, 68,
+    134, 200, 0, 204, 84, 14, 132, 74, 4, 198, 0, 8, 196, 1, 72, 68,
+    134, 14, 136, 202, 26, 132, 76, 4, 6, 138, 8, 76, 4, 138, 76, 68,
+    74, 204, 59, 200, 27, 6, 68, 10, 4, 198, 0, 8, 76, 4, 138, 76,
+    68, 74, 78, 204, 0, 14, 132, 10, 4, 198, 1, 12, 6, 4, 138, 76,
+    68, 202, 0, 140, 202, 55, 12, 132, 80, 4, 6, 68, 6, 132, 138, 72,
+    68, 202, 0, 72, 204, 79, 206, 3, 6, 68, 78, 4, 198, 0, 8, 10,
+    68, 70, 72, 68, 6, 10, 78, 136, 204, 55, 136, 68, 134, 136, 68, 70,
+    74, 68, 72, 70, 82, 68, 8, 78, 72, 140, 6, 14, 6, 72, 68, 70,
+    72, 68, 72, 70, 82, 68, 8, 78, 10, 4, 206, 1, 10, 6, 132, 70,
+    72, 68, 72, 70, 82, 68, 8, 14, 82, 8, 82, 70, 82, 8, 132, 70,
+    74, 68, 72, 70, 82, 68, 8, 14, 200, 0, 74, 70, 136, 68, 74, 4,
+    10, 68, 72, 70, 78, 68, 8, 18, 12, 4, 136, 198, 0, 72, 68, 70,
+    10, 6, 4, 136, 70, 76, 68, 8, 16, 14, 132, 76, 6, 140, 132, 198,
+    0, 68, 72, 70, 76, 68, 8, 80, 12, 68, 80, 4, 144, 132, 134, 10,
+    68, 72, 70, 76, 68, 8, 16, 12, 136, 74, 70, 136, 74, 70, 72, 68,
+    72, 70, 80, 68, 8, 12, 14, 4, 72, 140, 6, 12, 72, 4, 202, 0,
+    6, 68, 72, 70, 78, 68, 8, 10, 14, 10, 68, 206, 1, 10, 196, 0,
+    8, 70, 68, 72, 70, 78, 68, 8, 10, 82, 6, 4, 82, 70, 82, 8,
+    68, 134, 10, 68, 72, 70, 78, 68, 8, 204, 68, 198, 42, 72, 68, 134,
+    136, 196, 0, 6, 196, 1, 70, 78, 132, 10, 14, 72, 138, 6, 14, 4,
+    72, 196, 0, 70, 196, 0, 198, 0, 196, 58, 200, 0, 198, 0, 136, 196,
+    0, 6, 196, 1, 70, 74, 132, 14, 12, 4, 136, 198, 0, 72, 196, 0,
+    6, 196, 1, 70, 72, 132, 204, 34, 200, 18, 6, 72, 74, 70, 136, 4,
+    142, 6, 196, 1, 70, 76, 132, 200, 203, 198, 23, 200, 0, 70, 74, 6,
+    200, 1, 74, 200, 0, 74, 6, 10, 72, 4, 202, 84, 200, 0, 198, 0,
+    8, 6, 200, 1, 74, 200, 0, 74, 6, 10, 72, 4, 76, 4, 72, 12,
+    198, 1, 200, 1, 74, 200, 0, 74, 6, 136, 4, 204, 53, 136, 6, 72,
+    78, 198, 0, 8, 196, 0, 74, 200, 0, 74, 6, 10, 72, 4, 200, 222,
+    196, 63, 200, 0, 6, 142, 4, 14, 216, 2, 14, 216, 2, 4, 14, 88,
+    12, 4, 202, 0, 12, 10, 8, 6, 4, 14, 216, 2, 14, 216, 2, 4,
+    14, 88, 200, 0, 74, 6, 16, 78, 4, 14, 216, 2, 14, 216, 2, 4,
+    14, 88, 14, 4, 206, 2, 74, 4, 14, 216, 2, 14, 216, 2, 4, 14,
+    88, 208, 3, 14, 70, 16, 14, 216, 2, 14, 216, 2, 4, 14, 216, 44,
+    204, 38, 72, 202, 0, 24, 78, 4, 14, 216, 2, 14, 216, 2, 4, 14,
+    216, 56, 10, 68, 200, 1, 10, 8, 68, 214, 2, 14, 214, 2, 4, 14,
+    86, 14, 68, 8, 198, 0, 72, 4, 14, 214, 2, 14, 214, 2, 4, 14,
+    214, 68, 202, 15, 4, 140, 138, 4, 12, 196, 0, 150, 14, 214, 2, 4,
+    14, 86, 14, 68, 206, 2, 8, 78, 4, 214, 1, 14, 214, 2, 4, 14,
+    214, 56, 132, 72, 70, 74, 68, 14, 140, 150, 14, 214, 2, 4, 14, 86,
+    12, 68, 204, 0, 74, 68, 14, 8, 68, 150, 14, 214, 2, 4, 14, 86,
+    78, 4, 206, 2, 4, 78, 132, 150, 14, 214, 2, 4, 14, 86, 82, 8,
+    210, 2, 8, 82, 4, 82, 150, 14, 214, 2, 4, 150, 72, 68, 10, 70,
+    72, 68, 14, 214, 2, 14, 214, 2, 4, 14, 86, 14, 132, 8, 198, 0,
+    68, 204, 0, 148, 14, 212, 2, 4, 14, 84, 12, 4, 6, 2, 204, 1,
+    4, 12, 14, 8, 212, 1, 14, 212, 2, 4, 14, 212, 85, 12, 72, 78,
+    70, 4, 78, 68, 214, 2, 10, 214, 2, 4, 8, 214, 58, 202, 24, 132,
+    76, 6, 196, 1, 140, 148, 10, 212, 2, 4, 8, 212, 56, 10, 68, 200,
+    0, 10, 70, 132, 70, 80, 20, 6, 212, 2, 4, 8, 84, 14, 68, 204,
+    0, 14, 72, 132, 70, 16, 84, 6, 212, 2, 4, 8, 212, 82, 202, 0,
+    132, 140, 74, 196, 0, 76, 14, 82, 6, 210, 2, 4, 8, 210, 27, 132,
+    200, 0, 6, 132, 200, 0, 148, 8, 150, 148, 4, 8, 86, 10, 68, 74,
+    72, 10, 6, 68, 200, 0, 20, 16, 20, 8, 212, 2, 4, 8, 84, 76,
+    2, 204, 1, 6, 4, 202, 1, 144, 8, 212, 2, 4, 8, 84, 80, 6,
+    144, 6, 16, 14, 6, 202, 1, 144, 8, 212, 2, 4, 8, 84, 8, 132,
+    198, 0, 196, 3, 148, 8, 212, 2, 4, 8, 84, 12, 132, 200, 1, 68,
+    200, 0, 138, 8, 146, 148, 4, 8, 82, 12, 132, 204, 1, 4, 202, 1,
+    18, 6, 18, 8, 82, 210, 0, 4, 8, 82, 78, 4, 2, 206, 1, 4,
+    202, 1, 142, 8, 210, 2, 4, 8, 82, 8, 132, 202, 0, 196, 3, 18,
+    6, 18, 8, 210, 2, 4, 8, 82, 10, 132, 202, 1, 196, 2, 138, 6,
+    146, 144, 4, 8, 82, 72, 4, 72, 134, 72, 4, 202, 0, 148, 10, 212,
+    2, 4, 8, 84, 14, 68, 206, 1, 72, 4, 14, 138, 148, 10, 212, 2,
+    4, 8, 84, 80, 4, 144, 6, 16, 10, 6, 16, 206, 0, 20, 80, 14,
+    212, 2, 4, 8, 212, 0, 6, 212, 2, 6, 212, 2, 80, 14, 212, 2,
+    4, 8, 84, 12, 72, 4, 202, 2, 4, 202, 0, 148, 8, 212, 2, 4,
+    8, 84, 14, 132, 8, 198, 0, 68, 200, 0, 18, 74, 8, 210, 2, 4,
+    8, 82, 14, 132, 206, 4, 132, 18, 6, 18, 12, 210, 2, 4, 8, 210,
+    0, 68, 82, 4, 210, 1, 132, 18, 142, 210, 2, 4, 8, 82, 12, 72,
+    4, 78, 70, 4, 8, 68, 136, 146, 8, 210, 2, 4, 8, 82, 14, 132,
+    204, 0, 14, 196, 2, 138, 6, 208, 2, 4, 8, 208, 0, 4, 2, 208,
+    1, 202, 2, 16, 6, 16, 8, 208, 2, 4, 8, 208, 85, 14, 72, 206,
+    1, 24, 78, 10, 216, 2, 8, 216, 2, 4, 6, 216, 85, 12, 8, 68,
+    76, 70, 76, 4, 10, 214, 2, 8, 214, 2, 4, 6, 214, 56, 12, 132,
+    202, 1, 196, 2, 148, 8, 212, 2, 4, 6, 84, 14, 72, 4, 78, 202,
+    0, 8, 202, 0, 148, 8, 212, 2, 4, 6, 212, 4, 204, 78, 68, 78,
+    198, 0, 72, 4, 16, 20, 72, 84, 6, 148, 6, 84, 4, 6, 212, 85,
+    12, 132, 74, 198, 0, 68, 76, 72, 82, 6, 146, 6, 82, 4, 6, 210,
+    28, 200, 25, 132, 202, 2, 196, 0, 72, 4, 10, 6, 12, 80, 6, 80,
+    4, 6, 80, 12, 132, 78, 198, 0, 196, 0, 72, 74, 6, 144, 6, 80,
+    4, 6, 208, 85, 74, 4, 204, 0, 138, 4, 10, 196, 2, 8, 16, 82,
+    6, 82, 4, 6, 82, 14, 68, 78, 70, 142, 4, 74, 198, 0, 4, 8,
+    146, 6, 82, 4, 6, 210, 23, 204, 59, 68, 2, 76, 6, 76, 10, 4,
+    74, 198, 0, 4, 8, 144, 6, 80, 4, 6, 208, 56, 12, 132, 204, 2,
+    4, 202, 2, 4, 8, 12, 78, 6, 80, 4, 6, 142, 132, 78, 68, 142,
+    202, 3, 8, 4, 78, 6, 78, 4, 6, 206, 47, 196, 8, 72, 134, 72,
+    68, 8, 70, 72, 4, 8, 146, 6, 84, 4, 8, 82, 12, 68, 140, 6,
+    12, 70, 68, 8, 70, 72, 4, 8, 146, 6, 82, 4, 8, 82, 78, 4,
+    206, 1, 70, 4, 78, 68, 76, 4, 8, 146, 6, 82, 4, 8, 210, 0,
+    8, 210, 3, 4, 82, 68, 76, 4, 8, 146, 6, 82, 4, 8, 82, 72,
+    68, 10, 134, 72, 68, 10, 72, 70, 4, 8, 146, 6, 82, 4, 8, 82,
+    14, 132, 8, 198, 1, 68, 198, 1, 4, 8, 146, 6, 80, 4, 8, 82,
+    14, 132, 78, 6, 78, 26, 4, 78, 72, 74, 4, 8, 146, 6, 80, 4,
+    8, 82, 80, 4, 2, 208, 2, 6, 80, 72, 76, 4, 8, 144, 6, 80,
+    4, 8, 80, 12, 132, 76, 70, 196, 3, 70, 4, 8, 144, 6, 80, 4,
+    8, 80, 12, 132, 140, 6, 76, 196, 1, 74, 4, 6, 8, 78, 6, 80,
+    4, 8, 206, 0, 68, 206, 1, 6, 4, 202, 0, 76, 4, 8, 142, 6,
+    80, 4, 8, 78, 82, 68, 82, 68, 210, 1, 68, 70, 10, 8, 4, 80,
+    6, 78, 4, 8, 208, 153, 208, 17, 8, 78, 74, 16, 4, 78, 74, 86,
+    4, 214, 2, 4, 86, 68, 214, 85, 76, 68, 78, 6, 12, 132, 74, 76,
+    4, 212, 2, 4, 84, 68, 212, 56, 76, 68, 202, 0, 12, 68, 202, 0,
+    4, 6, 210, 1, 4, 82, 68, 210, 3, 208, 225, 8, 78, 70, 16, 4,
+    72, 138, 70, 210, 2, 4, 82, 132, 18, 204, 85, 68, 78, 6, 12, 132,
+    138, 70, 208, 2, 4, 80, 132, 208, 55, 12, 10, 68, 202, 0, 12, 68,
+    202, 1, 6, 138, 78, 4, 78, 132, 206, 50, 200, 122, 134, 136, 4, 198,
+    0, 196, 2, 6, 80, 132, 18, 10, 72, 138, 6, 10, 4, 72, 4, 198,
+    0, 196, 2, 6, 80, 132, 18, 12, 10, 4, 204, 1, 10, 68, 202, 1,
+    196, 2, 6, 80, 132, 144, 8, 80, 70, 80, 8, 4, 202, 1, 196, 2,
+    6, 80, 132, 16, 200, 0, 198, 0, 136, 196, 4, 198, 0, 80, 132, 16,
+    12, 4, 136, 198, 0, 72, 196, 7, 6, 80, 132, 14, 12, 132, 76, 6,
+    140, 4, 200, 1, 196, 2, 6, 80, 132, 142, 68, 78, 12, 142, 4, 202,
+    1, 196, 2, 6, 78, 132, 14, 200, 0, 74, 70, 4, 72, 196, 7, 6,
+    78, 132, 14, 10, 4, 72, 138, 134, 8, 68, 152, 6, 196, 1, 6, 76,
+    132, 14, 12, 10, 68, 206, 0, 12, 10, 4, 202, 1, 196, 2, 6, 76,
+    132, 206, 69, 200, 132, 10, 70, 136, 4, 202, 7, 80, 4, 72, 18, 14,
+    72, 142, 6, 14, 136, 4, 12, 202, 6, 80, 4, 72, 18, 16, 14, 4,
+    208, 1, 14, 8, 4, 78, 140, 202, 3, 80, 4, 72, 18, 84, 8, 212,
+    2, 8, 4, 212, 1, 74, 12, 142, 10, 80, 4, 72, 18, 12, 136, 74,
+    70, 10, 10, 8, 4, 202, 2, 200, 0, 10, 80, 4, 72, 80, 4, 136,
+    198, 0, 72, 4, 200, 0, 74, 200, 0, 10, 80, 4, 72, 78, 132, 80,
+    6, 142, 4, 78, 136, 10, 6, 200, 0, 10, 80, 4, 72, 14, 82, 68,
+    82, 4, 146, 4, 82, 136, 74, 200, 0, 10, 80, 4, 72, 14, 12, 136,
+    78, 70, 4, 72, 68, 136, 74, 200, 0, 10, 78, 4, 72, 78, 4, 72,
+    142, 6, 14, 72, 196, 1, 74, 6, 136, 10, 76, 4, 72, 14, 16, 14,
+    68, 208, 1, 14, 4, 138, 72, 10, 6, 200, 0, 10, 76, 4, 72, 206,
+    59, 192, 252, 200, 3, 6, 136, 68, 212, 2, 4, 212, 2, 68, 84, 14,
+    4, 208, 0, 14, 4, 72, 68, 212, 2, 4, 212, 2, 68, 84, 16, 10,
+    208, 1, 10, 70, 16, 14, 212, 2, 4, 212, 2, 68, 212, 85, 136, 202,
+    0, 136, 4, 10, 212, 0, 86, 4, 212, 0, 86, 68, 212, 50, 206, 32,
+    68, 8, 198, 0, 72, 68, 210, 2, 4, 210, 2, 68, 210, 114, 14, 68,
+    206, 2, 8, 78, 4, 210, 1, 4, 210, 2, 68, 210, 45, 196, 10, 72,
+    198, 0, 132, 204, 0, 82, 4, 210, 2, 68, 82, 14, 68, 140, 14, 196,
+    1, 8, 132, 82, 4, 210, 2, 68, 82, 14, 10, 4, 206, 0, 74, 4,
+    78, 196, 0, 82, 4, 210, 2, 68, 210, 0, 8, 82, 12, 210, 2, 196,
+    13, 72, 68, 8, 70, 72, 68, 6, 204, 0, 82, 4, 212, 0, 82, 68,
+    84, 12, 132, 8, 198, 0, 132, 204, 0, 80, 4, 14, 208, 1, 68, 80,
+    12, 4, 6, 2, 204, 1, 4, 76, 8, 142, 80, 4, 208, 2, 68, 208,
+    40, 204, 42, 72, 80, 70, 12, 72, 68, 10, 148, 82, 4, 10, 148, 82,
+    68, 10, 212, 84, 10, 132, 76, 6, 196, 1, 10, 140, 82, 4, 10, 144,
+    82, 68, 10, 208, 63, 206, 18, 68, 204, 0, 14, 72, 132, 134, 80, 4,
+    10, 208, 1, 68, 10, 208, 84, 10, 132, 140, 74, 196, 0, 136, 78, 4,
+    10, 206, 1, 68, 10, 206, 26, 132, 200, 0, 6, 196, 4, 74, 4, 10,
+    148, 80, 68, 10, 20, 10, 68, 76, 70, 10, 6, 196, 3, 6, 10, 4,
+    10, 208, 1, 68, 10, 16, 12, 10, 2, 204, 1, 6, 4, 202, 4, 4,
+    10, 208, 1, 68, 10, 80, 10, 6, 144, 6, 16, 202, 6, 196, 36, 10,
+    132, 200, 1, 196, 3, 74, 4, 10, 142, 82, 68, 10, 78, 132, 140, 78,
+    4, 202, 2, 6, 14, 4, 10, 206, 1, 68, 10, 78, 10, 4, 2, 206,
+    0, 202, 6, 196, 36, 10, 132, 204, 0, 10, 196, 3, 74, 4, 10, 144,
+    76, 68, 10, 16, 72, 4, 72, 134, 72, 68, 200, 0, 74, 4, 14, 208,
+    1, 68, 14, 16, 12, 68, 208, 0, 12, 196, 0, 198, 0, 74, 4, 14,
+    208, 1, 68, 14, 80, 10, 4, 144, 6, 16, 10, 6, 16, 14, 200, 2,
+    196, 36, 136, 4, 202, 0, 72, 4, 202, 3, 4, 14, 144, 82, 68, 14,
+    16, 14, 132, 8, 198, 0, 196, 3, 74, 4, 206, 2, 68, 142, 132, 206,
+    4, 196, 0, 6, 14, 4, 206, 2, 68, 206, 27, 12, 72, 4, 80, 70,
+    72, 68, 198, 0, 74, 4, 10, 144, 78, 68, 10, 16, 12, 132, 204, 1,
+    196, 3, 74, 4, 10, 76, 140, 68, 10, 204, 113, 14, 72, 78, 138, 136,
+    6, 84, 72, 84, 4, 212, 2, 68, 212, 85, 12, 8, 68, 76, 70, 72,
+    4, 6, 76, 72, 18, 18, 4, 210, 2, 68, 210, 201, 14, 68, 78, 198,
+    0, 72, 4, 10, 144, 82, 4, 10, 144, 82, 68, 10, 208, 9, 204, 72,
+    132, 76, 198, 0, 68, 10, 140, 78, 4, 10, 144, 78, 68, 10, 208, 149,
+    206, 77, 68, 78, 70, 206, 0, 202, 3, 196, 94, 12, 68, 2, 76, 6,
+    76, 70, 202, 0, 136, 196, 38, 206, 24, 132, 204, 0, 142, 8, 202, 2,
+    196, 97, 72, 198, 1, 196, 5, 206, 0, 82, 68, 142, 68, 138, 6, 14,
+    196, 7, 206, 2, 68, 206, 53, 200, 1, 68, 8, 134, 72, 68, 198, 1,
+    68, 14, 146, 78, 68, 14, 18, 12, 132, 8, 198, 1, 132, 198, 0, 68,
+    14, 144, 76, 68, 14, 16, 12, 132, 80, 6, 76, 90, 78, 198, 1, 196,
+    36, 10, 132, 76, 70, 196, 7, 10, 140, 80, 68, 10, 12, 14, 132, 138,
+    6, 76, 196, 5, 8, 138, 78, 68, 202, 77, 208, 151, 8, 80, 74, 80,
+    72, 68, 210, 1, 4, 6, 210, 1, 68, 210, 72, 206, 11, 68, 78, 6,
+    12, 78, 132, 140, 80, 4, 6, 208, 1, 68, 208, 212, 208, 103, 8, 80,
+    70, 80, 72, 196, 101, 78, 68, 78, 6, 12, 142, 196, 20, 200, 252, 200,
+    0, 134, 136, 196, 8, 76, 132, 16, 136, 140, 6, 8, 4, 72, 196, 8,
+    76, 132, 208, 55, 200, 0, 198, 0, 136, 4, 202, 1, 196, 2, 12, 16,
+    132, 76, 4, 72, 198, 1, 72, 196, 8, 12, 14, 132, 202, 55, 6, 136,
+    74, 70, 136, 196, 8, 74, 132, 14, 8, 4, 72, 140, 6, 136, 68, 216,
+    1, 196, 230, 200, 11, 70, 136, 68, 200, 0, 196, 2, 76, 132, 16, 12,
+    72, 144, 6, 12, 4, 72, 68, 198, 1, 196, 65, 200, 0, 74, 70, 136,
+    4, 202, 1, 196, 2, 80, 132, 12, 18, 4, 136, 198, 0, 72, 196, 8,
+    78, 132, 202, 55, 12, 136, 82, 70, 136, 68, 70, 196, 4, 74, 132, 206,
+    239, 208, 133, 8, 208, 2, 72, 16, 6, 16, 212, 7, 2, 4, 16, 212,
+    84, 78, 68, 14, 14, 12, 142, 4, 14, 6, 204, 0, 210, 4, 2, 4,
+    210, 230, 200, 203, 74, 6, 72, 4, 72, 10, 198, 0, 4, 72, 16, 134,
+    16, 72, 4, 208, 21, 200, 120, 202, 0, 72, 4, 8, 74, 198, 0, 4,
+    72, 16, 134, 18, 72, 4, 208, 84, 14, 68, 8, 198, 0, 8, 4, 72,
+    4, 198, 0, 4, 8, 8, 14, 134, 14, 72, 4, 206, 200, 132, 72, 70,
+    72, 4, 72, 4, 198, 0, 4, 72, 14, 134, 14, 72, 4, 206, 11, 200,
+    71, 68, 10, 70, 72, 4, 72, 198, 1, 4, 72, 16, 134, 14, 72, 4,
+    16, 12, 132, 8, 198, 0, 4, 72, 198, 1, 4, 72, 12, 134, 12, 72,
+    4, 204, 114, 72, 80, 70, 72, 132, 198, 1, 4, 72, 16, 134, 14, 72,
+    4, 208, 84, 10, 132, 76, 6, 196, 2, 198, 0, 4, 72, 12, 134, 14,
+    72, 4, 204, 117, 192, 252, 200, 173, 4, 72, 134, 8, 6, 72, 198, 1,
+    4, 72, 12, 134, 12, 72, 4, 204, 49, 200, 34, 4, 202, 0, 8, 6,
+    8, 138, 134, 4, 72, 14, 134, 14, 72, 4, 78, 132, 8, 198, 0, 4,
+    72, 68, 134, 4, 72, 10, 134, 10, 72, 4, 202, 55, 12, 72, 4, 80,
+    70, 8, 6, 68, 198, 1, 4, 72, 12, 134, 12, 72, 4, 204, 73, 206,
+    66, 72, 76, 138, 72, 4, 74, 198, 0, 4, 72, 16, 134, 18, 72, 4,
+    208, 84, 10, 8, 68, 76, 70, 72, 4, 198, 2, 4, 72, 16, 134, 14,
+    72, 4, 208, 39, 206, 158, 68, 76, 198, 0, 72, 4, 138, 156, 136, 198,
+    0, 200, 66, 202, 18, 132, 76, 198, 1, 4, 134, 154, 136, 198, 0, 200,
+    206, 192, 252, 196, 88, 72, 134, 72, 4, 72, 10, 70, 10, 4, 72, 12,
+    134, 14, 72, 4, 204, 84, 72, 68, 10, 134, 72, 4, 72, 10, 70, 10,
+    4, 72, 12, 134, 14, 72, 4, 14, 12, 132, 8, 198, 1, 4, 72, 134,
+    10, 4, 72, 12, 6, 138, 72, 4, 204, 56, 132, 76, 70, 196, 1, 134,
+    10, 4, 8, 198, 1, 12, 72, 4, 204, 159, 206, 97, 8, 80, 74, 14,
+    72, 132, 10, 134, 132, 16, 134, 14, 132, 208, 84, 78, 68, 76, 6, 14,
+    72, 132, 10, 134, 132, 12, 134, 14, 132, 204, 9, 192, 252, 192, 252, 200,
+    202, 134, 8, 6, 200, 1, 70, 4, 8, 198, 1, 12, 72, 4, 204, 23,
+    206, 87, 4, 72, 198, 2, 200, 1, 70, 4, 8, 198, 1, 10, 72, 4,
+    202, 134, 200, 212, 10, 70, 8, 6, 136, 68, 134, 136, 134, 12, 72, 4,
+    204, 13, 200, 71, 74, 70, 8, 6, 72, 10, 68, 134, 136, 134, 12, 72,
+    4, 12, 18, 4, 136, 198, 1, 136, 68, 134, 136, 134, 10, 72, 4, 202,
+    55, 12, 136, 82, 70, 8, 6, 8, 196, 0, 134, 136, 134, 10, 72, 4,
+    202, 37, 192, 252, 208, 79, 8, 208, 2, 8, 4, 138, 198, 0, 68, 208,
+    1, 132, 208, 84, 78, 68, 78, 12, 142, 4, 138, 198, 0, 68, 206, 1,
+    132, 206, 27, 192, 252, 192, 252, 192, 252, 200, 157, 132, 6, 74, 72, 140,
+    6, 138, 4, 140, 138, 16, 140, 16, 68, 204, 0, 74, 68, 140, 6, 138,
+    4, 140, 138, 16, 140, 208, 26, 72, 76, 202, 0, 8, 4, 140, 6, 138,
+    4, 140, 138, 16, 140, 208, 55, 4, 136, 202, 0, 72, 4, 76, 202, 0,
+    4, 140, 138, 22, 140, 14, 4, 200, 0, 70, 10, 72, 4, 76, 6, 138,
+    4, 140, 138, 22, 140, 14, 8, 68, 198, 0, 8, 68, 140, 6, 138, 4,
+    140, 138, 18, 140, 14, 136, 202, 1, 8, 4, 140, 6, 138, 4, 140, 138,
+    18, 140, 14, 4, 72, 4, 202, 0, 72, 4, 12, 4, 202, 0, 4, 140,
+    138, 18, 204, 0, 10, 200, 0, 134, 72, 132, 6, 138, 4, 140, 138, 18,
+    204, 0, 10, 68, 74, 196, 1, 12, 4, 12, 6, 138, 4, 140, 138, 18,
+    204, 0, 18, 68, 12, 198, 0, 72, 204, 0, 202, 0, 140, 202, 0, 204,
+    0, 68, 72, 202, 0, 72, 76, 202, 1, 4, 140, 138, 16, 204, 0, 132,
+    72, 6, 138, 4, 76, 4, 6, 138, 4, 140, 138, 18, 204, 87, 196, 0,
+    198, 1, 4, 140, 6, 138, 4, 140, 138, 16, 204, 0, 8, 10, 68, 8,
+    198, 0, 4, 140, 6, 138, 4, 140, 138, 204, 1, 132, 76, 6, 138, 4,
+    140, 6, 138, 4, 140, 138, 18, 204, 87, 72, 68, 10, 70, 72, 4, 140,
+    6, 138, 4, 140, 138, 16, 204, 1, 132, 12, 198, 1, 204, 0, 202, 0,
+    140, 202, 0, 204, 29, 136, 68, 74, 136, 68, 202, 1, 4, 136, 138, 16,
+    136, 12, 4, 72, 138, 6, 10, 72, 68, 8, 6, 138, 4, 136, 138, 16,
+    136, 12, 8, 68, 204, 0, 196, 1, 70, 138, 4, 136, 138, 16, 136, 76,
+    72, 80, 70, 72, 132, 10, 6, 138, 4, 136, 138, 16, 136, 12, 68, 136,
+    74, 136, 68, 138, 132, 136, 138, 20, 136, 12, 10, 4, 72, 202, 0, 72,
+    68, 202, 1, 4, 136, 138, 18, 136, 12, 8, 132, 74, 134, 132, 8, 6,
+    138, 4, 136, 138, 18, 136, 76, 132, 78, 6, 196, 2, 6, 138, 4, 136,
+    138, 14, 136, 12, 4, 72, 4, 72, 70, 72, 132, 6, 138, 4, 136, 138,
+    12, 136, 204, 45, 196, 37, 200, 0, 70, 200, 1, 6, 10, 132, 136, 138,
+    18, 136, 12, 10, 4, 72, 198, 0, 72, 132, 6, 138, 4, 136, 138, 18,
+    136, 198, 55, 68, 200, 1, 6, 72, 132, 6, 138, 4, 136, 138, 12, 136,
+    12, 132, 200, 0, 74, 4, 200, 0, 138, 4, 72, 12, 138, 12, 136, 204,
+    40, 200, 41, 132, 198, 0, 68, 200, 0, 138, 4, 72, 12, 138, 18, 136,
+    12, 10, 132, 198, 2, 8, 140, 202, 0, 136, 202, 0, 200, 59, 132, 204,
+    0, 196, 2, 138, 4, 136, 138, 12, 136, 204, 26, 72, 4, 76, 70, 138,
+    204, 0, 138, 4, 76, 4, 138, 204, 10, 200, 77, 4, 202, 0, 72, 204,
+    0, 138, 4, 76, 4, 138, 18, 204, 88, 72, 4, 80, 70, 72, 68, 70,
+    138, 4, 72, 4, 138, 12, 136, 204, 30, 196, 22, 72, 68, 138, 136, 202,
+    2, 4, 136, 134, 22, 136, 12, 10, 72, 138, 134, 72, 6, 8, 70, 72,
+    4, 136, 134, 22, 136, 12, 10, 68, 202, 1, 8, 68, 6, 8, 70, 72,
+    4, 136, 134, 18, 136, 12, 14, 72, 78, 138, 12, 8, 4, 74, 70, 74,
+    4, 136, 134, 18, 136, 12, 4, 136, 202, 0, 136, 202, 2, 4, 136, 134,
+    18, 136, 12, 8, 4, 72, 4, 202, 0, 136, 202, 1, 4, 136, 134, 16,
+    136, 12, 10, 132, 76, 198, 0, 4, 198, 2, 4, 136, 134, 16, 136, 76,
+    8, 68, 76, 70, 72, 4, 8, 10, 198, 0, 4, 136, 134, 16, 136, 76,
+    4, 72, 70, 74, 4, 136, 138, 132, 136, 134, 20, 136, 204, 84, 136, 68,
+    202, 0, 72, 68, 202, 0, 4, 136, 134, 18, 200, 87, 68, 72, 6, 74,
+    200, 0, 4, 202, 1, 4, 136, 70, 78, 200, 1, 4, 72, 4, 202, 0,
+    72, 4, 8, 202, 0, 4, 136, 134, 12, 200, 59, 4, 200, 0, 138, 72,
+    4, 202, 1, 4, 136, 134, 16, 200, 116, 132, 198, 3, 4, 72, 134, 14,
+    4, 136, 134, 10, 136, 198, 84, 196, 0, 198, 2, 4, 72, 134, 14, 4,
+    136, 134, 10, 200, 0, 196, 0, 8, 134, 154, 136, 198, 0, 136, 198, 0,
+    200, 59, 132, 198, 2, 132, 6, 138, 4, 136, 134, 10, 136, 198, 10, 196,
+    131, 76, 70, 138, 4, 140, 202, 0, 140, 202, 0, 140, 202, 84, 72, 68,
+    10, 134, 72, 4, 140, 202, 0, 140, 202, 0, 204, 88, 132, 78, 70, 196,
+    2, 202, 0, 136, 202, 0, 200, 119, 200, 54, 68, 74, 6, 136, 68, 74,
+    196, 2, 134, 16, 132, 76, 72, 140, 6, 12, 4, 72, 68, 70, 196, 2,
+    134, 16, 132, 76, 10, 4, 204, 1, 10, 196, 0, 70, 196, 2, 134, 16,
+    132, 12, 80, 8, 80, 74, 80, 8, 132, 10, 6, 196, 2, 134, 16, 132,
+    12, 200, 0, 202, 0, 136, 68, 74, 196, 2, 134, 20, 132, 76, 4, 136,
+    202, 0, 72, 68, 74, 196, 2, 134, 18, 132, 12, 14, 132, 76, 6, 140,
+    196, 0, 6, 196, 2, 134, 18, 68, 4, 12, 78, 68, 78, 6, 142, 196,
+    0, 6, 196, 2, 134, 14, 132, 204, 222, 200, 6, 68, 134, 136, 132, 10,
+    70, 196, 0, 134, 12, 132, 200, 88, 198, 0, 136, 132, 10, 70, 196, 0,
+    134, 12, 132, 8, 12, 4, 72, 6, 10, 134, 72, 196, 0, 134, 132, 198,
+    0, 196, 75, 200, 245, 70, 74, 136, 136, 74, 4, 136, 138, 136, 4, 200,
+    88, 198, 0, 200, 3, 74, 4, 136, 202, 0, 72, 4, 200, 120, 200, 252,
+    8, 76, 10, 6, 74, 72, 76, 68, 138, 76, 4, 138, 140, 4, 204, 84,
+    200, 0, 74, 70, 136, 76, 68, 138, 76, 4, 138, 140, 4, 200, 110, 192,
+    252, 200, 38, 74, 6, 136, 4, 8, 138, 72, 4, 136, 70, 20, 4, 72,
+    76, 72, 140, 6, 12, 136, 4, 72, 70, 72, 4, 136, 70, 20, 4, 72,
+    12, 14, 10, 4, 206, 1, 10, 68, 78, 8, 70, 72, 4, 136, 70, 18,
+    4, 72, 12, 82, 8, 210, 2, 8, 4, 146, 70, 76, 4, 136, 70, 18,
+    4, 72, 12, 200, 0, 202, 0, 136, 4, 202, 0, 70, 4, 136, 70, 18,
+    4, 72, 12, 14, 4, 136, 202, 0, 72, 4, 6, 138, 70, 4, 136, 70,
+    16, 4, 72, 12, 14, 132, 78, 6, 142, 4, 78, 198, 1, 4, 136, 70,
+    16, 4, 72, 12, 80, 68, 80, 12, 144, 4, 80, 12, 70, 70, 4, 136,
+    70, 16, 4, 72, 204, 240, 200, 106, 74, 6, 136, 68, 202, 1, 196, 2,
+    18, 132, 200, 88, 202, 0, 136, 4, 202, 2, 196, 2, 14, 132, 8, 12,
+    4, 136, 10, 138, 72, 68, 202, 2, 196, 239, 200, 203, 74, 6, 200, 1,
+    74, 134, 4, 72, 134, 10, 72, 196, 23, 200, 62, 202, 0, 200, 0, 138,
+    134, 4, 72, 134, 10, 72, 196, 163, 192, 252, 200, 159, 138, 142, 8, 10,
+    86, 6, 150, 68, 214, 1, 68, 86, 16, 4, 208, 2, 74, 8, 14, 86,
+    6, 150, 68, 214, 1, 68, 86, 210, 4, 70, 82, 86, 18, 150, 68, 214,
+    1, 68, 214, 8, 204, 74, 72, 202, 0, 142, 4, 10, 86, 6, 12, 86,
+    68, 86, 12, 86, 68, 214, 85, 18, 68, 12, 198, 0, 72, 68, 84, 6,
+    12, 84, 68, 84, 12, 84, 68, 212, 32, 208, 79, 68, 208, 2, 8, 80,
+    4, 20, 6, 12, 84, 68, 84, 12, 84, 68, 212, 56, 132, 72, 6, 138,
+    4, 72, 76, 6, 12, 84, 68, 84, 12, 84, 68, 84, 14, 68, 206, 0,
+    74, 4, 8, 14, 8, 4, 6, 12, 84, 68, 84, 12, 84, 68, 84, 80,
+    4, 208, 2, 4, 80, 68, 16, 12, 84, 68, 212, 1, 68, 84, 84, 8,
+    212, 5, 68, 20, 140, 196, 36, 14, 132, 12, 198, 0, 132, 76, 6, 12,
+    82, 68, 82, 12, 82, 68, 82, 14, 4, 6, 2, 206, 1, 4, 78, 8,
+    18, 6, 12, 82, 68, 82, 12, 82, 68, 210, 85, 12, 72, 82, 70, 12,
+    78, 68, 84, 6, 12, 84, 68, 84, 12, 84, 68, 212, 22, 206, 176, 68,
+    208, 0, 14, 72, 132, 70, 12, 82, 68, 82, 12, 82, 68, 210, 46, 206,
+    36, 132, 140, 78, 196, 0, 12, 6, 12, 80, 68, 80, 12, 80, 68, 208,
+    114, 82, 6, 146, 6, 210, 3, 204, 0, 196, 50, 208, 42, 4, 2, 208,
+    6, 204, 0, 196, 65, 72, 4, 72, 70, 138, 8, 10, 76, 6, 16, 82,
+    68, 82, 16, 82, 68, 82, 16, 68, 206, 0, 16, 136, 14, 76, 6, 16,
+    82, 68, 82, 16, 82, 68, 210, 0, 4, 146, 6, 82, 6, 82, 76, 18,
+    144, 196, 36, 12, 72, 4, 202, 0, 8, 8, 4, 10, 76, 6, 12, 82,
+    68, 82, 12, 82, 68, 82, 16, 132, 12, 198, 0, 132, 72, 6, 12, 74,
+    68, 80, 12, 80, 68, 144, 132, 208, 4, 68, 6, 12, 6, 16, 68, 80,
+    12, 80, 68, 208, 176, 208, 22, 72, 80, 138, 16, 78, 10, 150, 8, 86,
+    68, 86, 4, 86, 68, 214, 200, 208, 114, 68, 78, 198, 0, 72, 4, 14,
+    210, 1, 68, 82, 12, 82, 68, 210, 108, 208, 235, 68, 80, 70, 208, 3,
+    198, 0, 196, 94, 14, 68, 2, 78, 6, 78, 74, 142, 198, 0, 196, 136,
+    196, 44, 72, 70, 10, 72, 4, 136, 6, 74, 132, 82, 6, 80, 68, 82,
+    12, 68, 142, 6, 12, 70, 4, 72, 70, 74, 132, 80, 6, 80, 68, 208,
+    56, 72, 68, 10, 134, 72, 68, 10, 70, 74, 132, 80, 6, 80, 68, 144,
+    132, 12, 198, 1, 196, 0, 134, 132, 78, 6, 80, 68, 78, 16, 132, 78,
+    6, 80, 92, 78, 8, 6, 138, 196, 15, 192, 252, 208, 53, 8, 80, 74,
+    80, 78, 68, 84, 8, 84, 70, 212, 1, 2, 4, 212, 170, 192, 252, 208,
+    5, 8, 80, 70, 80, 72, 196, 0, 134, 4, 202, 2, 194, 220, 192, 252,
+    192, 252, 200, 168, 10, 6, 138, 72, 138, 6, 74, 68, 76, 6, 80, 68,
+    8, 14, 16, 72, 142, 6, 16, 200, 0, 12, 74, 6, 74, 196, 38, 204,
+    24, 136, 74, 70, 136, 4, 138, 6, 74, 68, 76, 6, 78, 68, 8, 14,
+    16, 4, 72, 12, 198, 0, 72, 68, 72, 6, 10, 6, 68, 72, 6, 76,
+    68, 8, 206, 168, 192, 252, 210, 35, 12, 210, 2, 142, 18, 150, 4, 214,
+    1, 4, 86, 68, 214, 188, 192, 252, 210, 103, 8, 210, 2, 72, 14, 18,
+    206, 2, 196, 2, 194, 122, 192, 252, 192, 252, 192, 252, 200, 242, 202, 0,
+    200, 0, 74, 6, 74, 196, 0, 70, 16, 132, 204, 84, 200, 0, 202, 1,
+    72, 4, 138, 6, 74, 196, 0, 70, 16, 132, 12, 16, 4, 72, 12, 202,
+    0, 72, 68, 74, 198, 0, 196, 103, 192, 252, 200, 227, 138, 76, 136, 74,
+    6, 12, 82, 132, 18, 6, 82, 132, 18, 204, 142, 72, 202, 0, 76, 8,
+    4, 138, 6, 12, 82, 132, 20, 6, 82, 132, 212, 79, 192, 252, 192, 252,
+    204, 12, 72, 80, 70, 136, 68, 74, 6, 8, 82, 132, 16, 6, 82, 132,
+    208, 209, 192, 252, 200, 197, 4, 72, 70, 74, 136, 74, 6, 8, 78, 132,
+    14, 6, 78, 132, 206, 25, 204, 56, 72, 4, 202, 0, 72, 4, 138, 6,
+    8, 78, 132, 16, 6, 80, 132, 208, 165, 206, 90, 72, 80, 138, 76, 8,
+    6, 138, 8, 82, 132, 18, 6, 82, 132, 210, 131, 192, 252, 192, 252, 192,
+    252, 196, 112, 72, 70, 10, 72, 4, 72, 198, 0, 196, 0, 12, 6, 12,
+    14, 132, 208, 111, 192, 252, 210, 121, 8, 80, 74, 82, 76, 68, 74, 136,
+    4, 158, 134, 196, 104, 192, 252, 192, 252, 192, 252, 192, 252, 200, 236, 10,
+    6, 74, 200, 0, 74, 6, 72, 132, 70, 78, 132, 206, 84, 12, 136, 74,
+    70, 136, 4, 138, 6, 72, 196, 0, 6, 76, 132, 206, 129, 192, 252, 210,
+    103, 12, 210, 2, 12, 8, 18, 6, 18, 74, 4, 210, 4, 132, 210, 119,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 200, 54, 202, 0,
+    200, 0, 74, 6, 76, 196, 0, 70, 12, 132, 200, 88, 202, 1, 72, 4,
+    138, 6, 76, 196, 0, 70, 12, 132, 200, 55, 192, 252, 192, 252, 192, 252,
+    192, 252, 200, 223, 138, 76, 72, 74, 6, 10, 76, 200, 1, 74, 14, 72,
+    4, 210, 1, 204, 138, 72, 202, 0, 76, 72, 74, 6, 10, 76, 200, 1,
+    74, 14, 72, 4, 212, 83, 192, 252, 192, 252, 204, 8, 72, 80, 70, 136,
+    68, 202, 2, 200, 0, 138, 200, 216, 192, 252, 200, 193, 4, 72, 70, 74,
+    72, 202, 1, 8, 4, 200, 0, 74, 136, 4, 206, 29, 204, 52, 72, 4,
+    202, 0, 136, 202, 1, 8, 4, 200, 0, 74, 136, 4, 208, 169, 206, 86,
+    72, 80, 138, 76, 8, 74, 70, 76, 200, 1, 70, 14, 72, 4, 212, 135,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 200, 232, 10, 6, 10, 12, 10, 72, 202, 1, 12, 136,
+    14, 74, 4, 72, 4, 206, 84, 12, 136, 74, 70, 76, 72, 202, 0, 76,
+    136, 14, 74, 4, 72, 4, 206, 133, 192, 252, 210, 99, 12, 210, 2, 12,
+    8, 74, 18, 70, 76, 8, 196, 0, 6, 14, 132, 210, 123, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 200, 50, 202, 0, 136, 202, 2,
+    4, 136, 138, 72, 4, 204, 175, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 200, 87, 132, 6, 78, 12, 8, 140, 10, 142, 8,
+    204, 0, 142, 204, 0, 68, 204, 0, 142, 8, 140, 6, 142, 8, 204, 0,
+    142, 204, 29, 72, 76, 74, 206, 0, 204, 0, 206, 0, 204, 0, 142, 204,
+    51, 196, 4, 140, 138, 140, 4, 76, 74, 204, 3, 10, 204, 2, 4, 200,
+    0, 70, 14, 12, 8, 4, 76, 74, 76, 8, 204, 0, 10, 204, 2, 8,
+    68, 198, 0, 76, 8, 140, 6, 10, 76, 8, 204, 0, 10, 204, 3, 72,
+    204, 2, 8, 140, 74, 76, 8, 204, 0, 10, 204, 2, 4, 72, 4, 202,
+    0, 72, 4, 12, 4, 202, 0, 8, 204, 0, 138, 204, 87, 68, 72, 202,
+    0, 72, 140, 202, 0, 8, 204, 0, 138, 204, 0, 132, 72, 6, 138, 4,
+    76, 4, 6, 138, 4, 204, 0, 138, 204, 87, 196, 0, 198, 1, 4, 140,
+    6, 138, 4, 204, 0, 138, 204, 29, 132, 76, 6, 202, 0, 204, 0, 202,
+    0, 204, 0, 138, 204, 41, 200, 44, 68, 10, 70, 74, 4, 140, 6, 138,
+    4, 204, 0, 138, 204, 61, 68, 74, 140, 68, 138, 140, 72, 202, 1, 200,
+    87, 68, 140, 74, 140, 68, 138, 4, 76, 72, 202, 1, 200, 87, 4, 72,
+    4, 72, 70, 72, 132, 6, 138, 200, 1, 138, 200, 87, 68, 200, 0, 70,
+    200, 1, 6, 10, 4, 10, 200, 1, 138, 200, 2, 196, 113, 200, 0, 138,
+    200, 0, 202, 0, 200, 0, 138, 200, 88, 132, 198, 0, 68, 200, 0, 138,
+    4, 200, 0, 138, 8, 200, 252, 204, 5, 72, 4, 202, 0, 72, 204, 0,
+    138, 4, 204, 0, 138, 204, 174, 4, 76, 68, 138, 204, 1, 74, 140, 8,
+    140, 6, 74, 136, 76, 72, 140, 70, 74, 8, 202, 1, 10, 72, 138, 6,
+    74, 136, 76, 68, 204, 2, 10, 8, 74, 70, 74, 72, 138, 6, 74, 136,
+    12, 16, 72, 80, 142, 76, 8, 78, 74, 76, 72, 140, 6, 74, 136, 12,
+    4, 140, 202, 0, 204, 1, 74, 140, 8, 140, 6, 74, 136, 204, 153, 200,
+    46, 68, 202, 0, 72, 68, 138, 200, 2, 134, 200, 87, 68, 72, 6, 74,
+    200, 0, 4, 202, 0, 200, 2, 134, 200, 64, 196, 167, 72, 198, 2, 136,
+    198, 0, 200, 0, 134, 200, 59, 196, 28, 198, 2, 4, 72, 198, 0, 4,
+    200, 0, 134, 200, 199, 200, 176, 68, 10, 134, 72, 4, 76, 4, 138, 4,
+    204, 0, 138, 140, 200, 46, 204, 240, 68, 74, 6, 140, 68, 74, 140, 68,
+    72, 70, 10, 68, 200, 240, 200, 192, 68, 134, 136, 196, 0, 134, 196, 0,
+    134, 196, 34, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 204, 222, 72,
+    74, 6, 140, 4, 202, 0, 140, 202, 2, 4, 72, 12, 14, 72, 14, 134,
+    14, 74, 8, 4, 12, 202, 1, 8, 202, 2, 4, 72, 12, 16, 14, 4,
+    208, 1, 14, 10, 8, 78, 12, 70, 12, 10, 8, 202, 2, 4, 72, 12,
+    84, 12, 212, 2, 12, 8, 148, 74, 76, 8, 206, 0, 74, 4, 72, 204,
+    170, 192, 252, 200, 36, 74, 6, 136, 68, 202, 2, 196, 198, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 204, 156, 72, 138, 140, 8, 138,
+    6, 140, 196, 76, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 200, 113, 76, 74, 12, 16, 78, 8, 152, 12, 152, 8,
+    14, 216, 2, 14, 88, 18, 4, 210, 2, 74, 8, 152, 16, 152, 8, 14,
+    216, 2, 14, 88, 20, 16, 212, 2, 70, 20, 152, 20, 152, 12, 14, 216,
+    2, 14, 216, 52, 210, 146, 68, 14, 198, 0, 136, 14, 86, 6, 150, 8,
+    14, 214, 2, 14, 214, 76, 210, 35, 68, 210, 2, 8, 82, 4, 22, 10,
+    150, 8, 14, 214, 2, 14, 214, 145, 8, 214, 5, 68, 214, 1, 206, 21,
+    192, 252, 210, 132, 68, 208, 0, 18, 72, 132, 70, 16, 84, 4, 8, 212,
+    2, 8, 212, 90, 212, 137, 16, 6, 148, 6, 212, 4, 144, 200, 94, 200,
+    85, 4, 76, 70, 12, 78, 8, 204, 0, 148, 8, 12, 212, 2, 12, 84,
+    16, 68, 210, 0, 16, 14, 10, 8, 18, 76, 14, 148, 8, 12, 212, 2,
+    12, 148, 16, 4, 148, 6, 84, 6, 212, 4, 12, 206, 88, 192, 252, 192,
+    252, 192, 252, 210, 191, 68, 82, 70, 210, 3, 198, 0, 200, 40, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 200, 122,
+    76, 10, 6, 140, 72, 204, 0, 78, 8, 204, 0, 14, 80, 72, 18, 16,
+    72, 146, 6, 16, 14, 76, 8, 140, 142, 8, 204, 81, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 204, 224, 74, 204, 0, 8, 204, 3, 8, 204, 9, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 220,
+};
+
+static const uint16_t index_2_2[] = {
+    0, 8, 19, 27, 41, 47, 49, 74, 83, 98,
+    100, 130, 135, 159, 170, 175, 177, 179, 234, 261,
+    284, 302, 310, 316, 326, 351, 390, 405, 442, 456,
+    497, 514, 519, 554, 572, 637, 667, 674, 688, 696,
+    722, 734, 752, 771, 785, 819, 838, 892, 914, 916,
+    941, 955, 972, 980, 985, 987, 989, 1024, 1046, 1072,
+    1117, 1126, 1175, 1200, 1227, 1257, 1280, 1288, 1293, 1345,
+    1369, 1409, 1439, 1462, 1492, 1506, 1546, 1576, 1598, 1638,
+    1655, 1669, 1689, 1694, 1717, 1732, 1752, 1764, 1778, 1786,
+    1791, 1817, 1841, 1858, 1878, 1887, 1908, 1918, 1957, 1965,
+    1967, 1975, 1984, 2001, 2016, 2024, 2026, 2028, 2045, 2066,
+    2079, 2090, 2092, 2094, 2105, 2117, 2149, 2161, 2211, 2234,
+    2236, 2238, 2240, 2274, 2286, 2343, 2351, 2353, 2362, 2392,
+    2426, 2439, 2482, 2490, 2492, 2494, 2499, 2520, 2525, 2530,
+    2532, 2534, 2536, 2568, 2616, 2667, 2696, 2698, 2706, 2741,
+    2757, 2784, 2806, 2823, 2825, 2849, 2878, 2911, 2939, 2985,
+    2993, 3003, 3035, 3074, 3148, 3196, 3244, 3289, 3317, 3361,
+    3400, 3457, 3482, 3494, 3496, 3498, 3549, 3574, 3628, 3659,
+    3674, 3701, 3712, 3714, 3716, 3718, 3751, 3777, 3824, 3867,
+    3898, 3900, 3902, 3967, 3997, 4037, 4043, 4045, 4047, 4049,
+    4090, 4121, 4178, 4180, 4182, 4184, 4186, 4188, 4230, 4244,
+    4290, 4315, 4317, 4319, 4321, 4355, 4374, 4430, 4435, 4437,
+    4439, 4441, 4479, 4510, 4562, 4567, 4569, 4571, 4579, 4611,
+    4656, 4677, 4679, 4681, 4683, 4705, 4732, 4744, 4753, 4755,
+    4757, 4759, 4761, 4763, 4790, 4799, 4801, 4803, 4805, 4835,
+    4853, 4855, 4857, 4859, 4861, 4866, 4894, 4896, 4898, 4900,
+    4902, 4929, 4964, 5003, 5020, 5022, 5024, 5026, 5069, 5104,
+    5153, 5156, 5158, 5160, 5169, 5228, 5282, 5303, 5305, 5307,
+    5309, 5325, 5363, 5394, 5399, 5401, 5403, 5405, 5407, 5409,
+    5411, 5419, 5437, 5455, 5460, 5462, 5464, 5466, 5479, 5490,
+    5516, 5528, 5530, 5532, 5534, 5562, 5586, 5588, 5590, 5592,
+    5594, 5596, 5611, 5621, 5623, 5625, 5627, 5629, 5631, 5633,
+    5635, 5637, 5639, 5641, 5643, 5645, 5647, 5702, 5720, 5826,
+    5871, 5873, 5875, 5877, 5879, 5899, 5980, 5988, 5990, 5992,
+    5994, 6033, 6061, 6110, 6112, 6114, 6116, 6118, 6120, 6122,
+    6124, 6126, 6128, 6130, 6132, 6134, 6136, 6138, 6140, 6142,
+    6144, 6146, 6148, 6190, 6196, 6198, 6200, 6202, 6204, 6209,
+    6245, 6253, 6255, 6257, 6259, 6275, 6277, 6279, 6281, 6283,
+    6285, 6287, 6289, 6291, 6293, 6295, 6297, 6299, 6301, 6303,
+    6305, 6307, 6309, 6311, 6313, 6315, 6317, 6319, 6321, 6323,
+    6325, 6327, 6329, 6331, 6333, 6335, 6337, 6339, 6341, 6343,
+    6345, 6347, 6349, 6351, 6353, 6355, 6357, 6359, 6361, 6363,
+    6365, 6367, 6369, 6371, 6373, 6375, 6377, 6379, 6381, 6383,
+    6385, 6408, 6419, 6421, 6423, 6425, 6427, 6435, 6469, 6499,
+    6530, 6532, 6534, 6536, 6553, 6583, 6585, 6587, 6589, 6591,
+    6593, 6595, 6597, 6599, 6601, 6603, 6605, 6607, 6609, 6611,
+    6613, 6615, 6617, 6619, 6621, 6623, 6625, 6627, 6629, 6631,
+    6633, 6635, 6637, 6639, 6641, 6728, 6752, 6754, 6756, 6758,
+    6760, 6765, 6811, 6815, 6817, 6819, 6821, 6823, 6825, 6827,
+    6829, 6831, 6833, 6835, 6837, 6839, 6841, 6843, 6845, 6847,
+    6849, 6851, 6853, 6855, 6857, 6859, 6861, 6863, 6865, 6867,
+    6869, 6871, 6873, 6875, 6877, 6879, 6881, 6883, 6885, 6887,
+    6889, 6891, 6893, 6895, 6897, 6899, 6901, 6903, 6905, 6907,
+    6909, 6911, 6913, 6915, 6917, 6919, 6921, 6923, 6925, 6927,
+    6929, 6931, 6933, 6935, 6937, 6939, 6941, 6943, 6945, 6947,
+    6949, 6951, 6953, 6955, 6957, 6959, 6961, 6963, 6965, 6967,
+    6969, 6971, 6973, 6975, 6977, 6979, 6981, 6983, 6985, 6987,
+    6989, 6991, 6993, 6995, 6997, 6999, 7001, 7003, 7005, 7007,
+    7009, 7011, 7013, 7015, 7017, 7019, 7021, 7023, 7025, 7027,
+    7029, 7031, 7033, 7035, 7037, 7039, 7041, 7049, 7066, 7068,
+    7070, 7072, 7074, 7076, 7093, 7098, 7100, 7102, 7104, 7106,
+    7108, 7110, 7112, 7114, 7116, 7118, 7120, 7122, 7124, 7126,
+    7128, 7130, 7132, 7134, 7136, 7138, 7140, 7142, 7144, 7146,
+    7148, 7150, 7152, 7154, 7156, 7158, 7160, 7162, 7164, 7166,
+    7168, 7170, 7172, 7174, 7176, 7178, 7180, 7182, 7252, 7269,
+    7271, 7273, 7275, 7277, 7279, 7281, 7283, 7285, 7287, 7289,
+    7291, 7293, 7295, 7297, 7299, 7301, 7303, 7305, 7307, 7309,
+    7311, 7313, 7315, 7317, 7319, 7321, 7323, 7325, 7327, 7329,
+    7331, 7333, 7335, 7337, 7339, 7341, 7343, 7345, 7347, 7349,
+    7351, 7353, 7355, 7357, 7359, 7361, 7363, 7365, 7367, 7369,
+    7371, 7373, 7375, 7377, 7379, 7381, 7383, 7385, 7387, 7389,
+    7391, 7393, 7395, 7397, 7399, 7401, 7403, 7405, 7407, 7409,
+    7411, 7413, 7415, 7417, 7419, 7421, 7423, 7425, 7427, 7429,
+    7431, 7433, 7435, 7437, 7439, 7441, 7443, 7445, 7447, 7449,
+    7451, 7453, 7455, 7457, 7459, 7461, 7463, 7465, 7467, 7469,
+    7471, 7473, 7475, 7477, 7479, 7481, 7483, 7485, 7487, 7489,
+    7491, 7493, 7495, 7497, 7499, 7501, 7503, 7505, 7507, 7509,
+    7511, 7513, 7515, 7517, 7519, 7521, 7523, 7525, 7527, 7529,
+    7531, 7533, 7535, 7537, 7539, 7541, 7543, 7545, 7547, 7549,
+    7551, 7553, 7555, 7557, 7559, 7561, 7563, 7565, 7567, 7569,
+    7571, 7573, 7575, 7577, 7579, 7581, 7583, 7585, 7587, 7589,
+    7591, 7593, 7595, 7597, 7599, 7601, 7603, 7605, 7607, 7609,
+    7611, 7613, 7615, 7617, 7619, 7621, 7623, 7625, 7627, 7629,
+    7631, 7633, 7635, 7637, 7639, 7641, 7643, 7645, 7647, 7649,
+    7651, 7653, 7655,
+};
+
+static const uint8_t data_2_2[] = {
+    192, 41, 82, 192, 102, 82, 192, 97, 192, 65, 82, 192, 128, 10, 192, 17,
+    14, 192, 26, 192, 73, 14, 192, 167, 14, 192, 2, 192, 133, 29, 192, 6,
+    14, 192, 12, 28, 192, 17, 32, 192, 64, 14, 192, 167, 14, 192, 79, 192,
+    252, 192, 200, 9, 192, 11, 9, 192, 1, 49, 205, 0, 0, 13, 128, 6,
+    0, 9, 5, 45, 192, 1, 45, 11, 192, 4, 13, 192, 55, 33, 192, 10,
+    33, 192, 176, 192, 166, 41, 37, 192, 32, 173, 192, 1, 45, 192, 20, 45,
+    192, 10, 192, 252, 192, 52, 12, 128, 12, 192, 9, 23, 192, 16, 6, 138,
+    4, 84, 15, 138, 192, 2, 5, 192, 9, 4, 192, 11, 148, 192, 59, 148,
+    192, 41, 192, 23, 148, 192, 222, 192, 15, 206, 0, 80, 192, 36, 208, 0,
+    192, 1, 12, 192, 52, 80, 192, 68, 208, 0, 192, 1, 12, 192, 37, 192,
+    43, 80, 192, 101, 10, 192, 86, 12, 192, 6, 192, 125, 12, 192, 122, 192,
+    252, 192, 252, 192, 0, 12, 128, 12, 192, 30, 6, 74, 0, 4, 20, 64,
+    74, 19, 128, 38, 192, 2, 6, 74, 192, 1, 74, 4, 192, 10, 4, 84,
+    192, 3, 12, 0, 12, 0, 4, 192, 43, 10, 128, 212, 0, 192, 6, 10,
+    192, 55, 148, 192, 3, 12, 0, 12, 192, 10, 192, 63, 10, 128, 212, 0,
+    192, 14, 10, 192, 125, 78, 64, 16, 192, 1, 70, 64, 132, 0, 6, 64,
+    78, 192, 4, 4, 0, 192, 6, 4, 64, 80, 192, 3, 12, 0, 12, 192,
+    50, 144, 192, 67, 80, 192, 3, 140, 192, 82, 144, 64, 192, 98, 10, 192,
+    49, 6, 10, 192, 1, 74, 192, 24, 12, 192, 4, 12, 192, 49, 192, 73,
+    12, 192, 4, 12, 192, 165, 192, 78, 230, 0, 192, 166, 192, 202, 14, 192,
+    37, 6, 82, 192, 0, 18, 18, 192, 0, 36, 192, 28, 36, 64, 210, 0,
+    192, 51, 14, 82, 192, 0, 82, 192, 65, 36, 64, 210, 0, 192, 67, 192,
+    12, 14, 82, 192, 0, 82, 192, 97, 10, 192, 10, 4, 192, 15, 102, 192,
+    3, 38, 192, 0, 16, 192, 11, 6, 74, 64, 38, 128, 10, 192, 12, 38,
+    20, 192, 5, 12, 192, 23, 192, 23, 16, 192, 68, 102, 20, 192, 5, 12,
+    192, 82, 16, 192, 52, 192, 81, 38, 192, 8, 16, 192, 1, 70, 64, 4,
+    128, 6, 64, 78, 64, 38, 192, 1, 4, 0, 70, 192, 2, 6, 0, 4,
+    64, 80, 192, 5, 12, 192, 50, 16, 192, 45, 192, 20, 80, 192, 4, 140,
+    192, 81, 16, 192, 102, 50, 192, 22, 192, 5, 38, 192, 13, 6, 10, 192,
+    2, 10, 128, 6, 0, 102, 192, 3, 6, 10, 0, 68, 128, 10, 0, 68,
+    64, 12, 192, 4, 12, 0, 12, 192, 124, 12, 192, 4, 12, 0, 12, 192,
+    36, 192, 186, 107, 192, 11, 47, 192, 2, 43, 128, 6, 0, 102, 128, 6,
+    192, 26, 192, 133, 12, 192, 114, 192, 73, 14, 64, 10, 192, 26, 36, 192,
+    3, 142, 192, 1, 14, 192, 2, 12, 192, 4, 228, 1, 192, 13, 36, 128,
+    206, 0, 192, 50, 142, 192, 1, 14, 192, 16, 192, 45, 36, 128, 206, 0,
+    192, 82, 142, 192, 1, 14, 192, 96, 33, 0, 33, 0, 33, 0, 24, 35,
+    192, 25, 33, 32, 192, 3, 35, 78, 192, 1, 14, 192, 1, 220, 0, 192,
+    3, 224, 0, 192, 0, 27, 192, 8, 29, 128, 206, 0, 192, 17, 29, 192,
+    11, 33, 192, 12, 35, 78, 192, 1, 14, 192, 5, 31, 192, 14, 27, 192,
+    15, 27, 192, 16, 29, 128, 206, 0, 192, 10, 29, 192, 1, 192, 13, 29,
+    192, 19, 33, 192, 20, 35, 78, 192, 1, 14, 192, 13, 31, 192, 22, 31,
+    192, 23, 31, 192, 24, 10, 192, 30, 102, 192, 39, 64, 38, 192, 145, 38,
+    192, 99, 192, 131, 38, 192, 31, 95, 192, 0, 70, 192, 2, 6, 192, 66,
+    192, 70, 102, 192, 6, 12, 192, 165, 192, 55, 38, 192, 25, 6, 192, 2,
+    39, 128, 6, 10, 0, 68, 0, 107, 10, 0, 68, 192, 9, 12, 192, 124,
+    12, 0, 192, 5, 12, 192, 198, 39, 192, 23, 43, 39, 192, 10, 0, 47,
+    192, 2, 43, 128, 6, 192, 10, 38, 192, 85, 47, 192, 65, 76, 192, 63,
+    192, 127, 74, 192, 24, 36, 0, 10, 192, 2, 78, 192, 1, 14, 192, 24,
+    100, 192, 44, 192, 18, 78, 192, 1, 14, 192, 160, 78, 192, 1, 14, 192,
+    50, 192, 43, 15, 33, 11, 33, 192, 3, 6, 44, 192, 18, 101, 32, 64,
+    198, 0, 64, 78, 192, 1, 14, 192, 1, 220, 0, 192, 87, 78, 192, 1,
+    14, 192, 43, 192, 112, 142, 192, 1, 14, 192, 97, 15, 29, 64, 37, 64,
+    15, 192, 4, 15, 192, 9, 192, 6, 14, 192, 1, 27, 192, 5, 27, 192,
+    6, 10, 64, 32, 128, 10, 128, 10, 192, 9, 29, 192, 9, 29, 192, 26,
+    37, 192, 12, 31, 14, 192, 1, 14, 192, 6, 31, 192, 14, 31, 192, 15,
+    31, 192, 16, 33, 192, 17, 33, 192, 18, 33, 192, 4, 192, 11, 37, 192,
+    19, 14, 35, 14, 192, 1, 14, 192, 14, 35, 192, 22, 35, 192, 23, 35,
+    192, 130, 192, 252, 192, 70, 16, 64, 20, 192, 13, 35, 74, 192, 15, 74,
+    192, 43, 96, 14, 36, 192, 51, 78, 192, 12, 78, 192, 7, 192, 48, 14,
+    192, 84, 78, 192, 3, 78, 192, 11, 78, 192, 83, 192, 16, 76, 192, 15,
+    6, 192, 46, 36, 192, 52, 10, 192, 13, 10, 192, 84, 192, 61, 10, 192,
+    21, 10, 192, 160, 192, 11, 36, 192, 236, 192, 252, 192, 252, 192, 21, 13,
+    192, 0, 12, 192, 0, 12, 192, 25, 6, 138, 4, 76, 202, 9, 192, 6,
+    68, 192, 11, 144, 128, 208, 0, 192, 52, 80, 192, 12, 80, 192, 51, 144,
+    128, 208, 0, 192, 191, 10, 64, 95, 64, 227, 0, 192, 18, 98, 192, 3,
+    31, 78, 64, 136, 192, 0, 192, 10, 162, 192, 13, 140, 192, 1, 140, 192,
+    47, 38, 192, 0, 140, 192, 11, 140, 192, 48, 140, 192, 1, 140, 192, 67,
+    192, 8, 38, 192, 0, 140, 192, 19, 140, 192, 75, 10, 128, 159, 192, 4,
+    68, 64, 98, 99, 192, 6, 98, 0, 99, 0, 98, 64, 95, 64, 4, 64,
+    227, 8, 192, 14, 34, 192, 4, 76, 128, 98, 12, 192, 30, 192, 93, 20,
+    76, 192, 1, 12, 192, 146, 192, 41, 14, 192, 0, 10, 192, 10, 36, 192,
+    1, 36, 192, 0, 70, 192, 7, 142, 0, 164, 0, 210, 21, 192, 3, 36,
+    192, 1, 36, 192, 1, 18, 192, 7, 74, 0, 100, 192, 35, 14, 82, 192,
+    1, 82, 192, 4, 146, 192, 34, 192, 15, 36, 128, 100, 18, 192, 15, 100,
+    192, 62, 14, 82, 192, 1, 82, 142, 192, 9, 146, 192, 80, 16, 192, 25,
+    192, 9, 74, 192, 1, 210, 21, 192, 15, 14, 192, 10, 100, 192, 36, 78,
+    192, 1, 82, 192, 5, 78, 192, 59, 14, 192, 47, 192, 33, 78, 192, 1,
+    82, 142, 192, 10, 78, 192, 89, 48, 192, 9, 70, 192, 3, 33, 192, 2,
+    40, 192, 0, 6, 192, 31, 100, 192, 21, 74, 100, 192, 37, 10, 192, 2,
+    18, 192, 6, 10, 192, 148, 14, 10, 192, 2, 18, 192, 14, 10, 192, 8,
+    192, 100, 33, 192, 72, 100, 192, 69, 192, 135, 14, 192, 112, 192, 4, 12,
+    192, 25, 6, 192, 0, 80, 192, 31, 144, 0, 4, 208, 0, 64, 80, 192,
+    1, 4, 192, 0, 76, 34, 0, 134, 192, 32, 10, 192, 0, 80, 192, 1,
+    16, 0, 10, 128, 10, 192, 9, 10, 192, 41, 12, 208, 0, 64, 80, 192,
+    19, 192, 58, 10, 192, 0, 80, 192, 1, 16, 0, 10, 192, 7, 10, 192,
+    9, 10, 192, 110, 166, 64, 12, 192, 29, 128, 144, 0, 12, 80, 192, 0,
+    80, 192, 8, 30, 192, 36, 38, 192, 0, 80, 192, 1, 16, 192, 6, 80,
+    192, 49, 12, 80, 192, 0, 80, 192, 81, 38, 192, 0, 80, 192, 1, 16,
+    64, 192, 12, 80, 192, 74, 30, 0, 6, 192, 28, 6, 10, 192, 8, 8,
+    192, 37, 76, 192, 1, 12, 0, 76, 192, 4, 98, 192, 41, 12, 64, 192,
+    0, 16, 192, 6, 12, 192, 50, 140, 192, 1, 12, 192, 86, 12, 192, 2,
+    16, 192, 14, 12, 192, 56, 192, 15, 30, 0, 6, 42, 192, 7, 223, 0,
+    192, 12, 6, 10, 192, 50, 76, 192, 1, 12, 0, 76, 192, 4, 98, 192,
+    114, 140, 192, 0, 76, 192, 194, 14, 0, 6, 192, 35, 6, 74, 192, 0,
+    202, 3, 192, 15, 40, 192, 8, 36, 192, 1, 14, 192, 1, 14, 192, 4,
+    32, 192, 36, 10, 78, 192, 0, 78, 192, 5, 10, 78, 192, 0, 78, 192,
+    47, 36, 192, 1, 14, 192, 1, 14, 192, 67, 192, 6, 10, 78, 192, 0,
+    78, 192, 13, 10, 78, 192, 0, 78, 192, 102, 138, 64, 32, 192, 4, 78,
+    192, 2, 14, 192, 69, 36, 192, 4, 192, 12, 18, 78, 192, 2, 14, 192,
+    6, 32, 192, 147, 18, 78, 192, 2, 14, 192, 14, 32, 192, 35, 192, 49,
+    6, 192, 21, 32, 128, 70, 0, 33, 0, 78, 192, 2, 14, 192, 1, 100,
+    192, 30, 96, 192, 11, 33, 192, 7, 70, 0, 36, 192, 21, 78, 192, 2,
+    14, 192, 5, 78, 192, 36, 192, 18, 96, 192, 16, 96, 192, 62, 78, 192,
+    2, 14, 192, 13, 78, 192, 112, 192, 89, 36, 192, 22, 10, 192, 2, 14,
+    192, 6, 10, 192, 113, 192, 32, 10, 192, 2, 14, 192, 14, 10, 192, 111,
+    6, 192, 5, 11, 192, 58, 45, 192, 0, 192, 12, 100, 192, 234, 192, 67,
+    10, 192, 21, 98, 192, 1, 98, 192, 1, 34, 192, 44, 76, 192, 1, 12,
+    192, 23, 34, 192, 56, 192, 39, 20, 76, 192, 1, 12, 192, 192, 30, 0,
+    6, 46, 192, 0, 223, 4, 192, 15, 6, 10, 192, 50, 76, 192, 1, 12,
+    192, 127, 140, 192, 1, 12, 192, 21, 192, 167, 30, 0, 6, 192, 28, 6,
+    10, 38, 192, 43, 192, 2, 76, 192, 1, 12, 192, 127, 140, 192, 1, 12,
+    192, 98, 192, 93, 38, 192, 118, 94, 192, 30, 192, 66, 12, 192, 181, 192,
+    49, 32, 192, 4, 70, 192, 1, 198, 33, 192, 59, 14, 74, 192, 1, 10,
+    192, 5, 18, 74, 192, 1, 10, 192, 56, 192, 81, 14, 74, 192, 1, 10,
+    192, 13, 18, 74, 192, 1, 10, 192, 108, 32, 192, 4, 70, 192, 1, 198,
+    4, 192, 47, 32, 192, 36, 138, 192, 1, 10, 192, 5, 138, 192, 1, 10,
+    192, 133, 192, 4, 138, 192, 1, 10, 192, 13, 138, 192, 1, 10, 192, 82,
+    44, 192, 30, 14, 192, 87, 192, 12, 14, 192, 165, 86, 14, 192, 63, 192,
+    72, 37, 192, 0, 70, 33, 5, 64, 14, 192, 61, 33, 192, 10, 33, 192,
+    22, 14, 192, 56, 192, 106, 18, 14, 192, 120, 40, 192, 14, 37, 37, 0,
+    35, 95, 0, 33, 9, 192, 5, 35, 192, 5, 31, 192, 6, 35, 192, 20,
+    33, 192, 9, 9, 192, 9, 109, 192, 21, 14, 192, 2, 35, 192, 13, 31,
+    192, 55, 33, 192, 48, 192, 30, 14, 192, 2, 35, 192, 210, 192, 252, 192,
+    65, 46, 192, 85, 12, 192, 92, 192, 39, 12, 192, 200, 12, 42, 192, 2,
+    192, 21, 34, 0, 12, 192, 16, 226, 0, 192, 26, 12, 192, 135, 12, 192,
+    29, 192, 58, 212, 0, 192, 101, 12, 38, 192, 59, 6, 0, 98, 192, 12,
+    192, 1, 12, 192, 135, 12, 192, 106, 192, 252, 192, 252, 192, 27, 44, 192,
+    25, 6, 192, 46, 32, 192, 52, 10, 192, 13, 10, 192, 64, 192, 79, 22,
+    18, 10, 192, 19, 22, 18, 10, 192, 99, 232, 1, 192, 12, 33, 128, 6,
+    192, 11, 192, 45, 32, 36, 192, 36, 32, 10, 192, 13, 10, 192, 141, 192,
+    2, 78, 10, 192, 19, 14, 18, 10, 192, 217, 192, 252, 192, 252, 192, 216,
+    13, 192, 17, 133, 37, 64, 141, 192, 1, 192, 20, 5, 192, 91, 140, 192,
+    67, 204, 0, 192, 54, 192, 138, 10, 21, 17, 0, 21, 17, 192, 13, 145,
+    128, 81, 192, 2, 205, 1, 192, 7, 13, 9, 64, 229, 0, 9, 5, 192,
+    39, 17, 205, 0, 128, 9, 192, 2, 17, 192, 3, 9, 192, 97, 8, 192,
+    134, 192, 62, 21, 17, 13, 21, 17, 13, 192, 12, 145, 128, 81, 192, 2,
+    77, 192, 3, 77, 192, 1, 13, 9, 5, 0, 37, 128, 9, 69, 192, 38,
+    17, 13, 192, 2, 9, 192, 2, 81, 192, 2, 9, 192, 3, 81, 192, 2,
+    9, 192, 41, 192, 45, 13, 192, 9, 85, 192, 2, 13, 192, 10, 85, 192,
+    2, 13, 192, 11, 21, 192, 3, 13, 192, 133, 192, 252, 192, 252, 192, 252,
+    192, 88, 14, 0, 16, 192, 3, 19, 192, 28, 36, 192, 3, 35, 192, 0,
+    11, 64, 74, 192, 1, 15, 228, 1, 0, 7, 192, 72, 138, 192, 2, 10,
+    192, 0, 192, 65, 202, 0, 192, 81, 138, 192, 2, 10, 192, 84, 192, 21,
+    19, 192, 0, 207, 3, 64, 37, 192, 14, 36, 192, 3, 35, 128, 37, 11,
+    71, 192, 3, 79, 192, 1, 7, 192, 0, 79, 100, 128, 7, 192, 61, 74,
+    192, 2, 10, 192, 8, 19, 192, 1, 11, 192, 7, 83, 192, 1, 11, 192,
+    8, 19, 192, 2, 11, 192, 19, 192, 78, 74, 192, 2, 10, 192, 161, 192,
+    252, 192, 131, 12, 192, 85, 76, 34, 192, 24, 192, 7, 14, 192, 1, 76,
+    192, 0, 76, 14, 192, 59, 8, 76, 192, 1, 204, 0, 192, 78, 14, 192,
+    1, 76, 192, 0, 76, 14, 192, 54, 192, 36, 10, 192, 29, 98, 209, 1,
+    0, 98, 192, 2, 34, 192, 5, 9, 192, 41, 209, 0, 64, 9, 155, 192,
+    0, 17, 192, 0, 34, 0, 201, 0, 192, 81, 192, 8, 20, 72, 192, 2,
+    8, 192, 193, 46, 192, 31, 17, 17, 192, 3, 77, 192, 9, 9, 5, 192,
+    40, 17, 192, 1, 9, 192, 3, 81, 192, 1, 9, 192, 4, 81, 192, 1,
+    9, 192, 82, 8, 192, 19, 21, 192, 1, 13, 192, 11, 85, 192, 1, 13,
+    192, 5, 192, 3, 21, 192, 2, 13, 192, 237, 192, 252, 192, 252, 192, 238,
+    10, 192, 9, 192, 18, 46, 192, 4, 46, 192, 18, 230, 1, 192, 104, 34,
+    192, 45, 8, 192, 17, 8, 192, 12, 192, 229, 38, 192, 18, 192, 86, 34,
+    192, 161, 192, 252, 192, 252, 192, 252, 192, 190, 6, 128, 20, 0, 27, 192,
+    1, 48, 192, 5, 37, 33, 0, 37, 35, 10, 192, 9, 32, 192, 1, 97,
+    0, 134, 192, 0, 99, 6, 0, 35, 35, 192, 1, 72, 192, 6, 31, 192,
+    37, 93, 192, 10, 97, 192, 4, 138, 192, 0, 99, 10, 192, 4, 138, 192,
+    2, 10, 192, 12, 91, 192, 14, 91, 192, 13, 74, 97, 192, 14, 74, 93,
+    192, 17, 93, 192, 18, 97, 192, 10, 64, 138, 192, 0, 99, 10, 14, 192,
+    11, 138, 192, 0, 95, 10, 192, 20, 95, 192, 22, 95, 192, 27, 27, 192,
+    0, 31, 44, 192, 11, 204, 7, 64, 32, 192, 5, 70, 192, 2, 6, 64,
+    35, 64, 32, 128, 10, 192, 4, 224, 0, 192, 53, 192, 6, 74, 192, 2,
+    10, 192, 5, 74, 192, 2, 10, 0, 32, 192, 138, 14, 74, 192, 2, 10,
+    192, 13, 74, 192, 2, 10, 192, 35, 192, 252, 192, 213, 34, 192, 28, 34,
+    192, 1, 128, 34, 192, 6, 230, 1, 72, 192, 21, 200, 27, 192, 36, 76,
+    192, 0, 140, 192, 5, 76, 192, 0, 140, 192, 43, 204, 0, 128, 140, 192,
+    8, 204, 6, 192, 29, 192, 134, 30, 0, 6, 46, 192, 6, 219, 4, 192,
+    18, 6, 10, 192, 68, 192, 58, 226, 1, 192, 41, 12, 72, 192, 2, 8,
+    192, 9, 72, 192, 2, 8, 192, 68, 226, 1, 192, 17, 226, 1, 192, 5,
+    192, 59, 12, 42, 192, 36, 34, 0, 12, 192, 18, 34, 192, 1, 222, 39,
+    192, 59, 226, 0, 192, 6, 192, 32, 16, 8, 192, 17, 8, 192, 70, 208,
+    0, 192, 18, 208, 0, 192, 88, 192, 252, 192, 158, 14, 192, 39, 102, 192,
+    4, 38, 192, 0, 80, 192, 5, 38, 192, 7, 38, 192, 1, 16, 0, 144,
+    0, 192, 59, 80, 192, 2, 16, 192, 6, 30, 192, 20, 98, 192, 23, 144,
+    192, 3, 16, 192, 7, 144, 192, 70, 80, 192, 2, 16, 192, 8, 192, 2,
+    30, 192, 119, 38, 192, 10, 16, 192, 1, 70, 128, 4, 128, 6, 64, 70,
+    192, 3, 6, 16, 4, 0, 76, 192, 61, 12, 192, 2, 16, 192, 1, 192,
+    1, 12, 192, 20, 98, 192, 24, 76, 192, 3, 16, 0, 76, 192, 5, 76,
+    192, 71, 12, 192, 2, 16, 192, 14, 12, 192, 66, 192, 5, 50, 192, 40,
+    38, 192, 15, 6, 10, 192, 3, 10, 64, 6, 10, 0, 132, 128, 10, 0,
+    4, 64, 8, 192, 5, 204, 29, 64, 12, 192, 23, 16, 192, 31, 98, 192,
+    25, 8, 192, 3, 16, 0, 76, 192, 0, 192, 2, 8, 192, 78, 16, 192,
+    162, 0, 102, 192, 6, 102, 192, 113, 98, 192, 118, 192, 109, 14, 192, 38,
+    36, 192, 4, 142, 192, 2, 14, 192, 1, 36, 0, 140, 128, 40, 128, 36,
+    192, 4, 36, 128, 206, 1, 128, 206, 28, 192, 7, 14, 40, 192, 1, 142,
+    192, 2, 14, 192, 2, 14, 0, 146, 192, 23, 36, 32, 192, 24, 36, 128,
+    206, 1, 128, 14, 192, 77, 142, 192, 2, 14, 192, 2, 14, 192, 5, 146,
+    192, 44, 192, 34, 24, 192, 5, 32, 192, 8, 29, 101, 35, 0, 223, 4,
+    192, 1, 32, 192, 1, 97, 64, 78, 192, 0, 99, 14, 35, 192, 0, 36,
+    192, 3, 8, 128, 36, 192, 8, 142, 97, 128, 206, 28, 192, 4, 97, 0,
+    14, 32, 192, 1, 10, 78, 192, 0, 99, 14, 192, 2, 14, 0, 10, 78,
+    192, 0, 95, 14, 192, 17, 28, 192, 10, 91, 192, 0, 192, 8, 142, 97,
+    128, 14, 192, 9, 142, 93, 0, 40, 192, 15, 93, 192, 18, 97, 192, 12,
+    10, 78, 192, 0, 99, 14, 192, 2, 14, 192, 5, 10, 78, 192, 0, 95,
+    14, 192, 20, 95, 192, 22, 95, 192, 31, 32, 192, 24, 64, 36, 128, 40,
+    192, 16, 36, 192, 2, 8, 192, 13, 10, 192, 2, 206, 28, 192, 2, 32,
+    192, 7, 138, 192, 2, 10, 192, 2, 14, 0, 138, 192, 2, 10, 192, 16,
+    96, 192, 29, 10, 192, 2, 14, 192, 10, 10, 192, 37, 192, 21, 138, 192,
+    2, 10, 192, 2, 14, 192, 5, 138, 192, 2, 10, 192, 87, 35, 192, 13,
+    101, 33, 0, 35, 31, 0, 97, 64, 100, 192, 11, 35, 192, 3, 36, 64,
+    14, 192, 4, 36, 192, 11, 33, 192, 17, 192, 29, 74, 192, 1, 35, 10,
+    192, 5, 74, 192, 1, 95, 192, 16, 96, 192, 32, 97, 192, 80, 14, 74,
+    192, 1, 99, 192, 38, 192, 57, 10, 192, 37, 98, 192, 9, 200, 0, 192,
+    15, 34, 192, 0, 72, 0, 140, 192, 2, 12, 192, 31, 38, 192, 8, 140,
+    0, 38, 192, 0, 204, 0, 128, 12, 192, 6, 204, 0, 0, 98, 12, 192,
+    10, 192, 0, 30, 192, 24, 140, 192, 2, 12, 192, 2, 12, 192, 1, 144,
+    192, 65, 38, 192, 0, 204, 0, 0, 98, 12, 192, 14, 204, 0, 0, 98,
+    12, 192, 68, 30, 0, 6, 192, 11, 192, 22, 6, 10, 192, 10, 8, 192,
+    22, 72, 0, 8, 76, 192, 2, 12, 192, 31, 6, 98, 192, 6, 140, 192,
+    3, 12, 192, 1, 12, 192, 7, 12, 128, 98, 12, 192, 14, 30, 192, 24,
+    8, 76, 192, 2, 12, 192, 2, 12, 192, 1, 8, 76, 192, 2, 12, 192,
+    8, 192, 52, 12, 128, 98, 12, 192, 15, 12, 128, 98, 12, 192, 68, 30,
+    0, 6, 192, 37, 6, 74, 192, 40, 72, 64, 192, 0, 8, 192, 96, 94,
+    192, 24, 12, 72, 192, 114, 192, 252, 192, 252, 192, 5, 14, 0, 16, 192,
+    46, 36, 192, 10, 36, 192, 2, 40, 192, 0, 36, 192, 1, 221, 42, 192,
+    8, 40, 192, 1, 138, 192, 3, 10, 192, 1, 10, 0, 146, 192, 23, 36,
+    224, 0, 192, 11, 29, 192, 10, 202, 1, 64, 202, 0, 128, 192, 71, 138,
+    192, 3, 10, 192, 1, 10, 192, 5, 146, 192, 82, 6, 192, 11, 32, 192,
+    30, 32, 192, 5, 134, 64, 192, 1, 6, 0, 8, 192, 0, 32, 192, 53,
+    36, 192, 1, 6, 192, 1, 138, 192, 3, 10, 192, 1, 10, 0, 138, 192,
+    3, 10, 192, 1, 10, 192, 10, 220, 0, 192, 26, 202, 1, 0, 32, 202,
+    0, 192, 7, 202, 1, 0, 8, 202, 0, 192, 52, 74, 10, 192, 3, 10,
+    192, 1, 10, 192, 5, 138, 192, 3, 10, 192, 1, 10, 192, 63, 14, 46,
+    192, 38, 102, 192, 10, 16, 192, 18, 38, 192, 60, 192, 6, 16, 192, 59,
+    34, 192, 3, 148, 192, 92, 20, 16, 192, 69, 192, 28, 46, 192, 39, 38,
+    192, 10, 16, 192, 18, 38, 39, 71, 192, 52, 98, 192, 9, 16, 192, 34,
+    99, 192, 19, 34, 64, 192, 2, 80, 192, 16, 80, 192, 71, 16, 192, 146,
+    192, 252, 192, 252, 192, 252, 192, 98, 36, 192, 5, 78, 192, 2, 14, 192,
+    14, 100, 192, 7, 78, 192, 37, 10, 192, 2, 14, 40, 192, 2, 78, 192,
+    2, 14, 192, 2, 14, 192, 26, 192, 18, 32, 192, 9, 78, 192, 83, 22,
+    78, 192, 2, 14, 192, 2, 14, 192, 5, 22, 82, 192, 89, 44, 128, 108,
+    128, 192, 19, 93, 32, 192, 5, 78, 192, 2, 14, 192, 1, 32, 192, 8,
+    96, 192, 7, 206, 0, 192, 31, 11, 25, 192, 5, 14, 32, 192, 2, 78,
+    192, 2, 14, 192, 2, 14, 192, 48, 28, 192, 8, 18, 206, 0, 192, 33,
+    192, 44, 142, 192, 2, 14, 192, 2, 14, 192, 5, 14, 82, 192, 2, 32,
+    192, 86, 44, 40, 192, 13, 37, 0, 33, 37, 35, 64, 97, 0, 157, 192,
+    11, 35, 192, 6, 31, 128, 99, 192, 12, 14, 0, 97, 192, 9, 93, 192,
+    35, 32, 14, 192, 1, 35, 14, 192, 2, 14, 192, 5, 95, 192, 51, 14,
+    64, 97, 192, 80, 142, 192, 1, 99, 192, 15, 192, 252, 192, 252, 192, 3,
+    10, 46, 192, 20, 98, 99, 192, 8, 98, 0, 91, 64, 98, 192, 3, 8,
+    64, 219, 9, 192, 3, 34, 128, 94, 64, 76, 192, 0, 94, 12, 192, 31,
+    38, 64, 95, 64, 102, 0, 95, 0, 12, 94, 192, 3, 12, 192, 13, 12,
+    192, 40, 30, 192, 4, 20, 76, 192, 2, 12, 192, 2, 12, 192, 0, 0,
+    20, 80, 192, 70, 16, 12, 192, 20, 16, 12, 192, 74, 30, 0, 6, 42,
+    192, 7, 223, 0, 192, 21, 6, 10, 192, 10, 8, 192, 7, 192, 15, 76,
+    192, 2, 12, 192, 7, 94, 192, 18, 6, 98, 192, 6, 12, 192, 5, 12,
+    192, 13, 12, 192, 49, 140, 192, 2, 12, 192, 2, 12, 192, 1, 12, 80,
+    192, 2, 30, 192, 62, 140, 192, 21, 12, 192, 223, 192, 252, 192, 252, 192,
+    252, 192, 4, 36, 192, 20, 79, 0, 100, 128, 199, 11, 192, 39, 40, 192,
+    2, 74, 192, 3, 10, 192, 1, 10, 192, 20, 19, 192, 2, 11, 192, 7,
+    19, 192, 3, 11, 96, 192, 9, 74, 192, 61, 192, 17, 22, 74, 192, 3,
+    10, 192, 1, 10, 192, 5, 22, 82, 192, 94, 44, 192, 0, 108, 192, 28,
+    32, 192, 6, 70, 192, 3, 6, 192, 44, 192, 12, 36, 192, 1, 6, 192,
+    2, 74, 192, 3, 10, 192, 1, 10, 64, 74, 192, 3, 10, 192, 1, 10,
+    192, 44, 14, 202, 0, 192, 13, 14, 202, 0, 0, 36, 192, 56, 14, 74,
+    192, 3, 10, 192, 1, 10, 192, 5, 14, 74, 192, 3, 10, 192, 1, 10,
+    192, 9, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 95, 19, 15,
+    192, 1, 37, 15, 128, 76, 15, 192, 3, 75, 192, 8, 6, 192, 12, 202,
+    0, 192, 23, 15, 11, 192, 1, 36, 11, 7, 192, 8, 15, 29, 192, 2,
+    11, 192, 15, 6, 192, 18, 192, 64, 36, 192, 76, 6, 192, 21, 6, 192,
+    11, 100, 192, 59, 192, 18, 19, 15, 11, 192, 0, 19, 15, 11, 192, 0,
+    15, 192, 3, 75, 192, 3, 75, 192, 47, 15, 11, 7, 192, 0, 36, 11,
+    71, 192, 7, 79, 192, 2, 11, 192, 3, 79, 192, 2, 11, 192, 90, 36,
+    192, 4, 192, 1, 19, 15, 192, 2, 15, 192, 10, 19, 15, 192, 2, 15,
+    192, 11, 19, 192, 3, 15, 192, 49, 100, 192, 136, 192, 252, 192, 252, 192,
+    252, 192, 45, 4, 64, 17, 192, 16, 34, 192, 4, 95, 128, 200, 0, 192,
+    5, 201, 0, 0, 31, 128, 98, 141, 192, 26, 9, 192, 32, 31, 128, 200,
+    0, 192, 63, 192, 0, 136, 192, 0, 200, 0, 192, 212, 17, 13, 192, 1,
+    17, 13, 192, 8, 34, 128, 192, 2, 95, 192, 2, 227, 5, 205, 0, 192,
+    3, 77, 31, 192, 5, 34, 141, 192, 5, 13, 9, 34, 128, 95, 73, 192,
+    31, 95, 64, 4, 128, 35, 192, 29, 17, 77, 192, 1, 13, 192, 7, 17,
+    192, 3, 13, 192, 3, 72, 192, 2, 8, 192, 0, 34, 192, 56, 192, 58,
+    98, 192, 188, 192, 252, 192, 252, 192, 252, 192, 14, 15, 64, 32, 192, 5,
+    70, 192, 2, 198, 6, 202, 26, 192, 4, 32, 11, 128, 72, 192, 4, 15,
+    32, 192, 1, 11, 192, 15, 70, 192, 2, 6, 192, 78, 32, 192, 31, 192,
+    41, 70, 192, 2, 6, 192, 7, 48, 192, 1, 70, 192, 2, 6, 192, 3,
+    96, 192, 78, 44, 192, 21, 15, 192, 4, 75, 128, 6, 192, 40, 192, 6,
+    32, 11, 7, 192, 8, 79, 192, 1, 11, 192, 4, 79, 192, 1, 11, 192,
+    0, 6, 192, 85, 36, 192, 11, 15, 192, 1, 15, 192, 11, 19, 15, 192,
+    1, 15, 192, 12, 19, 192, 2, 15, 192, 7, 18, 6, 192, 20, 18, 6,
+    192, 0, 192, 6, 100, 192, 240, 192, 252, 192, 252, 192, 231, 34, 192, 10,
+    72, 192, 0, 192, 15, 34, 192, 1, 200, 29, 192, 19, 72, 192, 2, 136,
+    192, 30, 158, 192, 21, 136, 192, 3, 8, 192, 1, 8, 192, 2, 80, 192,
+    70, 72, 0, 128, 98, 136, 192, 11, 72, 192, 0, 98, 136, 0, 74, 192,
+    2, 46, 192, 58, 46, 192, 47, 34, 192, 11, 8, 128, 223, 10, 192, 3,
+    34, 141, 0, 94, 192, 4, 30, 128, 95, 201, 13, 192, 8, 223, 1, 64,
+    192, 1, 8, 128, 219, 22, 192, 5, 205, 7, 192, 4, 209, 9, 64, 72,
+    192, 16, 80, 192, 150, 192, 252, 192, 252, 192, 252, 192, 155, 76, 192, 12,
+    40, 192, 1, 6, 192, 25, 202, 0, 64, 44, 192, 15, 36, 192, 10, 36,
+    0, 192, 21, 6, 192, 3, 18, 192, 100, 36, 32, 192, 53, 6, 192, 3,
+    18, 192, 13, 6, 192, 11, 164, 192, 4, 6, 192, 1, 192, 132, 202, 0,
+    192, 18, 36, 192, 10, 164, 192, 72, 192, 57, 164, 192, 94, 228, 8, 192,
+    78, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 64, 46, 192, 37, 74,
+    192, 34, 223, 0, 192, 2, 30, 192, 5, 72, 192, 0, 98, 8, 192, 8,
+    158, 192, 98, 72, 192, 20, 192, 5, 162, 192, 94, 226, 9, 192, 129, 192,
+    252, 192, 252, 192, 252, 192, 65, 96, 192, 4, 70, 192, 2, 198, 5, 192,
+    0, 227, 0, 33, 157, 31, 72, 225, 12, 192, 46, 70, 192, 2, 6, 64,
+    97, 192, 62, 192, 6, 95, 192, 18, 160, 192, 52, 70, 192, 5, 97, 192,
+    25, 224, 9, 192, 104, 192, 252, 192, 252, 192, 252, 192, 252, 192, 226, 34,
+    192, 21, 192, 22, 34, 74, 192, 9, 200, 1, 192, 16, 94, 192, 0, 200,
+    4, 192, 1, 136, 192, 37, 200, 0, 192, 66, 200, 0, 192, 44, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 47, 82, 192, 2, 82, 192, 59, 36, 192,
+    13, 14, 160, 64, 146, 192, 2, 82, 192, 2, 14, 146, 192, 58, 82, 192,
+    19, 192, 27, 32, 192, 28, 146, 192, 2, 82, 192, 2, 14, 192, 4, 146,
+    192, 3, 32, 192, 12, 142, 192, 1, 40, 192, 95, 44, 192, 1, 18, 192,
+    3, 18, 192, 12, 192, 43, 36, 192, 10, 33, 64, 14, 160, 128, 78, 192,
+    2, 82, 192, 2, 14, 0, 78, 192, 59, 14, 192, 17, 14, 192, 20, 37,
+    192, 3, 32, 192, 29, 78, 192, 2, 18, 14, 64, 192, 0, 14, 192, 5,
+    78, 192, 3, 32, 192, 13, 74, 192, 1, 40, 192, 203, 192, 252, 192, 252,
+    192, 252, 128, 144, 192, 40, 80, 192, 1, 80, 192, 9, 34, 192, 3, 38,
+    192, 2, 38, 192, 2, 12, 30, 192, 1, 144, 192, 67, 20, 80, 192, 1,
+    80, 192, 2, 12, 192, 1, 20, 80, 192, 31, 34, 192, 16, 192, 13, 144,
+    192, 20, 80, 192, 76, 34, 46, 192, 36, 34, 46, 192, 9, 16, 192, 5,
+    30, 192, 10, 223, 11, 192, 2, 80, 192, 1, 80, 192, 9, 30, 192, 0,
+    128, 6, 98, 192, 7, 12, 30, 192, 1, 208, 0, 192, 10, 208, 0, 192,
+    48, 12, 80, 192, 1, 80, 192, 2, 12, 192, 1, 12, 80, 192, 2, 30,
+    192, 24, 30, 192, 33, 208, 0, 192, 18, 208, 0, 192, 19, 204, 0, 64,
+    38, 166, 192, 249, 192, 252, 192, 252, 192, 200, 74, 192, 1, 202, 18, 192,
+    19, 64, 78, 28, 192, 11, 32, 192, 8, 36, 192, 0, 198, 0, 128, 142,
+    192, 1, 78, 192, 2, 10, 0, 18, 78, 192, 1, 78, 192, 2, 10, 192,
+    44, 78, 192, 16, 78, 128, 228, 0, 192, 20, 28, 192, 29, 142, 192, 1,
+    78, 192, 2, 10, 192, 5, 18, 78, 192, 1, 78, 128, 128, 10, 192, 6,
+    142, 192, 0, 32, 192, 66, 32, 44, 192, 29, 74, 192, 1, 202, 10, 227,
+    0, 161, 29, 128, 225, 12, 192, 3, 14, 192, 1, 95, 192, 23, 198, 0,
+    128, 10, 78, 192, 1, 78, 64, 97, 64, 10, 0, 10, 78, 192, 1, 78,
+    64, 93, 192, 48, 14, 192, 1, 95, 192, 14, 228, 0, 192, 54, 10, 78,
+    192, 1, 78, 64, 97, 192, 98, 192, 252, 192, 252, 192, 252, 192, 221, 34,
+    192, 2, 38, 192, 3, 38, 64, 231, 0, 30, 192, 2, 76, 192, 67, 20,
+    76, 192, 2, 76, 192, 1, 8, 192, 1, 20, 80, 192, 27, 223, 0, 34,
+    192, 15, 231, 0, 192, 11, 140, 192, 20, 80, 192, 13, 46, 192, 8, 226,
+    0, 192, 19, 192, 18, 34, 46, 192, 46, 34, 46, 192, 10, 200, 0, 192,
+    57, 6, 98, 192, 2, 34, 192, 8, 204, 0, 192, 10, 204, 0, 192, 47,
+    140, 128, 192, 12, 140, 192, 233, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 198, 18, 192, 3, 18, 192, 41, 192, 40, 18, 192, 3,
+    18, 192, 157, 86, 18, 192, 3, 18, 192, 11, 150, 192, 9, 192, 121, 18,
+    192, 3, 18, 192, 73, 37, 133, 192, 4, 18, 192, 3, 18, 192, 20, 192,
+    134, 82, 192, 112, 192, 252, 192, 252, 192, 252, 192, 150, 80, 192, 41, 16,
+    192, 2, 16, 192, 39, 80, 64, 192, 67, 16, 192, 2, 16, 192, 85, 80,
+    192, 82, 192, 17, 46, 192, 51, 16, 192, 5, 34, 192, 32, 16, 192, 2,
+    16, 192, 17, 34, 192, 17, 144, 192, 68, 16, 192, 1, 0, 16, 192, 84,
+    20, 144, 192, 18, 212, 0, 192, 132, 192, 252, 192, 252, 192, 252, 192, 95,
+    10, 192, 2, 202, 9, 192, 30, 14, 32, 192, 29, 104, 192, 3, 14, 192,
+    2, 14, 192, 6, 14, 192, 2, 14, 192, 29, 192, 19, 14, 192, 83, 22,
+    18, 14, 192, 2, 14, 192, 12, 22, 18, 14, 192, 2, 14, 192, 13, 150,
+    192, 85, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 125, 77, 192,
+    2, 197, 1, 192, 3, 76, 192, 68, 12, 192, 28, 192, 10, 213, 15, 192,
+    0, 213, 17, 192, 194, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    63, 21, 17, 0, 21, 17, 192, 13, 145, 128, 81, 77, 192, 0, 205, 0,
+    192, 9, 13, 192, 2, 13, 9, 192, 5, 13, 9, 64, 17, 13, 192, 1,
+    77, 9, 192, 7, 31, 192, 29, 9, 192, 1, 209, 0, 192, 0, 141, 192,
+    26, 5, 192, 3, 9, 128, 192, 11, 13, 192, 6, 31, 192, 215, 21, 17,
+    13, 21, 17, 13, 0, 21, 17, 13, 192, 7, 21, 17, 77, 128, 81, 77,
+    192, 0, 141, 192, 2, 205, 0, 128, 17, 13, 9, 192, 0, 17, 13, 73,
+    17, 13, 9, 192, 0, 17, 13, 73, 0, 17, 13, 9, 192, 0, 77, 73,
+    192, 5, 77, 192, 13, 141, 128, 17, 13, 73, 192, 0, 77, 137, 128, 209,
+    0, 192, 0, 141, 192, 2, 81, 192, 2, 141, 192, 0, 13, 9, 5, 192,
+    0, 13, 9, 69, 192, 1, 137, 17, 13, 9, 192, 0, 17, 13, 73, 192,
+    1, 141, 192, 4, 81, 192, 3, 13, 192, 25, 21, 145, 192, 0, 17, 13,
+    17, 64, 128, 13, 17, 192, 1, 21, 145, 192, 0, 145, 192, 1, 13, 17,
+    192, 2, 85, 192, 2, 81, 31, 192, 1, 13, 17, 192, 34, 17, 192, 3,
+    17, 192, 14, 17, 192, 3, 17, 192, 15, 17, 192, 3, 17, 192, 98, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 201, 19, 192, 0, 79, 192, 3, 83,
+    192, 1, 207, 6, 64, 36, 192, 8, 15, 11, 128, 192, 1, 37, 15, 11,
+    192, 0, 15, 192, 0, 79, 11, 192, 0, 75, 192, 0, 79, 36, 192, 0,
+    203, 11, 128, 83, 192, 1, 15, 75, 192, 9, 143, 192, 2, 11, 192, 19,
+    11, 7, 192, 0, 37, 11, 135, 192, 3, 19, 15, 11, 192, 0, 79, 139,
+    128, 11, 192, 0, 83, 192, 1, 79, 29, 192, 1, 11, 207, 19, 192, 4,
+    79, 192, 2, 15, 192, 10, 79, 192, 2, 15, 192, 24, 192, 2, 70, 192,
+    2, 6, 192, 237, 192, 252, 192, 252, 192, 252, 209, 0, 128, 34, 192, 12,
+    13, 192, 6, 13, 192, 45, 145, 128, 77, 137, 192, 0, 209, 0, 0, 34,
+    0, 205, 1, 192, 24, 9, 192, 2, 73, 192, 6, 13, 192, 2, 77, 192,
+    84, 192, 44, 46, 192, 28, 46, 192, 93, 209, 0, 192, 1, 205, 0, 192,
+    7, 13, 9, 192, 5, 13, 9, 192, 5, 77, 9, 192, 24, 192, 4, 145,
+    128, 77, 137, 192, 0, 209, 0, 128, 205, 2, 192, 0, 81, 192, 1, 205,
+    3, 192, 5, 9, 197, 5, 192, 4, 17, 205, 7, 192, 4, 209, 31, 192,
+    1, 209, 14, 192, 0, 21, 209, 15, 192, 0, 213, 17, 192, 44, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 45, 17, 13, 9, 192, 0, 17, 13, 73, 0, 31,
+    13, 9, 192, 0, 17, 13, 73, 192, 40, 137, 192, 8, 205, 1, 192, 8,
+    205, 2, 192, 15, 145, 192, 0, 209, 0, 0, 226, 3, 192, 60, 192, 93,
+    226, 7, 192, 144, 192, 252, 192, 252, 192, 252, 192, 252, 192, 230, 96, 192,
+    16, 64, 15, 11, 192, 6, 29, 11, 64, 74, 0, 11, 192, 2, 32, 192,
+    1, 203, 9, 192, 13, 136, 192, 33, 70, 192, 2, 6, 192, 9, 79, 192,
+    1, 224, 3, 192, 112, 64, 70, 192, 37, 224, 8, 192, 195, 192, 252, 192,
+    252, 192, 252, 128, 74, 192, 22, 13, 192, 53, 135, 192, 5, 94, 0, 205,
+    1, 192, 143, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 32, 20, 192, 36, 20, 192, 70, 20, 192, 3, 20, 192, 34, 34,
+    192, 2, 148, 192, 15, 148, 192, 21, 192, 45, 84, 192, 3, 20, 192, 12,
+    84, 192, 175, 192, 252, 192, 252, 192, 252, 192, 252, 192, 232, 82, 192, 1,
+    82, 192, 7, 192, 30, 82, 192, 2, 18, 192, 40, 14, 40, 192, 3, 82,
+    192, 1, 82, 192, 3, 14, 192, 30, 32, 192, 8, 82, 192, 2, 18, 192,
+    76, 22, 82, 192, 0, 0, 82, 192, 3, 14, 192, 4, 22, 82, 192, 20,
+    150, 192, 107, 18, 192, 2, 18, 192, 1, 28, 192, 35, 146, 192, 1, 18,
+    192, 29, 25, 153, 192, 3, 14, 160, 192, 1, 82, 192, 1, 82, 192, 3,
+    14, 192, 42, 210, 0, 192, 56, 203, 0, 192, 18, 14, 82, 192, 1, 82,
+    192, 70, 192, 252, 192, 252, 192, 252, 192, 185, 12, 192, 22, 94, 192, 7,
+    76, 128, 80, 192, 0, 30, 80, 192, 9, 192, 21, 38, 64, 87, 64, 38,
+    64, 215, 3, 192, 3, 16, 192, 14, 16, 192, 30, 20, 80, 192, 15, 20,
+    80, 192, 43, 205, 17, 192, 56, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 38, 19, 15, 11, 192, 0, 19, 15, 11, 192, 0, 15, 101, 11,
+    192, 0, 75, 192, 3, 139, 192, 10, 19, 15, 75, 192, 0, 19, 128, 19,
+    15, 75, 192, 0, 19, 11, 192, 8, 75, 15, 11, 7, 192, 0, 15, 11,
+    71, 192, 0, 15, 11, 7, 192, 0, 15, 11, 71, 192, 0, 11, 19, 79,
+    192, 0, 207, 0, 192, 0, 75, 192, 3, 207, 0, 192, 0, 139, 192, 38,
+    19, 143, 192, 0, 19, 143, 192, 6, 192, 14, 143, 192, 0, 207, 0, 192,
+    0, 228, 0, 192, 0, 147, 192, 0, 211, 0, 192, 79, 228, 7, 192, 106,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 247, 17, 13, 128, 64, 17, 13,
+    192, 8, 98, 192, 21, 77, 64, 159, 192, 0, 77, 73, 192, 4, 34, 205,
+    0, 192, 5, 201, 0, 128, 201, 0, 192, 7, 137, 192, 1, 81, 192, 1,
+    205, 1, 192, 16, 31, 227, 53, 192, 3, 209, 45, 192, 37, 223, 211, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 162, 22, 192, 3, 22, 192, 77, 192, 13, 22, 192, 4, 22, 192,
+    3, 22, 192, 3, 22, 192, 131, 150, 192, 71, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 114, 84, 192, 35, 20, 192, 1, 20, 192, 2, 20,
+    192, 57, 84, 192, 16, 192, 53, 20, 192, 194, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252,
+    192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 102,
+    21, 17, 13, 21, 17, 13, 0, 21, 17, 13, 192, 8, 17, 77, 128, 81,
+    77, 192, 0, 205, 0, 192, 1, 205, 0, 192, 0, 13, 137, 128, 13, 201,
+    3, 128, 13, 137, 17, 13, 9, 192, 0, 77, 73, 64, 21, 81, 192, 0,
+    205, 0, 192, 4, 201, 0, 192, 0, 201, 0, 192, 7, 137, 128, 209, 0,
+    192, 0, 205, 2, 128, 209, 0, 192, 0, 205, 5, 197, 54, 149, 192, 0,
+    209, 83, 128, 213, 77, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192, 252, 192,
+    252, 192, 252, 192, 252, 192, 252, 192, 204,
+};
+
+const TbClass tb_classes[] = {
+    {1, 1, 992UL, index_1_1, data_1_1},
+    {2, 1, 14880UL, index_2_1, data_2_1},
+    {3, 1, 143840UL, index_3_1, data_3_1},
+    {2, 2, 215760UL, index_2_2, data_2_2},
+};
+
+const uint8_t tb_num_classes =
+    sizeof(tb_classes) / sizeof(tb_classes[0]);
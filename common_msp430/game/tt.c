@@ -0,0 +1,42 @@
+#include <game/tt.h>
+#include <string.h>
+
+#define TT_INDEX(key) ((key) & (TT_ENTRIES - 1))
+
+// The table lives in FRAM and is only initialised when the image is loaded,
+// so it survives a reset and the next game starts with a warm table. Keys are
+// compared in full on every probe, so stale entries can never be misused.
+#pragma PERSISTENT(table)
+static TtEntry table[TT_ENTRIES] = {0};
+#pragma PERSISTENT(generation)
+static uint8_t generation = 0;
+
+void TT_new_search(void) { generation++; }
+
+void TT_clear(void) {
+  memset(table, 0, sizeof(table));
+  generation = 0;
+}
+
+const TtEntry* TT_probe(uint32_t key) {
+  const TtEntry* entry = &table[TT_INDEX(key)];
+
+  return (entry->key == key) ? entry : NULL;
+}
+
+void TT_store(uint32_t key, int depth, int score, TtBound bound, int best) {
+  TtEntry* entry = &table[TT_INDEX(key)];
+
+  // Depth-preferred: a deeper result from the current search is kept over a
+  // shallower one. Entries left over from earlier searches are always replaced.
+  if (entry->generation == generation && entry->key != key &&
+      entry->depth > depth)
+    return;
+
+  entry->key = key;
+  entry->score = score;
+  entry->depth = depth;
+  entry->best = best;
+  entry->bound = bound;
+  entry->generation = generation;
+}
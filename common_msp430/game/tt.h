@@ -0,0 +1,32 @@
+#ifndef GAME_TT_H_
+#define GAME_TT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Number of table entries, a power of two (10 bytes each)
+#define TT_ENTRIES 2048
+
+// Stored in place of a move index when a node had no best move
+#define TT_NO_MOVE 0xFF
+
+typedef enum { TT_EXACT, TT_LOWER, TT_UPPER } TtBound;
+
+typedef struct {
+  uint32_t key;        // Full Zobrist key of the position
+  int16_t score;       // Search score, relative to the node
+  int8_t depth;        // Remaining depth the score was searched to
+  uint8_t best;        // Index of the best move in the generated move list
+  uint8_t bound;       // TtBound of the score
+  uint8_t generation;  // Search that wrote the entry
+} TtEntry;
+
+// Starts a new search. Entries from earlier searches stay usable but may be
+// replaced regardless of their depth.
+void TT_new_search(void);
+void TT_clear(void);
+// Returns the entry for the key, or NULL if the position is not stored
+const TtEntry* TT_probe(uint32_t key);
+void TT_store(uint32_t key, int depth, int score, TtBound bound, int best);
+
+#endif /* GAME_TT_H_ */
@@ -0,0 +1,35 @@
+//*****************************************************************************
+//
+// hal_dma.c - The DMA interrupt, shared by the drivers that own a channel
+//
+// All six channels raise DMA_VECTOR, so the ISR lives here and hands each
+// channel to its driver: channel 3 streams to the LCD (hal_lcd.c), channel 4
+// sends UART frames (hal_uart.c).  Channel 5 fills the UART receive buffer
+// and never interrupts.
+//
+//*****************************************************************************
+
+#include <msp430.h>
+#include <driverlib.h>
+#include <hal/hal_lcd.h>
+#include <hal/hal_uart.h>
+
+#pragma vector = DMA_VECTOR
+__interrupt void DMA_ISR(void)
+{
+    switch (__even_in_range(DMAIV, DMAIV_DMA5IFG))
+    {
+        case DMAIV_DMA3IFG:
+            if (HAL_LCD_dmaDone())
+            {
+                __bic_SR_register_on_exit(LPM0_bits);
+            }
+            break;
+        case DMAIV_DMA4IFG:
+            HAL_UART_dmaDone();
+            __bic_SR_register_on_exit(LPM0_bits);
+            break;
+        default:
+            break;
+    }
+}
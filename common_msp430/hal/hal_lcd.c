@@ -10,6 +10,7 @@
 #include <msp430.h>
 #include <driverlib.h>
 #include <hal/hal_lcd.h>
+#include <stdbool.h>
 
 void HAL_LCD_init_gpio(void)
 {
@@ -54,12 +55,12 @@ void HAL_LCD_config(void)
 //*****************************************************************************
 void HAL_LCD_writeCommand(uint8_t command)
 {
+    // USCI_B1 Busy? The previous data byte must be out before DC drops
+    while (UCB1STATW & UCBUSY);
+
     // Set to command mode
     GPIO_setOutputLowOnPin(LCD_DC_PORT, LCD_DC_PIN);
 
-    // USCI_B1 Busy?
-    while (UCB1STATW & UCBUSY);
-
     // Transmit data
     UCB1TXBUF = command;
 
@@ -89,3 +90,213 @@ void HAL_LCD_writeData(uint8_t data)
     while (UCB1STATW & UCBUSY);
 }
 
+
+//*****************************************************************************
+//
+// Writes the same RGB565 color to the given number of pixels of the
+// CFAF128128B-0145T.  Each byte goes into UCB1TXBUF as soon as UCTXIFG says
+// the buffer is free, so the next byte is queued while the current one
+// shifts out and the clock never pauses between bytes.
+//
+//*****************************************************************************
+#define HAL_LCD_TX(byte)                        \
+    do                                          \
+    {                                           \
+        while (!(UCB1IFG & UCTXIFG));           \
+        UCB1TXBUF = (byte);                     \
+    } while (0)
+
+void HAL_LCD_fillBurst(uint16_t color, uint32_t pixels)
+{
+    uint8_t high = color >> 8;
+    uint8_t low = color;
+
+    if (high == low)
+    {
+        // Black, white and the other grays: one byte value, counted in bytes
+        uint32_t bytes = pixels << 1;
+
+        while (bytes >= 8)
+        {
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(low);
+            bytes -= 8;
+        }
+        while (bytes--)
+        {
+            HAL_LCD_TX(low);
+        }
+    }
+    else
+    {
+        while (pixels >= 4)
+        {
+            HAL_LCD_TX(high);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(high);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(high);
+            HAL_LCD_TX(low);
+            HAL_LCD_TX(high);
+            HAL_LCD_TX(low);
+            pixels -= 4;
+        }
+        while (pixels--)
+        {
+            HAL_LCD_TX(high);
+            HAL_LCD_TX(low);
+        }
+    }
+
+    // USCI_B1 Busy? Leave with the last byte on the wire
+    while (UCB1STATW & UCBUSY);
+}
+
+
+
+//*****************************************************************************
+//
+// DMA transfers to the CFAF128128B-0145T.  The channel moves one byte into
+// UCB1TXBUF each time UCTXIFG rises, so the bytes go out back to back while
+// the CPU sleeps in LPM0.  A fill streams a small pattern of the color and
+// the ISR restarts it until all the pixels are out.
+//
+//*****************************************************************************
+static uint8_t fill_pattern[2 * LCD_DMA_FILL_PIXELS];
+static const uint8_t *dma_source;
+static uint32_t dma_remaining;
+static uint16_t dma_chunk;
+static volatile bool dma_busy = false;
+
+static uint16_t HAL_LCD_dmaChunk(void)
+{
+    if (dma_remaining > dma_chunk)
+    {
+        return dma_chunk;
+    }
+    return (uint16_t)dma_remaining;
+}
+
+static void HAL_LCD_startDMA(uint16_t length)
+{
+    DMA_setSrcAddress(LCD_DMA_CHANNEL, (uint32_t)(uintptr_t)dma_source,
+                      DMA_DIRECTION_INCREMENT);
+    DMA_setTransferSize(LCD_DMA_CHANNEL, length);
+    dma_remaining -= length;
+
+    // The channel is edge triggered and UCTXIFG is already high when the
+    // buffer is empty, so wait for room and then make the edge by hand
+    while (!(UCB1IFG & UCTXIFG));
+    UCB1IFG &= ~UCTXIFG;
+    DMA_enableTransfers(LCD_DMA_CHANNEL);
+    UCB1IFG |= UCTXIFG;
+}
+
+static void HAL_LCD_runDMA(const uint8_t *source, uint32_t length,
+                           uint16_t chunk)
+{
+    DMA_initParam config =
+        {
+            LCD_DMA_CHANNEL,
+            DMA_TRANSFER_SINGLE,
+            0,
+            LCD_DMA_TRIGGER,
+            DMA_SIZE_SRCBYTE_DSTBYTE,
+            DMA_TRIGGER_RISINGEDGE
+        };
+    uint16_t sr = __get_SR_register();
+
+    DMA_init(&config);
+    DMA_setDstAddress(LCD_DMA_CHANNEL, (uint32_t)(uintptr_t)&UCB1TXBUF,
+                      DMA_DIRECTION_UNCHANGED);
+    DMA_clearInterrupt(LCD_DMA_CHANNEL);
+    DMA_enableInterrupt(LCD_DMA_CHANNEL);
+
+    dma_source = source;
+    dma_remaining = length;
+    dma_chunk = chunk;
+    dma_busy = true;
+    HAL_LCD_startDMA(HAL_LCD_dmaChunk());
+
+    // Check and sleep with interrupts off so the wake-up cannot be missed
+    __disable_interrupt();
+    while (dma_busy)
+    {
+        __bis_SR_register(LPM0_bits | GIE);
+        __disable_interrupt();
+    }
+    __bis_SR_register(sr & GIE);
+
+    DMA_disableInterrupt(LCD_DMA_CHANNEL);
+
+    // The last byte is still shifting out
+    while (UCB1STATW & UCBUSY);
+}
+
+//*****************************************************************************
+//
+// Streams a run of bytes, already in display order, to the
+// CFAF128128B-0145T.
+//
+//*****************************************************************************
+void HAL_LCD_writeDataDMA(const uint8_t *data, uint16_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+
+    while (UCB1STATW & UCBUSY);
+
+    HAL_LCD_runDMA(data, length, length);
+}
+
+//*****************************************************************************
+//
+// Writes the same RGB565 color to the given number of pixels of the
+// CFAF128128B-0145T.
+//
+//*****************************************************************************
+void HAL_LCD_fillDMA(uint16_t color, uint32_t pixels)
+{
+    uint16_t i;
+
+    if (pixels == 0)
+    {
+        return;
+    }
+
+    for (i = 0; i < sizeof(fill_pattern); i += 2)
+    {
+        fill_pattern[i] = color >> 8;
+        fill_pattern[i + 1] = color;
+    }
+
+    while (UCB1STATW & UCBUSY);
+
+    HAL_LCD_runDMA(fill_pattern, 2 * pixels, sizeof(fill_pattern));
+}
+
+//*****************************************************************************
+//
+// Called by DMA_ISR in hal_dma.c when channel 3 finishes.  Returns true once
+// the whole transfer is out and the sleeping caller should wake.
+//
+//*****************************************************************************
+bool HAL_LCD_dmaDone(void)
+{
+    if (dma_remaining > 0)
+    {
+        // Only fills come back here, to replay the pattern
+        HAL_LCD_startDMA(HAL_LCD_dmaChunk());
+        return false;
+    }
+    dma_busy = false;
+    return true;
+}
@@ -2,6 +2,7 @@
 #define __HAL_MSP_EXP430FR5994_CRYSTALFONTZLCD_H_
 
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "driverlib.h"
 //*****************************************************************************
@@ -34,6 +35,18 @@
 // Definition of USCI base address to be used for SPI communication
 #define LCD_EUSCI_BASE        EUSCI_B1_BASE
 
+// DMA channel streaming into UCB1TXBUF. On the FR5994, trigger 19 is
+// UCB1TXIFG0 on channels 3 to 5 (UCB0TXIFG0 on channels 0 to 2).
+// DMA_ISR in hal_dma.c hands DMAIV_DMA3IFG to HAL_LCD_dmaDone.
+#define LCD_DMA_CHANNEL       DMA_CHANNEL_3
+#define LCD_DMA_TRIGGER       DMA_TRIGGERSOURCE_19
+
+// Below this many bytes the DMA setup costs more than it saves
+#define LCD_DMA_MIN_BYTES     32
+
+// Pixels of the fill pattern; a fill restarts the DMA once per pattern
+#define LCD_DMA_FILL_PIXELS   64
+
 //*****************************************************************************
 //
 // Prototypes for the globals exported by this driver.
@@ -41,6 +54,10 @@
 //*****************************************************************************
 extern void HAL_LCD_writeCommand(uint8_t command);
 extern void HAL_LCD_writeData(uint8_t data);
+extern void HAL_LCD_fillBurst(uint16_t color, uint32_t pixels);
+extern void HAL_LCD_writeDataDMA(const uint8_t *data, uint16_t length);
+extern void HAL_LCD_fillDMA(uint16_t color, uint32_t pixels);
+extern bool HAL_LCD_dmaDone(void);
 extern void HAL_LCD_init_gpio(void);
 extern void HAL_LCD_config(void);
 
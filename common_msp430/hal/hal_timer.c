@@ -0,0 +1,95 @@
+#include <msp430.h>
+#include <driverlib.h>
+#include <hal/hal_timer.h>
+#include <hal/hal_uart.h>
+#include <stdbool.h>
+
+// SMCLK (16MHz) / 16 = 1MHz timer clock, 1000 counts per interrupt = 1ms
+#define TIMER_TICKS_PER_MS 1000
+
+static volatile uint32_t ms_ticks = 0;
+static volatile uint16_t frame_period_ms = 0;
+static volatile uint16_t frame_elapsed_ms = 0;
+static volatile bool frame_due = false;
+static volatile uint16_t wake_countdown_ms = 0;
+
+void HAL_TIMER_config(void)
+{
+    Timer_A_initUpModeParam upModeParam =
+    {
+        TIMER_A_CLOCKSOURCE_SMCLK,
+        TIMER_A_CLOCKSOURCE_DIVIDER_16,
+        TIMER_TICKS_PER_MS - 1,
+        TIMER_A_TAIE_INTERRUPT_DISABLE,
+        TIMER_A_CCIE_CCR0_INTERRUPT_ENABLE,
+        TIMER_A_DO_CLEAR,
+        true
+    };
+    Timer_A_initUpMode(TIMER_A0_BASE, &upModeParam);
+}
+
+uint32_t HAL_TIMER_get_ms(void)
+{
+    uint32_t now;
+    uint16_t sr = __get_SR_register();
+
+    // A 32-bit read takes two instructions, keep the ISR out in between
+    __disable_interrupt();
+    now = ms_ticks;
+    __bis_SR_register(sr & GIE);
+    return now;
+}
+
+void HAL_TIMER_start_frames(uint16_t period_ms)
+{
+    uint16_t sr = __get_SR_register();
+
+    __disable_interrupt();
+    frame_period_ms = period_ms;
+    frame_elapsed_ms = 0;
+    frame_due = false;
+    __bis_SR_register(sr & GIE);
+}
+
+void HAL_TIMER_wait_frame(void)
+{
+    uint16_t sr = __get_SR_register();
+
+    // Check and sleep with interrupts off so the tick cannot be missed
+    __disable_interrupt();
+    while (!frame_due)
+    {
+        __bis_SR_register(LPM0_bits | GIE);
+        __disable_interrupt();
+    }
+    frame_due = false;
+    __bis_SR_register(sr & GIE);
+}
+
+void HAL_TIMER_wake_after(uint16_t ms)
+{
+    wake_countdown_ms = ms;
+}
+
+#pragma vector = TIMER0_A0_VECTOR
+__interrupt void TIMER0_A0_ISR(void)
+{
+    ms_ticks++;
+
+    if (frame_period_ms && ++frame_elapsed_ms >= frame_period_ms)
+    {
+        frame_elapsed_ms = 0;
+        frame_due = true;
+        __bic_SR_register_on_exit(LPM0_bits);
+    }
+
+    if (wake_countdown_ms && --wake_countdown_ms == 0)
+    {
+        __bic_SR_register_on_exit(LPM0_bits);
+    }
+
+    if (HAL_UART_tick())
+    {
+        __bic_SR_register_on_exit(LPM0_bits);
+    }
+}
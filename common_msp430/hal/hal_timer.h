@@ -0,0 +1,21 @@
+#ifndef HAL_HAL_TIMER_H_
+#define HAL_HAL_TIMER_H_
+
+#include <stdint.h>
+
+// Millisecond time base on Timer_A0 (Timer_B0 drives the backlight and
+// buzzer PWM)
+void HAL_TIMER_config(void);
+uint32_t HAL_TIMER_get_ms(void);
+
+// Frame tick on the same timer: a frame starts every period_ms
+void HAL_TIMER_start_frames(uint16_t period_ms);
+// Sleeps in LPM0 until the next frame starts; returns at once if a frame
+// started while the caller was busy
+void HAL_TIMER_wait_frame(void);
+
+// Ends LPM0 once ms more milliseconds have passed, for a caller that sleeps
+// until either its own interrupt or a timeout; 0 cancels
+void HAL_TIMER_wake_after(uint16_t ms);
+
+#endif /* HAL_HAL_TIMER_H_ */
@@ -1,8 +1,32 @@
 #include <msp430.h>
 #include <driverlib.h>
+#include <hal/hal_timer.h>
+#include <hal/hal_uart.h>
+#include <string.h>
 
-bool UART_RX_flag = false;
-uint8_t UART_RX_data;
+#define RX_MASK (HAL_UART_RX_BUFFER_SIZE - 1)
+#define TX_MASK (HAL_UART_TX_BUFFER_SIZE - 1)
+
+#if (HAL_UART_RX_BUFFER_SIZE & RX_MASK) || (HAL_UART_TX_BUFFER_SIZE & TX_MASK)
+#error "HAL_UART buffer sizes must be powers of two"
+#endif
+
+// Received bytes form a single producer, single consumer ring: channel 5
+// writes at the head, HAL_UART_rx_byte reads at the tail, so neither side
+// needs interrupts disabled.
+static uint8_t rx_buffer[HAL_UART_RX_BUFFER_SIZE];
+static volatile uint8_t rx_tail;    // Written by HAL_UART_rx_byte
+// Channel 5 raises no interrupt per byte, so HAL_UART_tick compares its
+// position with the last snapshot every millisecond to see bytes arrive.
+// The byte counts only grow; their difference is what is still unread.
+static uint8_t tick_head;             // Head at the last tick
+static volatile uint16_t rx_received; // Bytes counted by HAL_UART_tick
+static volatile uint16_t rx_read;     // Bytes taken by HAL_UART_rx_byte
+static volatile bool line_active;     // Bytes arrived during the last tick
+static volatile bool rx_overrun;
+static volatile bool rx_waiting;      // HAL_UART_wait_rx is asleep
+static uint8_t tx_buffer[HAL_UART_TX_BUFFER_SIZE];
+static volatile bool tx_busy = false;
 
 void HAL_UART_init_gpio()
 {
@@ -20,6 +44,54 @@ void HAL_UART_init_gpio()
 }
 
 
+//*****************************************************************************
+//
+// Channel 5 copies every received byte into rx_buffer, wrapping
+// around at the end (repeated single transfer reloads the address and
+// count), so receiving costs the CPU nothing until it reads.  Channel 4
+// sends a frame from tx_buffer, one byte each time UCTXIFG rises, and
+// interrupts when the frame is out.
+//
+//*****************************************************************************
+static void HAL_UART_configDMA(void)
+{
+    DMA_initParam rxConfig =
+        {
+            UART_DMA_RX_CHANNEL,
+            DMA_TRANSFER_REPEATED_SINGLE,
+            HAL_UART_RX_BUFFER_SIZE,
+            UART_DMA_RX_TRIGGER,
+            DMA_SIZE_SRCBYTE_DSTBYTE,
+            DMA_TRIGGER_RISINGEDGE
+        };
+    DMA_initParam txConfig =
+        {
+            UART_DMA_TX_CHANNEL,
+            DMA_TRANSFER_SINGLE,
+            0,
+            UART_DMA_TX_TRIGGER,
+            DMA_SIZE_SRCBYTE_DSTBYTE,
+            DMA_TRIGGER_RISINGEDGE
+        };
+
+    DMA_init(&rxConfig);
+    DMA_setSrcAddress(UART_DMA_RX_CHANNEL, (uint32_t)(uintptr_t)&UCA3RXBUF,
+                      DMA_DIRECTION_UNCHANGED);
+    DMA_setDstAddress(UART_DMA_RX_CHANNEL, (uint32_t)(uintptr_t)rx_buffer,
+                      DMA_DIRECTION_INCREMENT);
+    // The channel is edge triggered, a byte already waiting would block it
+    (void)UCA3RXBUF;
+    DMA_enableTransfers(UART_DMA_RX_CHANNEL);
+
+    DMA_init(&txConfig);
+    DMA_setSrcAddress(UART_DMA_TX_CHANNEL, (uint32_t)(uintptr_t)tx_buffer,
+                      DMA_DIRECTION_INCREMENT);
+    DMA_setDstAddress(UART_DMA_TX_CHANNEL, (uint32_t)(uintptr_t)&UCA3TXBUF,
+                      DMA_DIRECTION_UNCHANGED);
+    DMA_clearInterrupt(UART_DMA_TX_CHANNEL);
+    DMA_enableInterrupt(UART_DMA_TX_CHANNEL);
+}
+
 void HAL_UART_config(void)
 {
     EUSCI_A_UART_initParam uartConfig = {0};
@@ -50,36 +122,171 @@ void HAL_UART_config(void)
     // Enable UART module
     EUSCI_A_UART_enable(EUSCI_A3_BASE);
 
-    // Enable RX interrupt
-    EUSCI_A_UART_enableInterrupt(EUSCI_A3_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT);
+    HAL_UART_configDMA();
+}
+
+static uint8_t HAL_UART_rxHead(void)
+{
+    // DMAxSZ counts down from the buffer size and reloads after the last byte
+    return (HAL_UART_RX_BUFFER_SIZE -
+            HWREG16(DMA_BASE + UART_DMA_RX_CHANNEL + OFS_DMA0SZ)) & RX_MASK;
 }
 
 bool HAL_UART_data_available(void)
 {
-    return UART_RX_flag;
+    return HAL_UART_rxHead() != rx_tail;
 }
 
 uint8_t HAL_UART_rx_byte(void)
 {
-    UART_RX_flag = false;
-    return UART_RX_data;
+    uint8_t rxByte;
+
+    if (HAL_UART_rxHead() == rx_tail)
+    {
+        return 0;
+    }
+    rxByte = rx_buffer[rx_tail];
+    rx_tail = (rx_tail + 1) & RX_MASK;
+    rx_read++;
+    return rxByte;
+}
+
+void HAL_UART_wait_rx(uint16_t max_ms)
+{
+    uint16_t sr = __get_SR_register();
+
+    // Check and sleep with interrupts off so the tick cannot be missed
+    __disable_interrupt();
+    if (HAL_UART_rxHead() == rx_tail && !rx_overrun && max_ms > 0)
+    {
+        rx_waiting = true;
+        HAL_TIMER_wake_after(max_ms);
+        __bis_SR_register(LPM0_bits | GIE);
+        __disable_interrupt();
+        HAL_TIMER_wake_after(0);
+        rx_waiting = false;
+    }
+    __bis_SR_register(sr & GIE);
 }
 
-void HAL_UART_tx_byte(uint8_t txByte)
+bool HAL_UART_rx_idle(void)
 {
-    EUSCI_A_UART_transmitData(EUSCI_A3_BASE, txByte);
+    return !line_active && HAL_UART_rxHead() == tick_head;
 }
 
-#pragma vector=EUSCI_A3_VECTOR
-__interrupt void USCI_A3_ISR(void)
+bool HAL_UART_rx_overflow(void)
 {
-    uint8_t status = EUSCI_A_UART_getInterruptStatus(EUSCI_A3_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG);
+    uint16_t sr = __get_SR_register();
+    bool overrun;
 
-    if (status == EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG)
+    __disable_interrupt();
+    overrun = rx_overrun;
+    if (overrun)
     {
-        UART_RX_data = EUSCI_A_UART_receiveData(EUSCI_A3_BASE);
-        UART_RX_flag = true;
-        EUSCI_A_UART_clearInterrupt(EUSCI_A3_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG);
+        // What is left in the buffer mixes old and new bytes, so drop it
+        // all and count it as read
+        rx_tail = HAL_UART_rxHead();
+        rx_read = rx_received + ((rx_tail - tick_head) & RX_MASK);
+        rx_overrun = false;
     }
+    __bis_SR_register(sr & GIE);
+    return overrun;
 }
 
+void HAL_UART_send(const uint8_t *data, uint16_t length)
+{
+    uint16_t sr = __get_SR_register();
+    uint16_t chunk;
+
+    while (length > 0)
+    {
+        // The buffer still belongs to the previous frame until it is out
+        __disable_interrupt();
+        while (tx_busy)
+        {
+            __bis_SR_register(LPM0_bits | GIE);
+            __disable_interrupt();
+        }
+        __bis_SR_register(sr & GIE);
+
+        chunk = length < HAL_UART_TX_BUFFER_SIZE ? length
+                                                 : HAL_UART_TX_BUFFER_SIZE;
+        memcpy(tx_buffer, data, chunk);
+        data += chunk;
+        length -= chunk;
+
+        DMA_setSrcAddress(UART_DMA_TX_CHANNEL, (uint32_t)(uintptr_t)tx_buffer,
+                          DMA_DIRECTION_INCREMENT);
+        DMA_setTransferSize(UART_DMA_TX_CHANNEL, chunk);
+        tx_busy = true;
+
+        // UCTXIFG is already high when TXBUF is empty, so make the edge the
+        // channel triggers on by hand
+        while (!(UCA3IFG & UCTXIFG));
+        UCA3IFG &= ~UCTXIFG;
+        DMA_enableTransfers(UART_DMA_TX_CHANNEL);
+        UCA3IFG |= UCTXIFG;
+    }
+}
+
+void HAL_UART_tx_byte(uint8_t txByte)
+{
+    HAL_UART_send(&txByte, 1);
+}
+
+bool HAL_UART_tx_busy(void)
+{
+    return tx_busy;
+}
+
+//*****************************************************************************
+//
+// Called by DMA_ISR in hal_dma.c when channel 4 has sent its frame.
+//
+//*****************************************************************************
+void HAL_UART_dmaDone(void)
+{
+    tx_busy = false;
+}
+
+//*****************************************************************************
+//
+// Called by TIMER0_A0_ISR in hal_timer.c every millisecond.  At 115200
+// baud at most 12 bytes arrive per tick, far fewer than the buffer holds,
+// so the distance the head moved is the exact number received.  Returns
+// true when a sleeping HAL_UART_wait_rx should wake up.
+//
+//*****************************************************************************
+bool HAL_UART_tick(void)
+{
+    uint8_t head = HAL_UART_rxHead();
+    bool wake = false;
+    uint16_t unread;
+
+    if (head != tick_head)
+    {
+        rx_received += (head - tick_head) & RX_MASK;
+        tick_head = head;
+        line_active = true;
+
+        unread = rx_received - rx_read;
+        if (unread >= HAL_UART_RX_BUFFER_SIZE)
+        {
+            // The head has lapped the tail over unread bytes
+            rx_overrun = true;
+            wake = true;
+        }
+        else if (unread >= HAL_UART_RX_BUFFER_SIZE / 2)
+        {
+            // A long burst: let the reader catch up before it overruns
+            wake = true;
+        }
+    }
+    else if (line_active)
+    {
+        // A whole tick without a byte ends the burst
+        line_active = false;
+        wake = true;
+    }
+    return wake && rx_waiting;
+}
@@ -1,17 +1,53 @@
-
 #ifndef HAL_HAL_UART_H_
 #define HAL_HAL_UART_H_
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "driverlib.h"
+
+// EUSCI_A3 moves every byte by DMA: frames go out from the TX buffer and
+// received bytes land in the RX ring, so the CPU only touches whole messages.
+// On the FR5994, triggers 16 and 17 are UCA3RXIFG
+// and UCA3TXIFG on channels 3 to 5; channel 3 is the LCD's.
+#define UART_DMA_TX_CHANNEL DMA_CHANNEL_4
+#define UART_DMA_TX_TRIGGER DMA_TRIGGERSOURCE_17
+#define UART_DMA_RX_CHANNEL DMA_CHANNEL_5
+#define UART_DMA_RX_TRIGGER DMA_TRIGGERSOURCE_16
+
+// Buffer sizes, powers of two up to 256. RX holds more than a whole message,
+// and the reader is woken when it is half full; TX holds a whole frame.
+#define HAL_UART_RX_BUFFER_SIZE 64
+#define HAL_UART_TX_BUFFER_SIZE 64
 
 void HAL_UART_init_gpio(void);
 void HAL_UART_config(void);
 
 bool HAL_UART_data_available(void);
 uint8_t HAL_UART_rx_byte(void);
-void HAL_UART_tx_byte(uint8_t txByte);
+// Sleeps in LPM0 until a burst of received bytes ends, the RX buffer is half
+// full, or max_ms pass, whichever is first; returns at once if bytes are
+// already waiting. Other interrupts that end LPM0 return early too, so
+// callers check and wait in a loop.
+void HAL_UART_wait_rx(uint16_t max_ms);
+// True when no byte has arrived for at least a whole tick (1 to 2 ms), so a
+// message that is still incomplete is not going to be finished
+bool HAL_UART_rx_idle(void);
+// True once after received bytes were lost because the RX buffer wrapped
+// over them. The bytes still buffered are dropped too, since they mix old
+// and new data.
+bool HAL_UART_rx_overflow(void);
 
+// Queues a whole frame and returns; only waits while the previous frame is
+// still going out
+void HAL_UART_send(const uint8_t *data, uint16_t length);
+// Queues a byte, the same way
+void HAL_UART_tx_byte(uint8_t txByte);
+bool HAL_UART_tx_busy(void);
 
+// Called by DMA_ISR in hal_dma.c when the TX channel is done
+void HAL_UART_dmaDone(void);
+// Called by TIMER0_A0_ISR in hal_timer.c every millisecond to count received
+// bytes; true when the CPU should leave LPM0
+bool HAL_UART_tick(void);
 
 #endif /* HAL_HAL_UART_H_ */
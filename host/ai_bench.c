@@ -0,0 +1,86 @@
+//*****************************************************************************
+//
+// ai_bench.c - Host benchmark for the checkers AI
+//
+// Lets the AI play both sides of a few games with a fixed time budget per move
+// and reports the search speed in nodes per second together with the depth
+// reached. Usage: ai_bench [budget_ms] [games]
+//
+//*****************************************************************************
+
+#include <game/ai.h>
+#include <game/tablebase.h>
+#include <hal/hal_timer.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEFAULT_BUDGET_MS 100
+#define DEFAULT_GAMES 2
+#define MAX_GAME_MOVES 150
+
+int main(int argc, char** argv) {
+  int budget_ms = (argc > 1) ? atoi(argv[1]) : DEFAULT_BUDGET_MS;
+  int games = (argc > 2) ? atoi(argv[2]) : DEFAULT_GAMES;
+  uint64_t total_nodes = 0;
+  uint32_t total_ms = 0;
+  int total_moves = 0, total_depth = 0;
+  int g;
+
+  HAL_TIMER_config();
+
+  for (g = 0; g < games; g++) {
+    GameState game;
+    Player winner = PLAYER_NONE;
+    TbValue endgame = TB_UNKNOWN;
+    uint8_t plies = 0;
+    int n;
+
+    CHECKERS_init(&game, PLAYER_RED);
+    for (n = 0; n < MAX_GAME_MOVES; n++) {
+      Move move;
+      AiStats stats;
+      uint32_t start;
+
+      winner = CHECKERS_game_ended(&game);
+      if (winner != PLAYER_NONE) break;
+      endgame = TB_probe(&game, &plies);
+      if (endgame != TB_UNKNOWN) break;
+
+      start = HAL_TIMER_get_ms();
+      if (!CHECKERS_ai_best_move(&game, budget_ms, &move)) break;
+      total_ms += HAL_TIMER_get_ms() - start;
+      CHECKERS_ai_get_stats(&stats);
+
+      if (!CHECKERS_apply_move(&game, &move)) {
+        printf("game %d: AI returned an illegal move\n", g);
+        return 1;
+      }
+      if (stats.overflows) {
+        printf("game %d: %u move lists overflowed\n", g, stats.overflows);
+        return 1;
+      }
+      total_nodes += stats.nodes;
+      total_depth += stats.depth;
+      total_moves++;
+    }
+    if (endgame == TB_WIN || endgame == TB_LOSS) {
+      winner = ((endgame == TB_WIN) == (game.current_player == PLAYER_RED))
+                   ? PLAYER_RED
+                   : PLAYER_BLACK;
+      printf("game %d: %d moves, tablebase %s in %d plies\n", g, n,
+             winner == PLAYER_RED ? "red wins" : "black wins", plies);
+    } else {
+      printf("game %d: %d moves, %s\n", g, n,
+             winner == PLAYER_RED     ? "red wins"
+             : winner == PLAYER_BLACK ? "black wins"
+             : endgame == TB_DRAW     ? "tablebase draw"
+                                      : "unfinished");
+    }
+  }
+
+  if (total_moves == 0 || total_ms == 0) return 0;
+  printf("%d moves, %llu nodes in %u ms: %.0f nodes/s, mean depth %.1f\n",
+         total_moves, (unsigned long long)total_nodes, total_ms,
+         total_nodes * 1000.0 / total_ms, (double)total_depth / total_moves);
+  return 0;
+}
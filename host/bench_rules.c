@@ -0,0 +1,277 @@
+//*****************************************************************************
+//
+// bench_rules.c - Host micro-benchmark for the checkers rules engine
+//
+// Compares the bitboard implementation of CHECKERS_find_valid_move,
+// CHECKERS_game_ended and CHECKERS_generate_moves against the previous 8x8
+// array implementation, which copied the whole GameState for every piece and
+// direction it tried.
+//
+//*****************************************************************************
+
+#include <game/checkers.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NUM_POSITIONS 256
+#define ITERATIONS 2000
+
+//*****************************************************************************
+//
+// Reference: array based rules as they were before the bitboard rewrite
+//
+//*****************************************************************************
+typedef struct {
+  PieceType board[8][8];
+  Player current_player;
+} LegacyState;
+
+static bool legacy_apply_move(LegacyState* state, const Move* move) {
+  int row_diff, col_diff;
+  PieceType moving_piece;
+
+  if (move->from_row < 0 || move->from_row >= 8 || move->from_col < 0 ||
+      move->from_col >= 8 || move->to_row < 0 || move->to_row >= 8 ||
+      move->to_col < 0 || move->to_col >= 8)
+    return false;
+  if (state->board[move->from_row][move->from_col] == EMPTY) return false;
+  if (state->board[move->to_row][move->to_col] != EMPTY) return false;
+
+  moving_piece = state->board[move->from_row][move->from_col];
+  if (state->current_player == PLAYER_RED) {
+    if (moving_piece != RED_PIECE && moving_piece != RED_KING) return false;
+  } else {
+    if (moving_piece != BLACK_PIECE && moving_piece != BLACK_KING) return false;
+  }
+
+  row_diff = abs(move->to_row - move->from_row);
+  col_diff = abs(move->to_col - move->from_col);
+  if (row_diff != col_diff) return false;
+  if (row_diff != 1 && row_diff != 2) return false;
+
+  if (row_diff == 2) {
+    PieceType captured = state->board[(move->from_row + move->to_row) / 2]
+                                     [(move->from_col + move->to_col) / 2];
+    if (captured == EMPTY) return false;
+    if ((moving_piece == RED_PIECE || moving_piece == RED_KING) &&
+        (captured == RED_PIECE || captured == RED_KING))
+      return false;
+    if ((moving_piece == BLACK_PIECE || moving_piece == BLACK_KING) &&
+        (captured == BLACK_PIECE || captured == BLACK_KING))
+      return false;
+  }
+
+  if (moving_piece == RED_PIECE && move->to_row > move->from_row) return false;
+  if (moving_piece == BLACK_PIECE && move->to_row < move->from_row)
+    return false;
+
+  state->board[move->to_row][move->to_col] = moving_piece;
+  state->board[move->from_row][move->from_col] = EMPTY;
+  if (row_diff == 2)
+    state->board[(move->from_row + move->to_row) / 2]
+                [(move->from_col + move->to_col) / 2] = EMPTY;
+  state->current_player =
+      (state->current_player == PLAYER_RED) ? PLAYER_BLACK : PLAYER_RED;
+  return true;
+}
+
+static bool legacy_find_valid_move(LegacyState* state, Move* move_to_fill) {
+  int dr[] = {-1, -1, 1, 1, -2, -2, 2, 2};
+  int dc[] = {-1, 1, -1, 1, -2, 2, -2, 2};
+  PieceType my_piece =
+      (state->current_player == PLAYER_RED) ? RED_PIECE : BLACK_PIECE;
+  PieceType my_king =
+      (state->current_player == PLAYER_RED) ? RED_KING : BLACK_KING;
+  int r, c, i;
+
+  for (r = 0; r < 8; r++) {
+    for (c = 0; c < 8; c++) {
+      PieceType piece = state->board[r][c];
+      if (piece == my_piece || piece == my_king) {
+        for (i = 0; i < 8; i++) {
+          Move potential_move;
+          potential_move.from_row = r;
+          potential_move.from_col = c;
+          potential_move.to_row = r + dr[i];
+          potential_move.to_col = c + dc[i];
+          LegacyState temp_state = *state;
+          if (legacy_apply_move(&temp_state, &potential_move)) {
+            *move_to_fill = potential_move;
+            return true;
+          }
+        }
+      }
+    }
+  }
+  return false;
+}
+
+// All legal moves by trial and error, the way a move list had to be built
+// on top of the old API
+static int legacy_count_moves(LegacyState* state) {
+  int dr[] = {-1, -1, 1, 1, -2, -2, 2, 2};
+  int dc[] = {-1, 1, -1, 1, -2, 2, -2, 2};
+  int r, c, i, count = 0;
+
+  for (r = 0; r < 8; r++) {
+    for (c = 0; c < 8; c++) {
+      for (i = 0; i < 8; i++) {
+        Move potential_move;
+        potential_move.from_row = r;
+        potential_move.from_col = c;
+        potential_move.to_row = r + dr[i];
+        potential_move.to_col = c + dc[i];
+        LegacyState temp_state = *state;
+        if (legacy_apply_move(&temp_state, &potential_move)) count++;
+      }
+    }
+  }
+  return count;
+}
+
+static Player legacy_game_ended(LegacyState* state) {
+  bool red_has_pieces = false;
+  bool black_has_pieces = false;
+  Move dummy_move;
+  int row, col;
+
+  for (row = 0; row < 8; row++) {
+    for (col = 0; col < 8; col++) {
+      PieceType piece = state->board[row][col];
+      if (piece == RED_PIECE || piece == RED_KING) red_has_pieces = true;
+      if (piece == BLACK_PIECE || piece == BLACK_KING) black_has_pieces = true;
+    }
+  }
+  if (!red_has_pieces) return PLAYER_BLACK;
+  if (!black_has_pieces) return PLAYER_RED;
+  if (!legacy_find_valid_move(state, &dummy_move))
+    return (state->current_player == PLAYER_RED) ? PLAYER_BLACK : PLAYER_RED;
+  return PLAYER_NONE;
+}
+
+//*****************************************************************************
+//
+// Benchmark driver
+//
+//*****************************************************************************
+static GameState positions[NUM_POSITIONS];
+static LegacyState legacy_positions[NUM_POSITIONS];
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Play random games and record every position reached
+static void collect_positions(void) {
+  GameState game;
+  int count = 0;
+  int row, col;
+
+  srand(1);
+  CHECKERS_init(&game, PLAYER_RED);
+  while (count < NUM_POSITIONS) {
+    Move move = {0};
+    int tries;
+
+    positions[count] = game;
+    legacy_positions[count].current_player = game.current_player;
+    for (row = 0; row < 8; row++)
+      for (col = 0; col < 8; col++)
+        legacy_positions[count].board[row][col] =
+            CHECKERS_piece_at(&game, row, col);
+    count++;
+
+    if (CHECKERS_game_ended(&game) != PLAYER_NONE) {
+      CHECKERS_init(&game, PLAYER_RED);
+      continue;
+    }
+    for (tries = 0; tries < 64; tries++) {
+      move.from_row = rand() % 8;
+      move.from_col = rand() % 8;
+      move.to_row = move.from_row + ((rand() & 1) ? 1 : -1);
+      move.to_col = move.from_col + ((rand() & 1) ? 1 : -1);
+      if (CHECKERS_apply_move(&game, &move)) break;
+    }
+    if (tries == 64 && CHECKERS_find_valid_move(&game, &move))
+      CHECKERS_apply_move(&game, &move);
+  }
+}
+
+int main(void) {
+  volatile int sink = 0;
+  double start, legacy_ns, bitboard_ns;
+  Move move;
+  MoveList list;
+  int i, p;
+
+  collect_positions();
+
+  // Both implementations must agree before their speed means anything
+  for (p = 0; p < NUM_POSITIONS; p++) {
+    if (CHECKERS_game_ended(&positions[p]) !=
+        legacy_game_ended(&legacy_positions[p])) {
+      printf("mismatch in CHECKERS_game_ended at position %d\n", p);
+      return 1;
+    }
+    // The array rules had no forced captures, so only compare quiet positions
+    CHECKERS_generate_moves(&positions[p], &list);
+    if (list.count > 0 && list.moves[0].jumps == 0 &&
+        list.count != legacy_count_moves(&legacy_positions[p])) {
+      printf("mismatch in CHECKERS_generate_moves at position %d\n", p);
+      return 1;
+    }
+  }
+
+  start = now_ns();
+  for (i = 0; i < ITERATIONS; i++)
+    for (p = 0; p < NUM_POSITIONS; p++)
+      sink += legacy_find_valid_move(&legacy_positions[p], &move);
+  legacy_ns = (now_ns() - start) / ((double)ITERATIONS * NUM_POSITIONS);
+
+  start = now_ns();
+  for (i = 0; i < ITERATIONS; i++)
+    for (p = 0; p < NUM_POSITIONS; p++)
+      sink += CHECKERS_find_valid_move(&positions[p], &move);
+  bitboard_ns = (now_ns() - start) / ((double)ITERATIONS * NUM_POSITIONS);
+
+  printf("find_valid_move: array %8.1f ns  bitboard %8.1f ns  (%.1fx)\n",
+         legacy_ns, bitboard_ns, legacy_ns / bitboard_ns);
+
+  start = now_ns();
+  for (i = 0; i < ITERATIONS; i++)
+    for (p = 0; p < NUM_POSITIONS; p++)
+      sink += legacy_game_ended(&legacy_positions[p]);
+  legacy_ns = (now_ns() - start) / ((double)ITERATIONS * NUM_POSITIONS);
+
+  start = now_ns();
+  for (i = 0; i < ITERATIONS; i++)
+    for (p = 0; p < NUM_POSITIONS; p++)
+      sink += CHECKERS_game_ended(&positions[p]);
+  bitboard_ns = (now_ns() - start) / ((double)ITERATIONS * NUM_POSITIONS);
+
+  printf("game_ended:      array %8.1f ns  bitboard %8.1f ns  (%.1fx)\n",
+         legacy_ns, bitboard_ns, legacy_ns / bitboard_ns);
+
+  start = now_ns();
+  for (i = 0; i < ITERATIONS; i++)
+    for (p = 0; p < NUM_POSITIONS; p++)
+      sink += legacy_count_moves(&legacy_positions[p]);
+  legacy_ns = (now_ns() - start) / ((double)ITERATIONS * NUM_POSITIONS);
+
+  start = now_ns();
+  for (i = 0; i < ITERATIONS; i++) {
+    for (p = 0; p < NUM_POSITIONS; p++) {
+      CHECKERS_generate_moves(&positions[p], &list);
+      sink += list.count;
+    }
+  }
+  bitboard_ns = (now_ns() - start) / ((double)ITERATIONS * NUM_POSITIONS);
+
+  printf("generate_moves:  array %8.1f ns  bitboard %8.1f ns  (%.1fx)\n",
+         legacy_ns, bitboard_ns, legacy_ns / bitboard_ns);
+
+  return sink == -1;
+}
@@ -0,0 +1,129 @@
+//*****************************************************************************
+//
+// gen_book.c - Opening book generator
+//
+// Visits every position reachable from the start within a number of plies,
+// scores each legal move with a fixed-depth search and keeps the moves that
+// are close to the best one. Writes the book as C source to stdout:
+//
+//   gen_book [plies] [depth] > ../common_msp430/game/book_data.c
+//
+//*****************************************************************************
+
+#include <game/ai.h>
+#include <game/book.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEFAULT_PLIES 4
+#define DEFAULT_DEPTH 10
+
+// Moves scoring up to this much below the best stay in the book
+#define MARGIN 6
+
+#define MAX_POSITIONS 16384
+#define MAX_RECORDS 16384
+
+static GameState positions[MAX_POSITIONS];
+static int num_positions;
+static BookEntry records[MAX_RECORDS];
+static int num_records;
+
+static bool seen(uint32_t key) {
+  int i;
+
+  for (i = 0; i < num_positions; i++)
+    if (positions[i].hash == key) return true;
+  return false;
+}
+
+static void collect(const GameState* state, int plies) {
+  MoveList list;
+  int i;
+
+  if (seen(state->hash)) return;
+  if (num_positions == MAX_POSITIONS) {
+    fprintf(stderr, "too many positions\n");
+    exit(1);
+  }
+  positions[num_positions++] = *state;
+  if (plies == 0) return;
+
+  CHECKERS_generate_moves(state, &list);
+  if (list.overflow) {
+    fprintf(stderr, "move list overflow, raise CHECKERS_MAX_MOVES\n");
+    exit(1);
+  }
+  for (i = 0; i < list.count; i++) {
+    GameState child = *state;
+    CHECKERS_make_move(&child, &list.moves[i]);
+    collect(&child, plies - 1);
+  }
+}
+
+static void add_moves(const GameState* state, int depth) {
+  int16_t scores[CHECKERS_MAX_MOVES];
+  int16_t best = INT16_MIN;
+  MoveList list;
+  int i;
+
+  // A forced move needs no book entry, the AI plays it without searching
+  CHECKERS_generate_moves(state, &list);
+  if (list.count < 2) return;
+
+  for (i = 0; i < list.count; i++) {
+    scores[i] = CHECKERS_ai_score_move(state, &list.moves[i], depth);
+    if (scores[i] > best) best = scores[i];
+  }
+  for (i = 0; i < list.count; i++) {
+    const Move* move = &list.moves[i];
+
+    if (scores[i] < best - MARGIN) continue;
+    if (num_records == MAX_RECORDS) {
+      fprintf(stderr, "too many records\n");
+      exit(1);
+    }
+    records[num_records].key = state->hash;
+    records[num_records].move =
+        BOOK_PACK_MOVE(CHECKERS_SQUARE(move->from_row, move->from_col),
+                       CHECKERS_SQUARE(move->to_row, move->to_col));
+    records[num_records].weight = MARGIN + 1 - (best - scores[i]);
+    num_records++;
+  }
+}
+
+static int compare_records(const void* a, const void* b) {
+  const BookEntry* x = a;
+  const BookEntry* y = b;
+
+  if (x->key != y->key) return (x->key < y->key) ? -1 : 1;
+  return (int)y->weight - (int)x->weight;
+}
+
+int main(int argc, char** argv) {
+  int plies = (argc > 1) ? atoi(argv[1]) : DEFAULT_PLIES;
+  int depth = (argc > 2) ? atoi(argv[2]) : DEFAULT_DEPTH;
+  GameState start;
+  int i;
+
+  CHECKERS_init(&start, PLAYER_RED);
+  collect(&start, plies);
+  for (i = 0; i < num_positions; i++) add_moves(&positions[i], depth);
+  qsort(records, num_records, sizeof(records[0]), compare_records);
+
+  printf("// Opening book generated by host/gen_book %d %d, do not edit.\n",
+         plies, depth);
+  printf("// %d positions, %d moves.\n\n", num_positions, num_records);
+  printf("#include <game/book.h>\n\n");
+  printf("const BookEntry opening_book[] = {\n");
+  for (i = 0; i < num_records; i++)
+    printf("    {0x%08lXUL, 0x%03X, %u},\n", (unsigned long)records[i].key,
+           records[i].move, records[i].weight);
+  printf("};\n\n");
+  printf("const uint16_t opening_book_size =\n");
+  printf("    sizeof(opening_book) / sizeof(opening_book[0]);\n");
+
+  fprintf(stderr, "%d positions, %d book moves, %u bytes\n", num_positions,
+          num_records, (unsigned)(num_records * sizeof(BookEntry)));
+  return 0;
+}
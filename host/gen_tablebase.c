@@ -0,0 +1,323 @@
+//*****************************************************************************
+//
+// gen_tablebase.c - Endgame tablebase generator
+//
+// Solves every position with kings only and at most TB_MAX_PIECES pieces by
+// retrograde analysis, then writes the run-length coded tables as C source to
+// stdout:
+//
+//   gen_tablebase > ../common_msp430/game/tablebase_data.c
+//
+// Material classes are solved from the fewest pieces up, so that every capture
+// leads into a class that is already known. A class and its color-swapped
+// twin (e.g. 2v1 and 1v2) are solved together, since moves alternate between
+// them.
+//
+//*****************************************************************************
+
+#include <game/tablebase.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UNKNOWN -1
+#define MAX_PLIES 254
+
+typedef struct {
+  int red;
+  int black;
+  uint32_t size;
+  uint32_t* red_sets;    // Pieces of each position, by index
+  uint32_t* black_sets;
+  int16_t* plies;        // Distance to the end, UNKNOWN or draw once solved
+} Class;
+
+static Class classes[16];
+static int num_classes;
+
+static Class* find_class(int red, int black) {
+  int i;
+
+  for (i = 0; i < num_classes; i++)
+    if (classes[i].red == red && classes[i].black == black) return &classes[i];
+  return NULL;
+}
+
+static int count_bits(uint32_t bb) {
+  int count = 0;
+  while (bb) {
+    bb &= bb - 1;
+    count++;
+  }
+  return count;
+}
+
+// Calls back for every set of count squares outside of skip
+static void for_each_set(int count, uint32_t skip, int from, uint32_t set,
+                         void (*callback)(uint32_t set, void* arg),
+                         void* arg) {
+  int sq;
+
+  if (count == 0) {
+    callback(set, arg);
+    return;
+  }
+  for (sq = from; sq < CHECKERS_NUM_SQUARES; sq++) {
+    if (skip & (1UL << sq)) continue;
+    for_each_set(count - 1, skip, sq + 1, set | (1UL << sq), callback, arg);
+  }
+}
+
+typedef struct {
+  Class* tb_class;
+  uint32_t red;
+} Fill;
+
+static void add_black(uint32_t black, void* arg) {
+  Fill* fill = arg;
+  uint32_t index = TB_index(fill->red, black);
+
+  fill->tb_class->red_sets[index] = fill->red;
+  fill->tb_class->black_sets[index] = black;
+}
+
+static void add_red(uint32_t red, void* arg) {
+  Fill* fill = arg;
+
+  fill->red = red;
+  for_each_set(fill->tb_class->black, red, 0, 0, add_black, fill);
+}
+
+static uint32_t binomial(int n, int k) {
+  uint32_t result = 1;
+  int i;
+
+  for (i = 1; i <= k; i++) result = result * (n - k + i) / i;
+  return result;
+}
+
+static Class* add_class(int red, int black) {
+  Class* tb_class = &classes[num_classes++];
+  Fill fill;
+
+  tb_class->red = red;
+  tb_class->black = black;
+  tb_class->size =
+      binomial(CHECKERS_NUM_SQUARES, red) *
+      binomial(CHECKERS_NUM_SQUARES - red, black);
+  tb_class->red_sets = malloc(tb_class->size * sizeof(uint32_t));
+  tb_class->black_sets = malloc(tb_class->size * sizeof(uint32_t));
+  tb_class->plies = malloc(tb_class->size * sizeof(int16_t));
+  for (uint32_t i = 0; i < tb_class->size; i++) tb_class->plies[i] = UNKNOWN;
+
+  fill.tb_class = tb_class;
+  for_each_set(red, 0, 0, 0, add_red, &fill);
+  return tb_class;
+}
+
+// Distance of the position reached by a move, with the opponent to move
+static int child_plies(uint32_t red, uint32_t black) {
+  Class* tb_class;
+
+  // Capturing the last piece ends the game
+  if (!black) return 0;
+  TB_flip(&red, &black);
+  tb_class = find_class(count_bits(red), count_bits(black));
+  return tb_class->plies[TB_index(red, black)];
+}
+
+// Tries to settle a position at distance plies, with red to move
+static bool solve(Class* tb_class, uint32_t index, int plies) {
+  GameState state;
+  MoveList list;
+  bool all_known = true;
+  int longest = -1;
+  int i;
+
+  memset(&state, 0, sizeof(state));
+  state.red = tb_class->red_sets[index];
+  state.black = tb_class->black_sets[index];
+  state.kings = state.red | state.black;
+  state.current_player = PLAYER_RED;
+  CHECKERS_generate_moves(&state, &list);
+  if (list.overflow) {
+    fprintf(stderr, "move list overflow, raise CHECKERS_MAX_MOVES\n");
+    exit(1);
+  }
+
+  for (i = 0; i < list.count; i++) {
+    GameState child = state;
+    int child_value;
+
+    CHECKERS_make_move(&child, &list.moves[i]);
+    // The child has black to move; look it up from black's side
+    child_value = child_plies(child.red, child.black);
+    if (child_value == UNKNOWN) {
+      all_known = false;
+    } else if ((child_value & 1) == 0 && child_value + 1 == plies) {
+      // A move into a lost position for the opponent
+      tb_class->plies[index] = plies;
+      return true;
+    } else if (child_value & 1) {
+      if (child_value > longest) longest = child_value;
+    } else {
+      all_known = false;  // Losing for the opponent, but not at this distance
+    }
+  }
+
+  // Lost when every move leads to a win for the opponent, including when
+  // there is no move at all
+  if (all_known && longest + 1 == plies) {
+    tb_class->plies[index] = plies;
+    return true;
+  }
+  return false;
+}
+
+static int solve_classes(Class** group, int count, int known_plies) {
+  int plies, i;
+  uint32_t index;
+
+  for (plies = 0; plies <= MAX_PLIES; plies++) {
+    bool changed = false;
+
+    for (i = 0; i < count; i++)
+      for (index = 0; index < group[i]->size; index++)
+        if (group[i]->plies[index] == UNKNOWN)
+          changed |= solve(group[i], index, plies);
+
+    if (changed) {
+      known_plies = plies;
+    } else if (plies > known_plies + 1) {
+      return known_plies;
+    }
+  }
+  fprintf(stderr, "distance does not fit in a byte\n");
+  exit(1);
+}
+
+// Stored value of a position, or DONT_CARE for one that the probe resolves
+// by trying moves or by mirroring
+#define DONT_CARE -1
+
+static int stored_value(const Class* tb_class, uint32_t index) {
+  uint32_t red = tb_class->red_sets[index];
+  uint32_t black = tb_class->black_sets[index];
+  GameState state;
+
+  memset(&state, 0, sizeof(state));
+  state.red = red;
+  state.black = black;
+  state.kings = red | black;
+  state.current_player = PLAYER_RED;
+  if (CHECKERS_has_capture(&state)) return DONT_CARE;
+  TB_canonical(&red, &black);
+  if (TB_index(red, black) != index) return DONT_CARE;
+
+  if (tb_class->plies[index] == UNKNOWN) return 0;
+  if (tb_class->plies[index] + 1 > TB_VALUE_MASK) {
+    fprintf(stderr, "distance does not fit the value bits\n");
+    exit(1);
+  }
+  return tb_class->plies[index] + 1;
+}
+
+static void emit_class(const Class* tb_class) {
+  uint8_t* data = malloc(tb_class->size * 2);
+  int* values = malloc(TB_BLOCK_SIZE * sizeof(int));
+  uint32_t length = 0;
+  uint32_t index;
+  int blocks = (tb_class->size + TB_BLOCK_SIZE - 1) / TB_BLOCK_SIZE;
+  int block, count, i;
+
+  printf("static const uint16_t index_%d_%d[] = {", tb_class->red,
+         tb_class->black);
+  for (block = 0; block < blocks; block++) {
+    uint32_t start = block * TB_BLOCK_SIZE;
+    int first;
+
+    count = (tb_class->size - start < TB_BLOCK_SIZE) ? tb_class->size - start
+                                                      : TB_BLOCK_SIZE;
+    if (length > UINT16_MAX) {
+      fprintf(stderr, "class %dv%d does not fit 64KB\n", tb_class->red,
+              tb_class->black);
+      exit(1);
+    }
+    printf("%s%u,", (block % 10) ? " " : "\n    ", (unsigned)length);
+
+    // Don't-care positions extend the run before them; at the start of a
+    // block they join the first stored value
+    for (i = 0; i < count; i++) values[i] = stored_value(tb_class, start + i);
+    for (first = 0; first < count && values[first] == DONT_CARE; first++) {
+    }
+    for (i = 0; i < count; i++) {
+      if (values[i] != DONT_CARE) continue;
+      values[i] = (i < first) ? ((first < count) ? values[first] : 0)
+                              : values[i - 1];
+    }
+
+    for (i = 0; i < count;) {
+      int run = 1;
+
+      while (i + run < count && values[i + run] == values[i]) run++;
+      if (run < TB_LONG_RUN) {
+        data[length++] = ((run - 1) << TB_RUN_SHIFT) | values[i];
+      } else {
+        data[length++] = ((TB_LONG_RUN - 1) << TB_RUN_SHIFT) | values[i];
+        data[length++] = run - TB_LONG_RUN;
+      }
+      i += run;
+    }
+  }
+  printf("\n};\n\n");
+
+  printf("static const uint8_t data_%d_%d[] = {", tb_class->red,
+         tb_class->black);
+  for (index = 0; index < length; index++)
+    printf("%s%u,", (index % 16) ? " " : "\n    ", data[index]);
+  printf("\n};\n\n");
+
+  fprintf(stderr, "%dv%d: %u positions, %u bytes\n", tb_class->red,
+          tb_class->black, (unsigned)tb_class->size,
+          (unsigned)(length + blocks * 2));
+  free(values);
+  free(data);
+}
+
+int main(void) {
+  Class* group[2];
+  int known_plies = 0;
+  int pieces, red, i;
+
+  // Solve from the fewest pieces up. With colors swapped, classes come in
+  // pairs (red, black) and (black, red) that are solved together.
+  for (pieces = 2; pieces <= TB_MAX_PIECES; pieces++) {
+    for (red = 1; red <= pieces / 2; red++) {
+      int count = 0;
+
+      group[count++] = add_class(red, pieces - red);
+      if (pieces - red != red) group[count++] = add_class(pieces - red, red);
+      known_plies = solve_classes(group, count, known_plies);
+    }
+  }
+
+  printf("// Endgame tablebase generated by host/gen_tablebase, ");
+  printf("do not edit.\n");
+  printf("// Kings only, up to %d pieces, red to move.\n\n", TB_MAX_PIECES);
+  printf("#include <game/tablebase.h>\n\n");
+  // Classes where the side to move is behind are left out, the probe tries
+  // every move into the color-swapped class instead
+  for (i = 0; i < num_classes; i++)
+    if (classes[i].red >= classes[i].black) emit_class(&classes[i]);
+
+  printf("const TbClass tb_classes[] = {\n");
+  for (i = 0; i < num_classes; i++)
+    if (classes[i].red >= classes[i].black)
+      printf("    {%d, %d, %luUL, index_%d_%d, data_%d_%d},\n", classes[i].red,
+           classes[i].black, (unsigned long)classes[i].size, classes[i].red,
+           classes[i].black, classes[i].red, classes[i].black);
+  printf("};\n\n");
+  printf("const uint8_t tb_num_classes =\n");
+  printf("    sizeof(tb_classes) / sizeof(tb_classes[0]);\n");
+  return 0;
+}
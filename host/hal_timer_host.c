@@ -0,0 +1,16 @@
+//*****************************************************************************
+//
+// hal_timer_host.c - Host implementation of the millisecond time base
+//
+//*****************************************************************************
+
+#include <hal/hal_timer.h>
+#include <time.h>
+
+void HAL_TIMER_config(void) {}
+
+uint32_t HAL_TIMER_get_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
@@ -0,0 +1,21 @@
+//*****************************************************************************
+//
+// driverlib.h - Host stand-in for the MSP430 driverlib header
+//
+// Only what the LCD driver needs to compile: its GPIO calls drive the reset
+// line and do nothing on the host, and the LCD_* pin macros that name
+// driverlib constants are only ever passed to them.
+//
+//*****************************************************************************
+
+#ifndef HOST_DRIVERLIB_H_
+#define HOST_DRIVERLIB_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define GPIO_setOutputLowOnPin(port, pins) ((void)0)
+#define GPIO_setOutputHighOnPin(port, pins) ((void)0)
+#define __delay_cycles(cycles) ((void)0)
+
+#endif /* HOST_DRIVERLIB_H_ */
@@ -0,0 +1,217 @@
+//*****************************************************************************
+//
+// lcd_emu.c - Host emulation of the Crystalfontz 128x128 LCD
+//
+// The model keeps display RAM in the controller's address space: CASET and
+// RASET set a window, RAMWR starts writing at its top left corner and each
+// pixel (two data bytes, high byte first) advances left to right, top to
+// bottom, wrapping inside the window. MADCTL only decides where the visible
+// 128x128 panel sits in that space, which is why the driver adds a different
+// offset to its windows for each orientation.
+//
+// The panel scans frame memory lines 1 to 128 of the 132 the controller is
+// set up for; MY mirrors which RAM row a line comes from. Vertical scrolling
+// (VSCRDEF, VSCRSADD) and partial mode (PTLAR, PTLON, NORON) change which
+// line each panel row shows, so they are modelled in LCD_EMU_get_pixel.
+//
+//*****************************************************************************
+
+#include "lcd_emu.h"
+
+#include <drivers/crystalfontz.h>
+#include <hal/hal_lcd.h>
+#include <stdio.h>
+
+// Large enough for either axis of the 132x162 controller RAM
+#define RAM_SIZE 162
+
+static uint16_t ram[RAM_SIZE][RAM_SIZE];
+static LcdEmuStats stats;
+
+static uint8_t command = CM_NOP;
+static uint8_t args[6];
+static int arg_count;
+static uint8_t madctl;
+static int x0, x1, y0, y1;
+static int x, y;
+static int high_byte = -1;
+static int scroll_top, scroll_height, scroll_start;
+static int partial, partial_start, partial_end;
+
+// Top left corner of the panel in RAM for each MADCTL setting the driver uses
+static void panel_origin(int* origin_x, int* origin_y) {
+  switch (madctl & (CM_MADCTL_MX | CM_MADCTL_MY | CM_MADCTL_MV)) {
+    case CM_MADCTL_MX | CM_MADCTL_MY:  // LCD_ORIENTATION_UP
+      *origin_x = 2;
+      *origin_y = 3;
+      break;
+    case CM_MADCTL_MY | CM_MADCTL_MV:  // LCD_ORIENTATION_LEFT
+      *origin_x = 3;
+      *origin_y = 2;
+      break;
+    case CM_MADCTL_MX | CM_MADCTL_MV:  // LCD_ORIENTATION_RIGHT
+      *origin_x = 1;
+      *origin_y = 2;
+      break;
+    default:  // LCD_ORIENTATION_DOWN
+      *origin_x = 2;
+      *origin_y = 1;
+      break;
+  }
+}
+
+static void write_pixel(uint16_t value) {
+  if (x < RAM_SIZE && y < RAM_SIZE) ram[y][x] = value;
+  stats.pixels++;
+  if (++x > x1) {
+    x = x0;
+    if (++y > y1) y = y0;
+  }
+}
+
+//*****************************************************************************
+//
+// hal/hal_lcd.h
+//
+//*****************************************************************************
+void HAL_LCD_init_gpio(void) {}
+
+void HAL_LCD_config(void) {}
+
+void HAL_LCD_writeCommand(uint8_t cmd) {
+  stats.spi_bytes++;
+  command = cmd;
+  arg_count = 0;
+  high_byte = -1;
+  if (cmd == CM_CASET || cmd == CM_RASET) stats.window_sets++;
+  if (cmd == CM_RAMWR) {
+    stats.ramwr++;
+    x = x0;
+    y = y0;
+  }
+  if (cmd == CM_PTLON) partial = 1;
+  if (cmd == CM_NORON) partial = 0;
+}
+
+void HAL_LCD_writeData(uint8_t data) {
+  stats.spi_bytes++;
+  switch (command) {
+    case CM_CASET:
+    case CM_RASET:
+      if (arg_count < 4) args[arg_count++] = data;
+      if (arg_count == 4) {
+        int start = args[0] << 8 | args[1];
+        int end = args[2] << 8 | args[3];
+        if (command == CM_CASET) {
+          x0 = start;
+          x1 = end;
+        } else {
+          y0 = start;
+          y1 = end;
+        }
+      }
+      break;
+    case CM_VSCRDEF:
+      if (arg_count < 6) args[arg_count++] = data;
+      if (arg_count == 6) {
+        scroll_top = args[0] << 8 | args[1];
+        scroll_height = args[2] << 8 | args[3];
+      }
+      break;
+    case CM_VSCRSADD:
+      if (arg_count < 2) args[arg_count++] = data;
+      if (arg_count == 2) scroll_start = args[0] << 8 | args[1];
+      break;
+    case CM_PTLAR:
+      if (arg_count < 4) args[arg_count++] = data;
+      if (arg_count == 4) {
+        partial_start = args[0] << 8 | args[1];
+        partial_end = args[2] << 8 | args[3];
+      }
+      break;
+    case CM_MADCTL:
+      madctl = data;
+      break;
+    case CM_RAMWR:
+      if (high_byte < 0) {
+        high_byte = data;
+      } else {
+        write_pixel(high_byte << 8 | data);
+        high_byte = -1;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void HAL_LCD_fillBurst(uint16_t color, uint32_t pixels) {
+  while (pixels--) {
+    HAL_LCD_writeData(color >> 8);
+    HAL_LCD_writeData(color);
+  }
+}
+
+void HAL_LCD_fillDMA(uint16_t color, uint32_t pixels) {
+  HAL_LCD_fillBurst(color, pixels);
+}
+
+void HAL_LCD_writeDataDMA(const uint8_t* data, uint16_t length) {
+  while (length--) HAL_LCD_writeData(*data++);
+}
+
+//*****************************************************************************
+//
+// Inspection
+//
+//*****************************************************************************
+LcdEmuStats LCD_EMU_get_stats(void) { return stats; }
+
+void LCD_EMU_reset_stats(void) {
+  LcdEmuStats zero = {0};
+  stats = zero;
+}
+
+uint32_t LCD_EMU_bus_us(const LcdEmuStats* s) {
+  return (uint32_t)((uint64_t)s->spi_bytes * 8 * 1000000 / LCD_EMU_SPI_HZ);
+}
+
+uint16_t LCD_EMU_get_pixel(int px, int py) {
+  int origin_x, origin_y, row, line;
+  panel_origin(&origin_x, &origin_y);
+  row = origin_y + py;
+
+  // Scrolling and partial mode act on lines, which are rows unless MV swaps
+  // the axes
+  if (madctl & CM_MADCTL_MV) return ram[row][origin_x + px];
+
+  line = (madctl & CM_MADCTL_MY) ? LCD_FRAME_LINES - 1 - row : row;
+  if (partial && (line < partial_start || line > partial_end)) return 0;
+  if (scroll_height > 0 && line >= scroll_top &&
+      line < scroll_top + scroll_height) {
+    line = scroll_top +
+           (line - scroll_top + scroll_start - scroll_top + scroll_height) %
+               scroll_height;
+  }
+  row = (madctl & CM_MADCTL_MY) ? LCD_FRAME_LINES - 1 - line : line;
+  return ram[row][origin_x + px];
+}
+
+int LCD_EMU_write_ppm(const char* path) {
+  FILE* f = fopen(path, "wb");
+  int px, py;
+
+  if (!f) return -1;
+  fprintf(f, "P6\n%d %d\n255\n", LCD_EMU_WIDTH, LCD_EMU_HEIGHT);
+  for (py = 0; py < LCD_EMU_HEIGHT; py++) {
+    for (px = 0; px < LCD_EMU_WIDTH; px++) {
+      uint16_t c = LCD_EMU_get_pixel(px, py);
+      // RGB565, widened by repeating the top bits
+      uint8_t rgb[3] = {(uint8_t)((c >> 8 & 0xF8) | (c >> 13)),
+                        (uint8_t)((c >> 3 & 0xFC) | (c >> 9 & 0x03)),
+                        (uint8_t)((c << 3 & 0xF8) | (c >> 2 & 0x07))};
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+  return fclose(f) == 0 ? 0 : -1;
+}
@@ -0,0 +1,41 @@
+//*****************************************************************************
+//
+// lcd_emu.h - Host emulation of the Crystalfontz 128x128 LCD
+//
+// Implements the HAL_LCD_* functions of hal/hal_lcd.h against a model of the
+// ST7735 controller, so the real crystalfontz driver, grlib and the views run
+// unchanged on the host. Frames land in a 128x128 RGB565 framebuffer and
+// every byte that would cross the SPI bus is counted.
+//
+//*****************************************************************************
+
+#ifndef HOST_LCD_EMU_H_
+#define HOST_LCD_EMU_H_
+
+#include <stdint.h>
+
+#define LCD_EMU_WIDTH 128
+#define LCD_EMU_HEIGHT 128
+
+// SPI clock of the board, for turning byte counts into bus time
+#define LCD_EMU_SPI_HZ 16000000
+
+typedef struct {
+  uint32_t spi_bytes;    // Command and data bytes
+  uint32_t window_sets;  // CASET and RASET commands
+  uint32_t ramwr;        // RAMWR commands
+  uint32_t pixels;       // Pixels written to display RAM
+} LcdEmuStats;
+
+// Counters since the last LCD_EMU_reset_stats
+LcdEmuStats LCD_EMU_get_stats(void);
+void LCD_EMU_reset_stats(void);
+// Time the counted bytes take on the bus, in microseconds
+uint32_t LCD_EMU_bus_us(const LcdEmuStats* stats);
+
+// The visible screen, row by row, in the current orientation
+uint16_t LCD_EMU_get_pixel(int x, int y);
+// Writes the visible screen as a binary PPM; returns 0 on success
+int LCD_EMU_write_ppm(const char* path);
+
+#endif /* HOST_LCD_EMU_H_ */
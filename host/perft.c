@@ -0,0 +1,186 @@
+//*****************************************************************************
+//
+// perft.c - Move generator correctness and speed check
+//
+// Counts the leaf nodes of the game tree to a given depth. Without arguments
+// it runs a suite of positions against known counts and fails on any
+// difference, so a change to the move generator can be checked for identical
+// results:
+//
+//   perft                 run the suite
+//   perft <depth> [fen]   count one position, the start position by default
+//
+// Positions are written FEN-like: the side to move, then the red and the
+// black pieces as squares 1-32, numbered row by row from the top left of the
+// board as drawn, with K in front of a king, e.g. "B:R18,K27:B6,K14".
+//
+//*****************************************************************************
+
+#include <game/checkers.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define START_FEN                                                        \
+  "R:R21,22,23,24,25,26,27,28,29,30,31,32:B1,2,3,4,5,6,7,8,9,10,11,12"
+
+#define MAX_DEPTH 16
+
+typedef struct {
+  const char* fen;
+  int depth;
+  uint64_t nodes;
+} PerftCase;
+
+// Start position counts are the published ones; the others were recorded
+// from this generator after cross-checking them to a lower depth against an
+// independent implementation of the rules.
+static const PerftCase suite[] = {
+    {START_FEN, 9, 3963680},
+    // Opening with men only
+    {"R:R17,19,23,25,26,30,31,32:B2,4,5,6,10,11,12,16", 9, 10185275},
+    // Forced double jump
+    {"R:R5,12,18,22,24,25,28,29,30,32:B1,2,3,4,8,9,17", 10, 1461555},
+    // Kings on both sides, black to move
+    {"B:RK2,19,23,24,30,32:B5,7,11,12,16,21,K29", 10, 7078090},
+    {"R:RK1,K7,9,21,24:B12,16,K30", 9, 5694149},
+    // Branching king captures and a man crowned mid-chain
+    {"R:R10,K18:B6,7,14,15,22,23,K27", 9, 5745256},
+    // Endgames
+    {"R:R15,K20,21:B13,27,K29,K31", 10, 9724976},
+    {"B:RK14,K23,K26:BK9,5,6,K30", 12, 2387287},
+};
+
+static MoveList lists[MAX_DEPTH];
+
+static bool parse_pieces(const char* text, uint32_t* pieces, uint32_t* kings) {
+  while (*text && *text != ':') {
+    bool king = false;
+    int square;
+
+    if (*text == ',') text++;
+    if (*text == 'K') {
+      king = true;
+      text++;
+    }
+    square = strtol(text, (char**)&text, 10);
+    if (square < 1 || square > CHECKERS_NUM_SQUARES) return false;
+    *pieces |= 1UL << (square - 1);
+    if (king) *kings |= 1UL << (square - 1);
+  }
+  return true;
+}
+
+static bool parse_fen(const char* fen, GameState* state) {
+  const char* black;
+
+  CHECKERS_init(state, PLAYER_RED);
+  state->red = state->black = state->kings = 0;
+
+  if ((fen[0] != 'R' && fen[0] != 'B') || fen[1] != ':' || fen[2] != 'R')
+    return false;
+  state->current_player = (fen[0] == 'R') ? PLAYER_RED : PLAYER_BLACK;
+  black = strstr(fen + 3, ":B");
+  if (black == NULL) return false;
+  if (!parse_pieces(fen + 3, &state->red, &state->kings) ||
+      !parse_pieces(black + 2, &state->black, &state->kings))
+    return false;
+  if (state->red & state->black) return false;
+
+  state->hash = CHECKERS_compute_hash(state);
+  return true;
+}
+
+static uint64_t perft(GameState* state, int depth) {
+  MoveList* list = &lists[depth];
+  uint64_t nodes = 0;
+  int i;
+
+  CHECKERS_generate_moves(state, list);
+  if (list->overflow) {
+    fprintf(stderr, "move list overflow, raise CHECKERS_MAX_MOVES\n");
+    exit(1);
+  }
+  if (depth == 1) return list->count;
+
+  for (i = 0; i < list->count; i++) {
+    uint32_t red = state->red, black = state->black, kings = state->kings;
+    uint32_t hash = state->hash;
+    Player player = state->current_player;
+
+    CHECKERS_make_move(state, &list->moves[i]);
+    nodes += perft(state, depth - 1);
+    state->red = red;
+    state->black = black;
+    state->kings = kings;
+    state->hash = hash;
+    state->current_player = player;
+  }
+  return nodes;
+}
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t run(const char* fen, int depth, double* seconds) {
+  GameState state;
+  double start;
+  uint64_t nodes;
+
+  if (!parse_fen(fen, &state)) {
+    fprintf(stderr, "bad position: %s\n", fen);
+    exit(2);
+  }
+  start = now_s();
+  nodes = perft(&state, depth);
+  *seconds = now_s() - start;
+  return nodes;
+}
+
+int main(int argc, char** argv) {
+  uint64_t total_nodes = 0;
+  double total_seconds = 0;
+  int failures = 0;
+  size_t i;
+
+  if (argc > 1) {
+    int depth = atoi(argv[1]);
+    int d;
+
+    if (depth < 1 || depth >= MAX_DEPTH) {
+      fprintf(stderr, "depth must be 1-%d\n", MAX_DEPTH - 1);
+      return 2;
+    }
+    for (d = 1; d <= depth; d++) {
+      double seconds;
+      uint64_t nodes = run((argc > 2) ? argv[2] : START_FEN, d, &seconds);
+      printf("%2d %14llu  %8.3f s  %6.1f Mnodes/s\n", d,
+             (unsigned long long)nodes, seconds,
+             seconds > 0 ? nodes / seconds / 1e6 : 0.0);
+    }
+    return 0;
+  }
+
+  for (i = 0; i < sizeof(suite) / sizeof(suite[0]); i++) {
+    double seconds;
+    uint64_t nodes = run(suite[i].fen, suite[i].depth, &seconds);
+    bool ok = nodes == suite[i].nodes;
+
+    printf("%s  depth %2d %12llu  %s\n", ok ? "ok  " : "FAIL", suite[i].depth,
+           (unsigned long long)nodes, suite[i].fen);
+    if (!ok) {
+      printf("      expected %llu\n", (unsigned long long)suite[i].nodes);
+      failures++;
+    }
+    total_nodes += nodes;
+    total_seconds += seconds;
+  }
+  printf("%llu nodes in %.2f s: %.1f Mnodes/s, %d failed\n",
+         (unsigned long long)total_nodes, total_seconds,
+         total_nodes / total_seconds / 1e6, failures);
+  return failures != 0;
+}
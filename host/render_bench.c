@@ -0,0 +1,351 @@
+//*****************************************************************************
+//
+// render_bench.c - LCD bus cost of the board and status rendering
+//
+// Runs the firmware's crystalfontz driver, grlib and views on the emulated
+// LCD in lcd_emu.c and reports, for typical frames, the SPI bytes, draw
+// window changes and RAMWR commands they cost, and the same for a piece
+// sliding into place and a line of the scrolling move history. The tile renderer is checked
+// pixel for pixel against the grlib drawing it replaced, so this doubles as
+// a rendering regression test; the board a slide ends on, the scrolled
+// history panel and partial mode are checked the same way. With -o DIR every frame is also written to
+// DIR as a PPM image.
+//
+//*****************************************************************************
+
+#include "lcd_emu.h"
+
+#include <game/board_view.h>
+#include <game/history_view.h>
+#include <game/status_view.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STATUS_LINE 40
+
+static Graphics_Context context;
+static const char* frame_dir;
+static int failures;
+
+//*****************************************************************************
+//
+// Reference: grlib drawing as it was before the tile cache
+//
+//*****************************************************************************
+static void legacy_draw_square(const GameState* state, int row, int col) {
+  Graphics_Rectangle rect;
+  int x = BOARD_OFFSET_X + col * SQUARE_SIZE;
+  int y = BOARD_OFFSET_Y + row * SQUARE_SIZE;
+  PieceType piece = CHECKERS_piece_at(state, row, col);
+  rect.xMin = x;
+  rect.yMin = y;
+  rect.xMax = x + SQUARE_SIZE - 1;
+  rect.yMax = y + SQUARE_SIZE - 1;
+
+  if (state->last_move_valid && ((row == state->last_move.from_row &&
+                                  col == state->last_move.from_col) ||
+                                 (row == state->last_move.to_row &&
+                                  col == state->last_move.to_col))) {
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_YELLOW);
+  } else if ((row + col) % 2 == 0) {
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_WHITE);
+  } else {
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_LIGHT_GRAY);
+  }
+  Graphics_fillRectangle(&context, &rect);
+
+  if (piece != EMPTY) {
+    int center_x = x + SQUARE_SIZE / 2;
+    int center_y = y + SQUARE_SIZE / 2;
+    if (piece == RED_PIECE || piece == RED_KING) {
+      Graphics_setForegroundColor(&context, GRAPHICS_COLOR_RED);
+    } else {
+      Graphics_setForegroundColor(&context, GRAPHICS_COLOR_BLACK);
+    }
+    Graphics_fillCircle(&context, center_x, center_y, 5);
+    if (piece == RED_KING || piece == BLACK_KING) {
+      Graphics_setForegroundColor(&context, GRAPHICS_COLOR_YELLOW);
+      Graphics_fillCircle(&context, center_x, center_y, 2);
+    }
+  }
+
+  if (state->selection_state == PIECE_SELECTED && row == state->selected_row &&
+      col == state->selected_col) {
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_BLUE);
+    Graphics_drawRectangle(&context, &rect);
+  }
+  if (row == state->hovered_row && col == state->hovered_col) {
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_GREEN);
+    Graphics_drawRectangle(&context, &rect);
+  }
+}
+
+static void legacy_draw_board(const GameState* state) {
+  int row, col;
+  for (row = 0; row < BOARD_SIZE; row++)
+    for (col = 0; col < BOARD_SIZE; col++) legacy_draw_square(state, row, col);
+}
+
+static void legacy_print_status(const char* status) {
+  Graphics_setForegroundColor(&context, GRAPHICS_COLOR_WHITE);
+  Graphics_fillRectangle(
+      &context,
+      &(Graphics_Rectangle){0, STATUS_LINE - 4, 127, STATUS_LINE + 8});
+  Graphics_setForegroundColor(&context, GRAPHICS_COLOR_RED);
+  Graphics_drawStringCentered(&context, (int8_t*)status, strlen(status), 64,
+                              STATUS_LINE, OPAQUE_TEXT);
+}
+
+//*****************************************************************************
+//
+// Frame accounting
+//
+//*****************************************************************************
+static void report(const char* name) {
+  LcdEmuStats stats = LCD_EMU_get_stats();
+  static int frame;
+
+  printf("%-28s %7u %6u %6u %7u %8.2f\n", name, (unsigned)stats.spi_bytes,
+         (unsigned)stats.window_sets, (unsigned)stats.ramwr,
+         (unsigned)stats.pixels, LCD_EMU_bus_us(&stats) / 1000.0);
+  if (frame_dir) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame%02d.ppm", frame_dir, frame);
+    if (LCD_EMU_write_ppm(path) != 0) {
+      printf("cannot write %s\n", path);
+      failures++;
+    }
+  }
+  frame++;
+  LCD_EMU_reset_stats();
+}
+
+// The tiles must reproduce what grlib drew, pixel for pixel
+static void compare_with_legacy(const GameState* state, const char* name) {
+  static uint16_t screen[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+  GameState copy = *state;
+  int x, y;
+
+  for (y = 0; y < LCD_EMU_HEIGHT; y++)
+    for (x = 0; x < LCD_EMU_WIDTH; x++) screen[y][x] = LCD_EMU_get_pixel(x, y);
+  legacy_draw_board(state);
+  for (y = 0; y < LCD_EMU_HEIGHT; y++) {
+    for (x = 0; x < LCD_EMU_WIDTH; x++) {
+      if (screen[y][x] != LCD_EMU_get_pixel(x, y)) {
+        printf("%s: tile renderer differs from grlib at (%d, %d)\n", name, x,
+               y);
+        failures++;
+        return;
+      }
+    }
+  }
+  // Put the tile rendering back so later frames start from it
+  BOARD_VIEW_invalidate(&copy);
+  BOARD_VIEW_draw(&copy);
+  LCD_EMU_reset_stats();
+}
+
+// Applies move and slides it in the way the firmware shows an opponent's
+// move, one BOARD_VIEW_draw_frame per frame tick
+static void bench_slide(GameState* game, const Move* move, const char* name) {
+  char label[64];
+  uint32_t most = 0, before = 0;
+  int frames = 0;
+  bool done;
+
+  CHECKERS_apply_move(game, move);
+  BOARD_VIEW_slide_last_move(game);
+  do {
+    LcdEmuStats stats;
+    done = BOARD_VIEW_draw_frame(game, 1000);
+    stats = LCD_EMU_get_stats();
+    if (stats.spi_bytes - before > most) most = stats.spi_bytes - before;
+    before = stats.spi_bytes;
+    frames++;
+  } while (!done);
+  snprintf(label, sizeof(label), "%s, %d frames", name, frames);
+  report(label);
+  printf("%-28s %7u\n", "  most in one frame", (unsigned)most);
+  compare_with_legacy(game, name);
+}
+
+//*****************************************************************************
+//
+// Move history
+//
+//*****************************************************************************
+static void read_rows(uint16_t rows[][LCD_EMU_WIDTH], int y0, int count) {
+  int x, y;
+  for (y = 0; y < count; y++)
+    for (x = 0; x < LCD_EMU_WIDTH; x++) rows[y][x] = LCD_EMU_get_pixel(x, y0 + y);
+}
+
+static int rows_equal(uint16_t a[][LCD_EMU_WIDTH], uint16_t b[][LCD_EMU_WIDTH],
+                      int count) {
+  return memcmp(a, b, count * sizeof(a[0])) == 0;
+}
+
+static void bench_history(GameState* game) {
+  static uint16_t scrolled[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+  static uint16_t expected[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+  static uint16_t board[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+  int panel_rows = LCD_EMU_HEIGHT - HISTORY_Y;
+  int first = 5 - HISTORY_LINES + 1;
+  int number, y;
+
+  HISTORY_VIEW_init();
+  for (number = 1; number < 5; number++) {
+    HISTORY_VIEW_add_move(number, PLAYER_RED, &game->last_move);
+  }
+  LCD_EMU_reset_stats();
+  HISTORY_VIEW_add_move(5, PLAYER_BLACK, &game->last_move);
+  report("history line, scrolled");
+  read_rows(scrolled, HISTORY_Y, panel_rows);
+
+  // Redrawing the panel with the newest lines shows what scrolling must
+  HISTORY_VIEW_init();
+  for (number = first; number < 5; number++) {
+    HISTORY_VIEW_add_move(number, PLAYER_RED, &game->last_move);
+  }
+  HISTORY_VIEW_add_move(5, PLAYER_BLACK, &game->last_move);
+  report("history panel, redrawn");
+  read_rows(expected, HISTORY_Y, panel_rows);
+  if (!rows_equal(scrolled, expected, panel_rows)) {
+    printf("scrolled history differs from a redrawn panel\n");
+    failures++;
+  }
+
+  // Partial mode blanks the panel and leaves the board alone
+  read_rows(board, 0, HISTORY_Y);
+  CRYSTALFONTZ_set_partial_rows(BOARD_OFFSET_Y, HISTORY_Y - 1);
+  report("partial mode on");
+  read_rows(scrolled, 0, LCD_EMU_HEIGHT);
+  for (y = HISTORY_Y; y < LCD_EMU_HEIGHT; y++) {
+    if (scrolled[y][0] != 0 || scrolled[y][LCD_EMU_WIDTH / 2] != 0) {
+      printf("partial mode still shows row %d\n", y);
+      failures++;
+      break;
+    }
+  }
+  if (!rows_equal(scrolled, board, HISTORY_Y)) {
+    printf("partial mode changed the board rows\n");
+    failures++;
+  }
+  CRYSTALFONTZ_set_normal_mode();
+  report("partial mode off");
+  read_rows(scrolled, HISTORY_Y, panel_rows);
+  if (!rows_equal(scrolled, expected, panel_rows)) {
+    printf("normal mode does not show the history again\n");
+    failures++;
+  }
+
+  // Whole lines scroll the same either way round, so also try an odd offset
+  for (y = 0; y < panel_rows; y++) {
+    Graphics_Rectangle row = {0, HISTORY_Y + y, LCD_EMU_WIDTH - 1,
+                              HISTORY_Y + y};
+    Graphics_fillRectangleOnDisplay(&g_sCRYSTALFONTZ, &row, y + 1);
+  }
+  CRYSTALFONTZ_scroll(3);
+  for (y = 0; y < panel_rows; y++) {
+    if (LCD_EMU_get_pixel(0, HISTORY_Y + y) != (y + 3) % panel_rows + 1) {
+      printf("scrolling by 3 shows the wrong row at %d\n", HISTORY_Y + y);
+      failures++;
+      break;
+    }
+  }
+  HISTORY_VIEW_init();
+  LCD_EMU_reset_stats();
+}
+
+int main(int argc, char** argv) {
+  GameState game;
+  MoveList list;
+  int i;
+
+  if (argc == 3 && strcmp(argv[1], "-o") == 0) {
+    frame_dir = argv[2];
+  } else if (argc != 1) {
+    printf("usage: %s [-o DIR]\n", argv[0]);
+    return 2;
+  }
+
+  // The same start-up as the firmware's main
+  CRYSTALFONTZ_init();
+  BOARD_VIEW_init();
+  STATUS_VIEW_init();
+  CRYSTALFONTZ_set_orientation(LCD_ORIENTATION_UP);
+  Graphics_initContext(&context, &g_sCRYSTALFONTZ);
+  Graphics_setForegroundColor(&context, GRAPHICS_COLOR_BLUE);
+  Graphics_setBackgroundColor(&context, GRAPHICS_COLOR_WHITE);
+  GrContextFontSet(&context, &g_sFontFixed6x8);
+  Graphics_clearDisplay(&context);
+  LCD_EMU_reset_stats();
+  CHECKERS_init(&game, PLAYER_RED);
+
+  printf("%-28s %7s %6s %6s %7s %8s\n", "frame", "bytes", "window", "ramwr",
+         "pixels", "bus ms");
+
+  legacy_draw_board(&game);
+  report("board, grlib");
+  BOARD_VIEW_draw(&game);
+  report("board, tiles");
+  compare_with_legacy(&game, "start position");
+
+  CHECKERS_move_cursor(1, 0, &game);
+  BOARD_VIEW_draw(&game);
+  report("cursor step");
+
+  game.hovered_row = 5;
+  game.hovered_col = 0;
+  BOARD_VIEW_invalidate(&game);
+  BOARD_VIEW_draw(&game);
+  LCD_EMU_reset_stats();
+  CHECKERS_select_piece(&game);
+  BOARD_VIEW_draw(&game);
+  report("select piece");
+
+  CHECKERS_generate_moves(&game, &list);
+  CHECKERS_apply_move(&game, &list.moves[0]);
+  BOARD_VIEW_draw(&game);
+  report("apply move");
+
+  CHECKERS_generate_moves(&game, &list);
+  bench_slide(&game, &list.moves[0], "slide step");
+
+  // Slide a capture in, from the first position on that has one
+  for (i = 0; i < 100 && CHECKERS_game_ended(&game) == PLAYER_NONE; i++) {
+    CHECKERS_generate_moves(&game, &list);
+    if (list.moves[0].jumps > 0) break;
+    CHECKERS_apply_move(&game, &list.moves[0]);
+  }
+  BOARD_VIEW_draw(&game);
+  LCD_EMU_reset_stats();
+  if (CHECKERS_game_ended(&game) == PLAYER_NONE && list.moves[0].jumps > 0) {
+    bench_slide(&game, &list.moves[0], "slide capture");
+  }
+
+  // Play into a position with kings and captures on the board
+  for (i = 0; i < 60 && CHECKERS_game_ended(&game) == PLAYER_NONE; i++) {
+    CHECKERS_generate_moves(&game, &list);
+    CHECKERS_apply_move(&game, &list.moves[i % list.count]);
+  }
+  BOARD_VIEW_draw(&game);
+  report("after 60 plies");
+  compare_with_legacy(&game, "after 60 plies");
+
+  legacy_print_status("THINKING...");
+  report("status, grlib");
+  legacy_print_status("");
+  report("status clear, grlib");
+  STATUS_VIEW_invalidate();
+  STATUS_VIEW_print("THINKING...", STATUS_LINE);
+  report("status, cells");
+  STATUS_VIEW_print("", STATUS_LINE);
+  report("status clear, cells");
+
+  bench_history(&game);
+
+  if (failures) printf("%d failure(s)\n", failures);
+  return failures != 0;
+}
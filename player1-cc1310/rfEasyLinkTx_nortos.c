@@ -5,6 +5,7 @@
 #include "Board.h"
 
 /* Standard C Libraries */
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -15,15 +16,25 @@
 #include <ti/devices/DeviceFamily.h>
 #include <ti/drivers/Power.h>
 #include <ti/drivers/UART.h>
+#include <ti/drivers/dpl/SemaphoreP.h>
 #include <ti/drivers/pin/PINCC26XX.h>
 #include <ti/drivers/rf/RF.h>
 
 /* EasyLink API Header files */
 #include "easylink/EasyLink.h"
-#define RFEASYLINKTXPAYLOAD_LENGTH 8
+// Frames on the UART to the MSP430, as in common_msp430/comm/protocol.h:
+//   sync, type, length, payload, CRC high byte, CRC low byte
+// The CRC is CRC-16/CCITT-FALSE over type, length and payload. The MSP430
+// computes it on its CRC module, this side in software.
+#define PROTOCOL_SYNC 0xA5
+#define PROTOCOL_MAX_PAYLOAD 32
+#define PROTOCOL_OVERHEAD 5
+#define PROTOCOL_MAX_FRAME (PROTOCOL_MAX_PAYLOAD + PROTOCOL_OVERHEAD)
+#define MSG_ACK 2
+#define MSG_PING 3
 
-/* Communication state machine */
-typedef enum { UART_READING, RF_SENDING, RF_RECEIVING, UART_WRITING } CommState;
+// 2-byte sequence number plus a whole frame, relayed as it came
+#define RFEASYLINKTXPAYLOAD_LENGTH (2 + PROTOCOL_MAX_FRAME)
 
 /* Pin driver handle */
 static PIN_Handle pinHandle;
@@ -39,8 +50,223 @@ PIN_Config pinTable[] = {Board_PIN_GLED | PIN_GPIO_OUTPUT_EN | PIN_GPIO_LOW |
                              PIN_PUSHPULL | PIN_DRVSTR_MAX,
                          PIN_TERMINATE};
 
+// The UART and the radio run at the same time: every driver call below is
+// asynchronous, its callback records what happened and posts eventSem, and
+// mainThread wakes, works through everything that is ready and sleeps again.
+static SemaphoreP_Handle eventSem;
+
+// Bytes from the MSP430. The read callback queues each byte and starts the
+// next read at once, so none is missed while the loop is busy.
+#define UART_RX_RING_SIZE 64
+static uint8_t uartRxByte;
+static uint8_t uartRxRing[UART_RX_RING_SIZE];
+static volatile uint8_t uartRxHead;  // Written by the read callback
+static volatile uint8_t uartRxTail;  // Written by mainThread
+
+// Frame going out to the MSP430; the buffer belongs to the UART driver
+// until the write callback
+static uint8_t uartTxFrame[PROTOCOL_MAX_FRAME];
+static volatile bool uartTxBusy = false;
+
+// Frame received over the air, waiting for the UART. The radio is only
+// listening while there is none, so the receive callback never overwrites it.
+static uint8_t rfRxFrame[PROTOCOL_MAX_FRAME];
+static volatile int rfRxSize = 0;  // 0 while there is none
+static volatile bool rfRxArmed = false;
+
+// Frame from the MSP430, waiting for the radio
+static uint8_t uartRxFrame[PROTOCOL_MAX_FRAME];
+static int uartRxLength = 0;
+static int uartRxSize = 0;  // 0 while there is none
+static EasyLink_TxPacket txPacket;
+static volatile bool rfTxBusy = false;
+
+static bool ackPending = false;
+
 static uint16_t seqNumber;
 
+// CRC-16/CCITT-FALSE of a frame's type, length and payload
+static uint16_t frame_crc(const uint8_t* frame) {
+  uint16_t crc = 0xFFFF;
+  int length = frame[2] + 2;
+  int i;
+
+  for (frame++; length > 0; length--) {
+    crc ^= (uint16_t)*frame++ << 8;
+    for (i = 0; i < 8; i++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+// True if the length bytes at frame are one whole frame with a good CRC
+static bool frame_valid(const uint8_t* frame, int length) {
+  uint16_t crc;
+
+  if (length < PROTOCOL_OVERHEAD || frame[0] != PROTOCOL_SYNC ||
+      frame[2] > PROTOCOL_MAX_PAYLOAD ||
+      length != frame[2] + PROTOCOL_OVERHEAD)
+    return false;
+  crc = frame_crc(frame);
+  return frame[3 + frame[2]] == (uint8_t)(crc >> 8) &&
+         frame[4 + frame[2]] == (uint8_t)crc;
+}
+
+// Adds a received byte to the frame collected in frame[0..*length). Returns
+// the frame's size once it is complete with a good CRC. Bytes that cannot
+// start a frame are dropped from the front, so a false sync byte loses
+// nothing but itself.
+static int frame_feed(uint8_t* frame, int* length, uint8_t byte) {
+  frame[(*length)++] = byte;
+  while (*length > 0) {
+    if (frame[0] == PROTOCOL_SYNC &&
+        (*length < 3 || frame[2] <= PROTOCOL_MAX_PAYLOAD)) {
+      int size = *length < 3 ? 0 : frame[2] + PROTOCOL_OVERHEAD;
+      if (*length < 3 || *length < size) return 0;
+      if (frame_valid(frame, size)) {
+        *length = 0;
+        return size;
+      }
+    }
+    memmove(frame, frame + 1, --(*length));
+  }
+  return 0;
+}
+
+static void uartReadCallback(UART_Handle handle, void* buf, size_t count) {
+  if (count > 0 &&
+      ((uartRxHead + 1) % UART_RX_RING_SIZE) != uartRxTail) {
+    uartRxRing[uartRxHead] = uartRxByte;
+    uartRxHead = (uartRxHead + 1) % UART_RX_RING_SIZE;
+  }
+  UART_read(handle, &uartRxByte, 1);
+  SemaphoreP_post(eventSem);
+}
+
+static void uartWriteCallback(UART_Handle handle, void* buf, size_t count) {
+  uartTxBusy = false;
+  SemaphoreP_post(eventSem);
+}
+
+static void rfReceiveCallback(EasyLink_RxPacket* rxPacket,
+                              EasyLink_Status status) {
+  // Relay the opponent's frame if it is intact; the packet is only valid
+  // during the callback
+  if (status == EasyLink_Status_Success && rxPacket->len > 2 &&
+      frame_valid(&rxPacket->payload[2], rxPacket->len - 2)) {
+    memcpy(rfRxFrame, &rxPacket->payload[2], rxPacket->len - 2);
+    rfRxSize = rxPacket->len - 2;
+  }
+  rfRxArmed = false;
+  SemaphoreP_post(eventSem);
+}
+
+static void rfTransmitCallback(EasyLink_Status status) {
+  if (status == EasyLink_Status_Success) {
+    PIN_setOutputValue(pinHandle, Board_PIN_RLED,
+                       !PIN_getOutputValue(Board_PIN_RLED));  // RF sent
+  }
+  rfTxBusy = false;
+  SemaphoreP_post(eventSem);
+}
+
+// Answers a ping from the MSP430 without going on air
+static void send_ack(void) {
+  uint16_t crc;
+
+  uartTxFrame[0] = PROTOCOL_SYNC;
+  uartTxFrame[1] = MSG_ACK;
+  uartTxFrame[2] = 0;
+  crc = frame_crc(uartTxFrame);
+  uartTxFrame[3] = crc >> 8;
+  uartTxFrame[4] = crc;
+  uartTxBusy = true;
+  UART_write(uartHandle, uartTxFrame, PROTOCOL_OVERHEAD);
+}
+
+// Each service_ function below returns true if it got anything done, so
+// mainThread runs them again until the bridge has nothing left to do.
+
+// Collects frames from the bytes the MSP430 sent, until one is waiting
+static bool service_uart_rx(void) {
+  bool progress = false;
+
+  while (uartRxTail != uartRxHead && uartRxSize == 0 && !ackPending) {
+    uint8_t byte = uartRxRing[uartRxTail];
+    int size;
+
+    uartRxTail = (uartRxTail + 1) % UART_RX_RING_SIZE;
+    size = frame_feed(uartRxFrame, &uartRxLength, byte);
+    if (size > 0 && uartRxFrame[1] == MSG_PING) {
+      ackPending = true;
+    } else if (size > 0) {
+      uartRxSize = size;
+    }
+    progress = true;
+  }
+  return progress;
+}
+
+// Hands one frame to the UART if it is free, an ack before a relayed frame
+static bool service_uart_tx(void) {
+  if (uartTxBusy) return false;
+
+  if (ackPending) {
+    ackPending = false;
+    send_ack();
+    return true;
+  }
+  if (rfRxSize > 0) {
+    memcpy(uartTxFrame, rfRxFrame, rfRxSize);
+    uartTxBusy = true;
+    UART_write(uartHandle, uartTxFrame, rfRxSize);
+    rfRxSize = 0;
+    PIN_setOutputValue(pinHandle, Board_PIN_GLED,
+                       !PIN_getOutputValue(Board_PIN_GLED));  // UART sent
+    return true;
+  }
+  return false;
+}
+
+// Sends the MSP430's frame over the air, then goes back to listening
+static bool service_radio(void) {
+  if (rfTxBusy) return false;
+
+  if (uartRxSize > 0) {
+    // The radio cannot listen and transmit at once
+    if (rfRxArmed) EasyLink_abort();
+
+    memset(&txPacket, 0, sizeof(txPacket));
+    txPacket.payload[0] = (uint8_t)(seqNumber >> 8);
+    txPacket.payload[1] = (uint8_t)(seqNumber++);
+    memcpy(&txPacket.payload[2], uartRxFrame, uartRxSize);
+    txPacket.len = 2 + uartRxSize;
+    txPacket.dstAddr[0] = 0xaa;
+    uartRxSize = 0;
+
+    rfTxBusy = true;
+    if (EasyLink_transmitAsync(&txPacket, rfTransmitCallback) !=
+        EasyLink_Status_Success) {
+      // Transmission failed, the frame is dropped
+      rfTxBusy = false;
+    }
+    return true;
+  }
+
+  // Listen until a packet arrives (no timeout), unless the last one is
+  // still waiting for the UART
+  if (!rfRxArmed && rfRxSize == 0) {
+    rfRxArmed = true;
+    if (EasyLink_receiveAsync(rfReceiveCallback, 0) ==
+        EasyLink_Status_Success) {
+      return true;
+    }
+    rfRxArmed = false;
+  }
+  return false;
+}
+
 void* mainThread(void* arg0) {
   /* Open LED pins */
   pinHandle = PIN_open(&pinState, pinTable);
@@ -52,6 +278,11 @@ void* mainThread(void* arg0) {
   PIN_setOutputValue(pinHandle, Board_PIN_GLED, 0);
   PIN_setOutputValue(pinHandle, Board_PIN_RLED, 0);
 
+  eventSem = SemaphoreP_createBinary(0);
+  if (eventSem == NULL) {
+    while (1);
+  }
+
   // Initialize UART driver
   UART_init();
 
@@ -62,10 +293,11 @@ void* mainThread(void* arg0) {
   uartParams.readDataMode = UART_DATA_BINARY;
   uartParams.writeDataMode = UART_DATA_BINARY;
   uartParams.readReturnMode = UART_RETURN_FULL;
-  uartParams.readTimeout = 1000;
   uartParams.readEcho = UART_ECHO_OFF;
-  uartParams.readMode = UART_MODE_BLOCKING;
-  uartParams.writeMode = UART_MODE_BLOCKING;
+  uartParams.readMode = UART_MODE_CALLBACK;
+  uartParams.readCallback = uartReadCallback;
+  uartParams.writeMode = UART_MODE_CALLBACK;
+  uartParams.writeCallback = uartWriteCallback;
   uartHandle = UART_open(Board_UART0, &uartParams);
   if (uartHandle == NULL) {
     while (1);
@@ -80,74 +312,20 @@ void* mainThread(void* arg0) {
   EasyLink_setFrequency(862000000);
   EasyLink_setRfPower(14);
 
-  char rxBuffer[8];
-  char txBuffer[8];
-  CommState state = UART_READING;
-  EasyLink_TxPacket txPacket = {0};
-  EasyLink_RxPacket rxPacket = {0};
+  // Start listening on both sides
+  UART_read(uartHandle, &uartRxByte, 1);
+  SemaphoreP_post(eventSem);
 
   while (1) {
-    switch (state) {
-      case UART_READING: {
-        // Wait for incoming move string from MSP430
-        memset(rxBuffer, 0, sizeof(rxBuffer));
-        int bytesRead = UART_read(uartHandle, rxBuffer, sizeof(rxBuffer) - 1);
-        if (bytesRead > 0) {
-          PIN_setOutputValue(pinHandle, Board_PIN_GLED,
-                             1);  // Green LED - UART received
-          state = RF_SENDING;
-        }
-        break;
-      }
+    bool progress;
 
-      case RF_SENDING:
-        // Create and send RF packet with the move string
-        memset(&txPacket, 0, sizeof(txPacket));
-        txPacket.payload[0] = (uint8_t)(seqNumber >> 8);
-        txPacket.payload[1] = (uint8_t)(seqNumber++);
-        strncpy((char*)&txPacket.payload[2], rxBuffer,
-                RFEASYLINKTXPAYLOAD_LENGTH - 3);
-        txPacket.len = RFEASYLINKTXPAYLOAD_LENGTH;
-        txPacket.dstAddr[0] = 0xaa;
-
-        if (EasyLink_transmit(&txPacket) == EasyLink_Status_Success) {
-          PIN_setOutputValue(pinHandle, Board_PIN_RLED,
-                             1);  // Red LED - RF transmitted
-          state = RF_RECEIVING;
-        } else {
-          // Transmission failed, go back to waiting
-          PIN_setOutputValue(pinHandle, Board_PIN_GLED, 0);
-          state = UART_READING;
-        }
-        break;
-
-      case RF_RECEIVING: {
-        // Wait to receive RF response (opponent's move)
-        memset(&rxPacket, 0, sizeof(rxPacket));
-        rxPacket.rxTimeout = EasyLink_ms_To_RadioTime(0);  // Wait indefinitely
-        if (EasyLink_receive(&rxPacket) == EasyLink_Status_Success) {
-          // Got RF response - extract opponent's move
-          char* rf_payload = (char*)&rxPacket.payload[2];
-          strncpy(txBuffer, rf_payload, sizeof(txBuffer) - 1);
-          txBuffer[sizeof(txBuffer) - 1] = '\0';
-
-          PIN_setOutputValue(pinHandle, Board_PIN_RLED,
-                             0);  // Red LED OFF - RF received
-          state = UART_WRITING;
-        }
-        break;
-      }
+    // Sleeps until a callback posts
+    SemaphoreP_pend(eventSem, SemaphoreP_WAIT_FOREVER);
 
-      case UART_WRITING:
-        // 200 milliseconds delay for MSP to start listening
-        usleep(200000);
-
-        // Send response back to MSP
-        UART_write(uartHandle, txBuffer, strlen(txBuffer));
-
-        PIN_setOutputValue(pinHandle, Board_PIN_GLED, 0);  // Green LED OFF
-        state = UART_READING;
-        break;
-    }
+    do {
+      progress = service_uart_rx();
+      progress |= service_uart_tx();
+      progress |= service_radio();
+    } while (progress);
   }
 }
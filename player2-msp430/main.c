@@ -10,6 +10,7 @@
 #include <hal/hal_i2c.h>
 #include <hal/hal_lcd.h>
 #include <hal/hal_pwm.h>
+#include <hal/hal_timer.h>
 #include <hal/hal_uart.h>
 
 // Driver headers
@@ -22,13 +23,23 @@
 
 // Game Headers
 #include <comm/protocol.h>
+#include <game/ai.h>
+#include <game/board_view.h>
 #include <game/checkers.h>
+#include <game/history_view.h>
+#include <game/status_view.h>
+#include <game/tablebase.h>
 #include <input/input.h>
 
 // Constants
 #define POLLING_RATE 60
-#define RENDER_INTERVAL 3                            // 60/3 = 20fps
-#define POLL_DELAY_CYCLES (16000000 / POLLING_RATE)  // 60Hz
+#define FRAME_PERIOD_MS (1000 / POLLING_RATE)  // 16ms
+#define RENDER_BUDGET_MS 8  // Board drawing per frame, the rest is input
+#define RECEIVE_TIMEOUT_MS 1000  // Backlight update interval while waiting
+
+// Set to 1 to let the AI play this seat instead of the joystick
+#define AI_PLAYS_THIS_SEAT 0
+#define AI_TIME_BUDGET_MS 2000
 
 // Turn state machine
 typedef enum { TURN_PLAYING, TURN_SENDING, TURN_WAITING } TurnState;
@@ -37,12 +48,16 @@ typedef enum { TURN_PLAYING, TURN_SENDING, TURN_WAITING } TurnState;
 void Clocks_init();
 void GUI_print_fixed_text();
 void GUI_print_status(char* status, int line);
+void GUI_add_history(GameState* game);
 void handle_input(GameState* game, InputState* input, TurnState* turn_state);
+void play_ai_move(GameState* game, TurnState* turn_state);
+void end_game_if_over(GameState* game);
 
 // Global variables
 Graphics_Context g_graphicsContext;
 TurnState turn_state = TURN_WAITING;  // Player 2 starts waiting
 Move pending_move;
+int move_number = 0;
 
 void main(void) {
   // Stop WDT
@@ -64,12 +79,15 @@ void main(void) {
   HAL_ADC_config();
   HAL_DIGIN_init_gpio();
   HAL_PWM_config();
+  HAL_TIMER_config();
 
   // Enable global interrupts
   __bis_SR_register(GIE);
 
   // External devices
   CRYSTALFONTZ_init();
+  BOARD_VIEW_init();
+  STATUS_VIEW_init();
   HAL_DIGIN_config();
   OPT3001_config();
   INPUT_init();
@@ -87,75 +105,84 @@ void main(void) {
 
   // Initial draw
   Graphics_clearDisplay(&g_graphicsContext);
-  CHECKERS_draw_board(&g_graphicsContext, &game);
+  BOARD_VIEW_draw(&game);
+  STATUS_VIEW_invalidate();
+  HISTORY_VIEW_init();
+  if (turn_state == TURN_WAITING) {
+    // Only the board is shown while the opponent plays
+    CRYSTALFONTZ_set_partial_rows(BOARD_OFFSET_Y, HISTORY_Y - 1);
+  }
 
   // Main loop
   int frame_counter = 0;
+  bool move_made = false;
+  HAL_TIMER_start_frames(FRAME_PERIOD_MS);
   while (1) {
-    // Check for game end
-    Player winner = CHECKERS_game_ended(&game);
-    if (winner != 0) {
-      CHECKERS_draw_board(&g_graphicsContext, &game);
-      if (winner == PLAYER_RED) {
-        GUI_print_status("RED WINS!", 40);
-      } else {
-        GUI_print_status("BLACK WINS!", 40);
-      }
-      while (1) {
-        // Game over - halt
-      }
+    // Adjudicate once per move, after it has reached the opponent
+    if (move_made) {
+      move_made = false;
+      end_game_if_over(&game);
     }
 
     switch (turn_state) {
       case TURN_PLAYING: {
-        // Accept input and handle moves
-        __delay_cycles(POLL_DELAY_CYCLES);
+#if AI_PLAYS_THIS_SEAT
+        play_ai_move(&game, &turn_state);
+#else
+        // Accept input and handle moves, one frame per timer tick
+        HAL_TIMER_wait_frame();
         HAL_ADC_trigger_single_conversion();
         InputState input = INPUT_poll();
         handle_input(&game, &input, &turn_state);
 
-        frame_counter++;
-        if (frame_counter >= RENDER_INTERVAL) {
-          CHECKERS_draw_board(&g_graphicsContext, &game);
-          frame_counter = 0;
-        }
+        // Whatever does not fit in the budget is drawn in the next frames
+        BOARD_VIEW_draw_frame(&game, RENDER_BUDGET_MS);
 
         // Update backlight every ~1 second
-        if (frame_counter % 60 == 0) {
+        frame_counter++;
+        if (frame_counter % POLLING_RATE == 0) {
           uint32_t lux = OPT3001_get_lux();
           LCD_BACKLIGHT_adjust_for_ambient(lux);
         }
+#endif
         break;
       }
       case TURN_SENDING:
         // Draw final board state
-        CHECKERS_draw_board(&g_graphicsContext, &game);
+        BOARD_VIEW_draw(&game);
+        GUI_add_history(&game);
         __delay_cycles(8000000);  // 0.5 second delay to see the move
 
         // Send move to opponent
-        char move_buffer[8];
+        char move_buffer[CHECKERS_MOVE_STR_LEN];
         CHECKERS_encode_move(&pending_move, move_buffer);
         send_string(move_buffer);
+        move_made = true;
 
-        // Switch to waiting for opponent
+        // Switch to waiting for opponent, only the board stays on
+        CRYSTALFONTZ_set_partial_rows(BOARD_OFFSET_Y, HISTORY_Y - 1);
         turn_state = TURN_WAITING;
         frame_counter = 0;
         break;
 
       case TURN_WAITING: {
-        // Wait for opponent's move
-        char receive_buffer[8];
-        bool ok =
-            receive_string(receive_buffer, sizeof(receive_buffer), 48000000);
-
-        if (ok) {
-          CHECKERS_apply_move_from_string(receive_buffer, &game);
-          CHECKERS_draw_board(&g_graphicsContext, &game);
-          __delay_cycles(8000000);  // 0.5 second delay
+        // Wait for opponent's move, asleep until it arrives or the timeout
+        // passes
+        char receive_buffer[CHECKERS_MOVE_STR_LEN];
+        ReceiveStatus status = receive_string(
+            receive_buffer, sizeof(receive_buffer), RECEIVE_TIMEOUT_MS);
+
+        if (status == RECEIVE_OK) {
+          CRYSTALFONTZ_set_normal_mode();
+          if (CHECKERS_apply_move_from_string(receive_buffer, &game)) {
+            GUI_add_history(&game);
+            // Slides in over the next frames while input keeps running
+            BOARD_VIEW_slide_last_move(&game);
+            move_made = true;
+          }
           turn_state = TURN_PLAYING;
-        } else {
-          __delay_cycles(8000000);
         }
+        // A timeout, or a frame lost to overflow or a bad CRC, keeps waiting
 
         // Update backlight while waiting
         uint32_t lux = OPT3001_get_lux();
@@ -188,6 +215,8 @@ void handle_input(GameState* game, InputState* input, TurnState* turn_state) {
       pending_move = CHECKERS_get_move(game);
       // Only send if the move is valid
       if (CHECKERS_apply_move(game, &pending_move)) {
+        // Send the whole move, including the capture chain it resolved to
+        pending_move = game->last_move;
         // Valid move: Single 100ms beep
         BUZ_sound_on();
         __delay_cycles(1600000);
@@ -207,6 +236,51 @@ void handle_input(GameState* game, InputState* input, TurnState* turn_state) {
   }
 }
 
+void play_ai_move(GameState* game, TurnState* turn_state) {
+  GUI_print_status("THINKING...", 40);
+  if (CHECKERS_ai_best_move(game, AI_TIME_BUDGET_MS, &pending_move) &&
+      CHECKERS_apply_move(game, &pending_move)) {
+    pending_move = game->last_move;
+    *turn_state = TURN_SENDING;
+  }
+  GUI_print_status("", 40);
+  // The status line overlaps the board
+  BOARD_VIEW_invalidate(game);
+  STATUS_VIEW_invalidate();
+}
+
+// Shows the result and halts if the game is over, counting the positions
+// the tablebase settles as over
+void end_game_if_over(GameState* game) {
+  Player winner = CHECKERS_game_ended(game);
+  TbValue endgame = TB_UNKNOWN;
+  if (winner == PLAYER_NONE) {
+    // Settle king endgames the tablebase knows instead of playing them out
+    uint8_t plies;
+    endgame = TB_probe(game, &plies);
+    if (endgame == TB_WIN) {
+      winner = game->current_player;
+    } else if (endgame == TB_LOSS) {
+      winner = (game->current_player == PLAYER_RED) ? PLAYER_BLACK : PLAYER_RED;
+    }
+  }
+  if (winner == PLAYER_NONE && endgame != TB_DRAW) return;
+
+  CRYSTALFONTZ_set_normal_mode();
+  BOARD_VIEW_draw(game);
+  STATUS_VIEW_invalidate();
+  if (winner == PLAYER_RED) {
+    GUI_print_status("RED WINS!", 40);
+  } else if (winner == PLAYER_BLACK) {
+    GUI_print_status("BLACK WINS!", 40);
+  } else {
+    GUI_print_status("DRAW!", 40);
+  }
+  while (1) {
+    // Game over - halt
+  }
+}
+
 void Clocks_init() {
   FRAMCtl_A_configureWaitStateControl(FRAMCTL_A_ACCESS_TIME_CYCLES_0);
   CS_setDCOFreq(CS_DCORSEL_1, CS_DCOFSEL_4);
@@ -222,17 +296,20 @@ void GUI_print_fixed_text() {
   Graphics_setBackgroundColor(&g_graphicsContext, GRAPHICS_COLOR_WHITE);
   GrContextFontSet(&g_graphicsContext, &g_sFontFixed6x8);
   Graphics_clearDisplay(&g_graphicsContext);
-  Graphics_drawStringCentered(&g_graphicsContext, (int8_t*)"Checkers",
-                              AUTO_STRING_LENGTH, 64, 10, OPAQUE_TEXT);
-  Graphics_drawStringCentered(&g_graphicsContext, (int8_t*)"Player 2",
-                              AUTO_STRING_LENGTH, 64, 20, OPAQUE_TEXT);
+  CRYSTALFONTZ_draw_string_centered(&g_graphicsContext, (int8_t*)"Checkers",
+                                    AUTO_STRING_LENGTH, 64, 10);
+  CRYSTALFONTZ_draw_string_centered(&g_graphicsContext, (int8_t*)"Player 2",
+                                    AUTO_STRING_LENGTH, 64, 20);
 }
 
 void GUI_print_status(char* status, int line) {
-  Graphics_setForegroundColor(&g_graphicsContext, GRAPHICS_COLOR_WHITE);
-  Graphics_fillRectangle(&g_graphicsContext,
-                         &(Graphics_Rectangle){0, line - 4, 127, line + 8});
-  Graphics_setForegroundColor(&g_graphicsContext, GRAPHICS_COLOR_RED);
-  Graphics_drawStringCentered(&g_graphicsContext, (int8_t*)status,
-                              strlen(status), 64, line, OPAQUE_TEXT);
+  STATUS_VIEW_print(status, line);
+}
+
+void GUI_add_history(GameState* game) {
+  // The move was just applied, so the mover is the player not to move
+  Player mover =
+      (game->current_player == PLAYER_RED) ? PLAYER_BLACK : PLAYER_RED;
+  move_number++;
+  HISTORY_VIEW_add_move(move_number, mover, &game->last_move);
 }